@@ -0,0 +1,129 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Benchmarks of EDGE.
+ **/
+#include "parallel/DistributedDummy.hpp"
+#include "monitor/Bench.hpp"
+#include "constants.hpp"
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "io/logging.h"
+#ifdef PP_USE_EASYLOGGING
+INITIALIZE_EASYLOGGINGPP
+#endif
+
+/**
+ * Gets the build configuration, which is shared by all benchmarks of the binary.
+ *
+ * @return record of the build configuration.
+ **/
+edge::monitor::Bench::Record build() {
+#if defined PP_T_EQUATIONS_ADVECTION
+  std::string l_equations = "advection";
+#elif defined PP_T_EQUATIONS_SWE
+  std::string l_equations = "swe";
+#elif defined(PP_N_RELAXATION_MECHANISMS) && (PP_N_RELAXATION_MECHANISMS==0)
+  std::string l_equations = "elastic";
+#else
+  std::string l_equations = "viscoelastic" + std::to_string(PP_N_RELAXATION_MECHANISMS);
+#endif
+
+#if defined PP_T_KERNELS_XSMM
+  std::string l_kernels = "xsmm";
+#elif defined PP_T_KERNELS_XSMM_DENSE_SINGLE
+  std::string l_kernels = "xsmm_dense_single";
+#elif defined PP_T_KERNELS_SIMD
+  std::string l_kernels = "simd";
+#else
+  std::string l_kernels = "vanilla";
+#endif
+
+#if defined __AVX512F__
+  std::string l_instSet = "avx512f";
+#elif defined __AVX2__
+  std::string l_instSet = "avx2";
+#elif defined __AVX__
+  std::string l_instSet = "avx";
+#elif defined __ARM_NEON
+  std::string l_instSet = "neon";
+#elif defined __SSE2__
+  std::string l_instSet = "sse2";
+#else
+  std::string l_instSet = "unknown";
+#endif
+
+  std::string l_elementType = "unknown";
+  if(      T_SDISC.ELEMENT == LINE   ) l_elementType = "line";
+  else if( T_SDISC.ELEMENT == QUAD4R ) l_elementType = "quad4r";
+  else if( T_SDISC.ELEMENT == TRIA3  ) l_elementType = "tria3";
+  else if( T_SDISC.ELEMENT == HEX8R  ) l_elementType = "hex8r";
+  else if( T_SDISC.ELEMENT == TET4   ) l_elementType = "tet4";
+
+  edge::monitor::Bench::Record l_build;
+  l_build.add( "equations", l_equations )
+         .add( "element_type", l_elementType )
+         .add( "order", (double) PP_ORDER )
+         .add( "cfr", (double) PP_N_CRUNS )
+         .add( "precision", (double) PP_PRECISION )
+         .add( "precision_comm", (double) PP_PRECISION_COMM )
+         .add( "kernels", l_kernels )
+         .add( "inst_set", l_instSet );
+
+  return l_build;
+}
+
+/**
+ * Runs the benchmarks.
+ *
+ * Usage: bench [filter] [output]
+ *   filter: only benchmarks whose names contain the filter are executed (default: all).
+ *   output: path of the JSON-file to which the results are written (default: stdout).
+ **/
+int main( int i_argc, char* i_argv[] ) {
+  // init distributed memory interface
+  edge::parallel::DistributedDummy l_distributed( i_argc, i_argv );
+
+  // disable logging file-IO
+  edge::io::logging::config();
+
+  std::string l_filter = (i_argc > 1) ? i_argv[1] : "";
+
+  edge::monitor::Bench::Record l_build = build();
+
+  std::size_t l_nRun = 0;
+  if( i_argc > 2 ) {
+    std::ofstream l_file( i_argv[2] );
+    l_nRun = edge::monitor::Bench::run( l_filter, l_file, &l_build );
+  }
+  else {
+    l_nRun = edge::monitor::Bench::run( l_filter, std::cout, &l_build );
+  }
+
+  if( l_nRun == 0 ) {
+    std::cerr << "no benchmark matching \"" << l_filter << "\", available:" << std::endl;
+    std::vector< std::string > l_names = edge::monitor::Bench::names();
+    for( std::size_t l_be = 0; l_be < l_names.size(); l_be++ ) std::cerr << "  " << l_names[l_be] << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -24,6 +24,7 @@
 #define EDGE_CONSTANTS_HPP
 
 #include <cstddef>
+#include "data/Bf16.hpp"
 
 // entity types
 typedef enum {
@@ -211,6 +212,7 @@ constexpr unsigned short CE_N_FLUXN_MATRICES( t_entityType i_enType ) {
  *
  * --- Input: Simulation related definitions ---
  * PP_PRECISION:                Floating point precision in bits.
+ * PP_PRECISION_COMM:           Floating point precision in bits of face-local and communication buffers (16: bfloat16), defaults to PP_PRECISION.
  * PP_N_CRUNS:                  Number of concurrent forward runs executed in a single execution of EDGE.
  * PP_ORDER                     Order of convergence.
  *
@@ -333,6 +335,18 @@ typedef float real_base;
 #elif PP_PRECISION==64
 typedef double real_base;
 #endif
+
+// storage precision of face-local and communication buffers, computations are performed in real_base
+#ifndef PP_PRECISION_COMM
+#define PP_PRECISION_COMM PP_PRECISION
+#endif
+#if PP_PRECISION_COMM==16
+typedef edge::data::Bf16 real_comm;
+#elif PP_PRECISION_COMM==32
+typedef float real_comm;
+#elif PP_PRECISION_COMM==64
+typedef double real_comm;
+#endif
 // precision of mesh associated data (vertices, ..)
 typedef double real_mesh;
 
@@ -676,6 +690,7 @@ const unsigned int N_ELEMENT_MODES = CE_N_ELEMENT_MODES( T_SDISC.ELEMENT, ORDER
  * Memory alignment
  */
 static_assert( PP_PRECISION == 64 || PP_PRECISION ==32, "precision not supported" );
+static_assert( PP_PRECISION_COMM <= PP_PRECISION, "precision of communication buffers exceeds the precision" );
 constexpr struct {
   struct {
     int STACK; // stack base pointers
@@ -0,0 +1,99 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Storage type for brain floating point numbers (bfloat16).
+ **/
+
+#ifndef EDGE_DATA_BF16_HPP
+#define EDGE_DATA_BF16_HPP
+
+#include <cstdint>
+#include <cstring>
+
+namespace edge {
+  namespace data {
+    class Bf16;
+  }
+}
+
+/**
+ * Storage type for bfloat16 numbers: sign, 8 exponent bits and 7 mantissa bits.
+ * The type is meant for storage and data movement only; arithmetic is performed after conversion to float.
+ **/
+class edge::data::Bf16 {
+  private:
+    //! raw bits: upper half of the corresponding IEEE-754 single precision number
+    std::uint16_t m_bits;
+
+  public:
+    /**
+     * Default constructor, leaves the bits uninitialized (as for native floating point types).
+     **/
+    Bf16() = default;
+
+    /**
+     * Constructs the number by rounding the given single precision number to the nearest (ties to even).
+     *
+     * @param i_val single precision number.
+     **/
+    Bf16( float i_val ) {
+      std::uint32_t l_bits;
+      std::memcpy( &l_bits, &i_val, sizeof(float) );
+
+      // NaNs: truncate, but keep a quiet NaN
+      if( (l_bits & 0x7fffffff) > 0x7f800000 ) {
+        m_bits = (l_bits >> 16) | 0x0040;
+      }
+      else {
+        l_bits += 0x7fff + ((l_bits >> 16) & 1);
+        m_bits = l_bits >> 16;
+      }
+    }
+
+    /**
+     * Constructs the number from the given double precision number (rounded to single precision first).
+     *
+     * @param i_val double precision number.
+     **/
+    Bf16( double i_val ) : Bf16( float(i_val) ) {}
+
+    /**
+     * Converts the number to single precision (exact).
+     *
+     * @return single precision number.
+     **/
+    operator float() const {
+      std::uint32_t l_bits = std::uint32_t(m_bits) << 16;
+      float l_val;
+      std::memcpy( &l_val, &l_bits, sizeof(float) );
+      return l_val;
+    }
+
+    /**
+     * Gets the raw bits.
+     *
+     * @return raw bits.
+     **/
+    std::uint16_t bits() const { return m_bits; }
+};
+
+static_assert( sizeof(edge::data::Bf16) == 2, "bfloat16 is expected to occupy two bytes" );
+
+#endif
@@ -0,0 +1,59 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Unit tests for the bfloat16 storage type.
+ **/
+
+#include <catch.hpp>
+#include <limits>
+#include <cmath>
+#include "Bf16.hpp"
+
+TEST_CASE( "Bf16: Conversion from and to single precision.", "[Bf16]" ) {
+  // exactly representable numbers
+  float l_exact[6] = { 0.0f, 1.0f, -2.0f, 0.5f, 3.0f, -1024.0f };
+  for( unsigned short l_nu = 0; l_nu < 6; l_nu++ ) {
+    edge::data::Bf16 l_bf = l_exact[l_nu];
+    REQUIRE( float(l_bf) == l_exact[l_nu] );
+  }
+
+  // raw bits of one
+  REQUIRE( edge::data::Bf16( 1.0f ).bits() == 0x3f80 );
+
+  // round to nearest: 1+2^-8 is a tie and rounds to even (1), 1+3*2^-9 rounds up
+  REQUIRE( float( edge::data::Bf16( 1.0f + std::ldexp( 1.0f, -8 ) ) ) == 1.0f );
+  REQUIRE( float( edge::data::Bf16( 1.0f + 3*std::ldexp( 1.0f, -9 ) ) ) == 1.0f + std::ldexp( 1.0f, -7 ) );
+
+  // relative error is bounded by 2^-8
+  for( int l_ex = -20; l_ex < 20; l_ex++ ) {
+    float l_val = 1.2345678f * std::ldexp( 1.0f, l_ex );
+    float l_rt = edge::data::Bf16( l_val );
+    REQUIRE( std::abs( l_rt - l_val ) <= std::ldexp( 1.0f, -8 ) * l_val );
+  }
+
+  // double precision input
+  REQUIRE( float( edge::data::Bf16( -0.25 ) ) == -0.25f );
+
+  // special values
+  float l_inf = std::numeric_limits< float >::infinity();
+  REQUIRE( float( edge::data::Bf16( l_inf ) ) == l_inf );
+  float l_nan = float( edge::data::Bf16( std::numeric_limits< float >::quiet_NaN() ) );
+  REQUIRE( l_nan != l_nan );
+}
@@ -0,0 +1,163 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Deduplication of bitwise-identical entity data.
+ **/
+
+#ifndef EDGE_DATA_DEDUP_HPP
+#define EDGE_DATA_DEDUP_HPP
+
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+#include "io/logging.h"
+
+namespace edge {
+  namespace data {
+    class Dedup;
+  }
+}
+
+/**
+ * Deduplication of bitwise-identical entity data.
+ * An entity might hold data in multiple arrays, e.g., the star matrices and flux solvers of an element.
+ * Two entities are identical if the data in all arrays matches.
+ **/
+class edge::data::Dedup {
+  public:
+    /**
+     * Computes the FNV-1a hash of the given bytes.
+     *
+     * @param i_nBytes number of bytes.
+     * @param i_bytes bytes which are hashed.
+     * @param i_hash initial hash, used to chain multiple byte sequences.
+     * @return hash.
+     **/
+    static std::size_t hash( std::size_t           i_nBytes,
+                             unsigned char const * i_bytes,
+                             std::size_t           i_hash = 14695981039346656037ULL ) {
+      std::size_t l_hash = i_hash;
+
+      for( std::size_t l_by = 0; l_by < i_nBytes; l_by++ ) {
+        l_hash ^= i_bytes[l_by];
+        l_hash *= 1099511628211ULL;
+      }
+
+      return l_hash;
+    }
+
+    /**
+     * Derives the ids of the unique entities.
+     * Ids are assigned in the order of first appearance, i.e., the first entity with id x appears before the first entity with id x+1.
+     *
+     * @param i_nEns number of entities.
+     * @param i_nArs number of arrays.
+     * @param i_nBytes number of bytes per entity in each of the arrays.
+     * @param i_ars arrays holding the entities' data.
+     * @param o_ids will be set to the ids of the unique entities.
+     * @return number of unique entities.
+     *
+     * @paramt TL_T_ID integral type of the ids.
+     **/
+    template< typename TL_T_ID >
+    static std::size_t ids( std::size_t                   i_nEns,
+                            unsigned short                i_nArs,
+                            std::size_t           const * i_nBytes,
+                            unsigned char const * const * i_ars,
+                            TL_T_ID                     * o_ids ) {
+      // representatives of the unique entities by hash
+      std::unordered_map< std::size_t, std::vector< std::size_t > > l_reps;
+      std::size_t l_nUn = 0;
+
+      for( std::size_t l_en = 0; l_en < i_nEns; l_en++ ) {
+        // hash the entity's data in all arrays
+        std::size_t l_hash = hash( 0, nullptr );
+        for( unsigned short l_ar = 0; l_ar < i_nArs; l_ar++ ) {
+          l_hash = hash( i_nBytes[l_ar],
+                         i_ars[l_ar] + l_en * i_nBytes[l_ar],
+                         l_hash );
+        }
+
+        // compare to the representatives with matching hash
+        std::vector< std::size_t > & l_cands = l_reps[l_hash];
+        bool l_found = false;
+
+        for( std::size_t l_ca = 0; l_ca < l_cands.size(); l_ca++ ) {
+          std::size_t l_re = l_cands[l_ca];
+
+          bool l_eq = true;
+          for( unsigned short l_ar = 0; l_ar < i_nArs; l_ar++ ) {
+            l_eq = l_eq && std::memcmp( i_ars[l_ar] + l_en * i_nBytes[l_ar],
+                                        i_ars[l_ar] + l_re * i_nBytes[l_ar],
+                                        i_nBytes[l_ar] ) == 0;
+          }
+
+          if( l_eq ) {
+            o_ids[l_en] = o_ids[l_re];
+            l_found = true;
+            break;
+          }
+        }
+
+        // new unique entity
+        if( !l_found ) {
+          EDGE_CHECK_LT( l_nUn, std::numeric_limits< TL_T_ID >::max() );
+          o_ids[l_en] = l_nUn;
+          l_cands.push_back( l_en );
+          l_nUn++;
+        }
+      }
+
+      return l_nUn;
+    }
+
+    /**
+     * Compacts the data of an array, based on the ids of the unique entities.
+     *
+     * @param i_nEns number of entities.
+     * @param i_nBytes number of bytes per entity.
+     * @param i_ids ids of the unique entities, as derived by ids.
+     * @param i_ar array holding the entities' data.
+     * @param o_ar will be set to the data of the unique entities, size: #unique entities * i_nBytes.
+     *
+     * @paramt TL_T_ID integral type of the ids.
+     **/
+    template< typename TL_T_ID >
+    static void compact( std::size_t           i_nEns,
+                         std::size_t           i_nBytes,
+                         TL_T_ID       const * i_ids,
+                         unsigned char const * i_ar,
+                         unsigned char       * o_ar ) {
+      // next unique entity, ids are assigned in the order of first appearance
+      std::size_t l_un = 0;
+
+      for( std::size_t l_en = 0; l_en < i_nEns; l_en++ ) {
+        if( i_ids[l_en] == l_un ) {
+          std::memcpy( o_ar + l_un * i_nBytes,
+                       i_ar + l_en * i_nBytes,
+                       i_nBytes );
+          l_un++;
+        }
+      }
+    }
+};
+
+#endif
@@ -0,0 +1,94 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Unit tests for the deduplication of entity data.
+ **/
+
+#include <catch.hpp>
+#include "Dedup.hpp"
+
+TEST_CASE( "Dedup: Hash of byte sequences.", "[hash][Dedup]" ) {
+  unsigned char l_bytes[6] = { 1, 2, 3, 1, 2, 3 };
+
+  // equal sequences have equal hashes
+  REQUIRE( edge::data::Dedup::hash( 3, l_bytes ) == edge::data::Dedup::hash( 3, l_bytes+3 ) );
+  REQUIRE( edge::data::Dedup::hash( 3, l_bytes ) != edge::data::Dedup::hash( 3, l_bytes+1 ) );
+
+  // chaining
+  std::size_t l_hash = edge::data::Dedup::hash( 2, l_bytes );
+  l_hash = edge::data::Dedup::hash( 4, l_bytes+2, l_hash );
+  REQUIRE( l_hash == edge::data::Dedup::hash( 6, l_bytes ) );
+}
+
+TEST_CASE( "Dedup: Ids and compaction of unique entities.", "[ids][compact][Dedup]" ) {
+  // two arrays: two values and one value per entity
+  float l_ar0[7][2] = { {1, 2}, {3, 4}, {1, 2}, {1, 2}, {5, 6}, {3, 4}, {1, 2} };
+  int   l_ar1[7]    = {  7,      8,      7,      9,      7,      8,      7     };
+
+  std::size_t l_nBytes[2] = { 2*sizeof(float), sizeof(int) };
+  unsigned char const * l_ars[2] = { (unsigned char const *) l_ar0,
+                                     (unsigned char const *) l_ar1 };
+
+  unsigned int l_ids[7];
+  std::size_t l_nUn = edge::data::Dedup::ids( 7,
+                                              2,
+                                              l_nBytes,
+                                              l_ars,
+                                              l_ids );
+
+  REQUIRE( l_nUn == 4 );
+  REQUIRE( l_ids[0] == 0 );
+  REQUIRE( l_ids[1] == 1 );
+  REQUIRE( l_ids[2] == 0 );
+  REQUIRE( l_ids[3] == 2 );
+  REQUIRE( l_ids[4] == 3 );
+  REQUIRE( l_ids[5] == 1 );
+  REQUIRE( l_ids[6] == 0 );
+
+  // single array: entities 0 and 3 become identical
+  l_nUn = edge::data::Dedup::ids( 7,
+                                  1,
+                                  l_nBytes,
+                                  l_ars,
+                                  l_ids );
+  REQUIRE( l_nUn == 3 );
+  REQUIRE( l_ids[3] == 0 );
+  REQUIRE( l_ids[4] == 2 );
+
+  // compact the first array
+  float l_un[3][2];
+  edge::data::Dedup::compact( 7,
+                              l_nBytes[0],
+                              l_ids,
+                              (unsigned char const *) l_ar0,
+                              (unsigned char *) l_un );
+
+  REQUIRE( l_un[0][0] == 1 );
+  REQUIRE( l_un[0][1] == 2 );
+  REQUIRE( l_un[1][0] == 3 );
+  REQUIRE( l_un[1][1] == 4 );
+  REQUIRE( l_un[2][0] == 5 );
+  REQUIRE( l_un[2][1] == 6 );
+
+  for( unsigned short l_en = 0; l_en < 7; l_en++ ) {
+    REQUIRE( l_un[ l_ids[l_en] ][0] == l_ar0[l_en][0] );
+    REQUIRE( l_un[ l_ids[l_en] ][1] == l_ar0[l_en][1] );
+  }
+}
\ No newline at end of file
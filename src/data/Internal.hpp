@@ -34,7 +34,7 @@
 #include "io/logging.h"
 #include "parallel/Shared.h"
 
-#if defined PP_T_KERNELS_VANILLA
+#if defined PP_T_KERNELS_VANILLA || defined PP_T_KERNELS_SIMD
 #include "data/MmVanilla.hpp"
 #elif defined PP_T_KERNELS_XSMM_DENSE_SINGLE
 #include "data/MmXsmmSingle.hpp"
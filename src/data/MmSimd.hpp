@@ -0,0 +1,310 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Data structures of the portable SIMD matrix-matrix multiplication kernels.
+ **/
+
+#ifndef EDGE_DATA_MM_SIMD_HPP
+#define EDGE_DATA_MM_SIMD_HPP
+
+#include <vector>
+#include "constants.hpp"
+#include "io/logging.h"
+
+#include "linalg/Simd.hpp"
+
+namespace edge {
+  namespace data {
+    template< typename       TL_T_REAL,
+              unsigned short TL_N_CRS >
+    class MmSimd;
+  }
+}
+
+/**
+ * Holds hand-vectorized kernels for fused and nonfused simulations.
+ * The kernels have the same semantics as the vanilla kernels (see linalg::Matrix::matMulFusedAC and linalg::Matrix::matMulFusedBC).
+ * In fused settings the fused simulations are the SIMD lanes, otherwise the columns of B and C (typically the modes).
+ * Zero entries of the non-fused matrix, e.g., in the star or stiffness matrices, are skipped.
+ *
+ * @paramt TL_T_REAL floating point precision.
+ * @paramt TL_N_CRS number of fused simulations.
+ **/
+template< typename       TL_T_REAL,
+          unsigned short TL_N_CRS >
+class edge::data::MmSimd {
+  private:
+    //! number of lanes used for non-fused simulations
+    static unsigned short const TL_N_LANES_NF = EDGE_SIMD_N_BYTES / sizeof(TL_T_REAL);
+
+    //! SIMD abstraction in fused settings
+    typedef linalg::Simd< TL_T_REAL, TL_N_CRS > t_simdF;
+
+    //! SIMD abstraction in non-fused settings
+    typedef linalg::Simd< TL_T_REAL, TL_N_LANES_NF > t_simdNf;
+
+    /**
+     * Hand-vectorized matrix kernels which store the BLAS identifiers and
+     * offers an overloaded function call operator.
+     **/
+    class Simd {
+      private:
+        //! number of rows in column-major A and C
+        const unsigned int m_m;
+
+        //! number of columns in column-major B and C
+        const unsigned int m_n;
+
+        //! number of columns/rows in column-major A/B
+        const unsigned int m_k;
+
+        //! leading dimension of column-major A
+        const unsigned int m_ldA;
+
+        //! leading dimension of column-major B
+        const unsigned int m_ldB;
+
+        //! leading dimension of column-major C
+        const unsigned int m_ldC;
+
+        //! alpha parameter
+        const TL_T_REAL m_alpha;
+
+        //! beta parameter
+        const TL_T_REAL m_beta;
+
+        //! true if matrices A and C carry fused simulations
+        const bool m_fusedAC;
+
+        /**
+         * Initializes a row of C: C[m][:][:] *= beta.
+         *
+         * @param io_c row of C.
+         **/
+        void initRow( TL_T_REAL * io_c ) const {
+          for( unsigned int l_n = 0; l_n < m_n * TL_N_CRS; l_n++ ) {
+            io_c[l_n] = (m_beta != TL_T_REAL(0)) ? io_c[l_n] * m_beta : 0;
+          }
+        }
+
+        /**
+         * Non-fused kernel: C = beta * C + alpha * A.B, vectorized over the columns of B and C.
+         *
+         * @param i_a matrix A.
+         * @param i_b matrix B.
+         * @param io_c matrix C.
+         **/
+        void nonFused( TL_T_REAL const * i_a,
+                       TL_T_REAL const * i_b,
+                       TL_T_REAL       * io_c ) const {
+          unsigned int l_nVec = m_n - m_n % TL_N_LANES_NF;
+
+          for( unsigned int l_m = 0; l_m < m_m; l_m++ ) {
+            TL_T_REAL *l_c = io_c + l_m * m_ldC;
+            initRow( l_c );
+
+            for( unsigned int l_k = 0; l_k < m_k; l_k++ ) {
+              TL_T_REAL l_a = i_a[l_m * m_ldA + l_k];
+              if( l_a == TL_T_REAL(0) ) continue;
+              l_a *= m_alpha;
+
+              TL_T_REAL const *l_b = i_b + l_k * m_ldB;
+
+              for( unsigned int l_n = 0; l_n < l_nVec; l_n += TL_N_LANES_NF ) {
+                typename t_simdNf::t_vec l_acc, l_vb;
+                t_simdNf::load( l_c+l_n, l_acc );
+                t_simdNf::load( l_b+l_n, l_vb );
+                t_simdNf::madd( l_a, l_vb, l_acc );
+                t_simdNf::store( l_acc, l_c+l_n );
+              }
+              for( unsigned int l_n = l_nVec; l_n < m_n; l_n++ ) l_c[l_n] += l_a * l_b[l_n];
+            }
+          }
+        }
+
+        /**
+         * Fused kernel with fused A and C: C[r] = beta * C[r] + alpha * A[r].B, vectorized over the fused simulations.
+         *
+         * @param i_a matrix A.
+         * @param i_b matrix B.
+         * @param io_c matrix C.
+         **/
+        void fusedAC( TL_T_REAL const * i_a,
+                      TL_T_REAL const * i_b,
+                      TL_T_REAL       * io_c ) const {
+          for( unsigned int l_m = 0; l_m < m_m; l_m++ ) {
+            TL_T_REAL *l_c = io_c + l_m * m_ldC * TL_N_CRS;
+            initRow( l_c );
+
+            for( unsigned int l_k = 0; l_k < m_k; l_k++ ) {
+              typename t_simdF::t_vec l_a;
+              t_simdF::load( i_a + (l_m * m_ldA + l_k) * TL_N_CRS, l_a );
+              t_simdF::scale( m_alpha, l_a );
+
+              TL_T_REAL const *l_b = i_b + l_k * m_ldB;
+
+              for( unsigned int l_n = 0; l_n < m_n; l_n++ ) {
+                if( l_b[l_n] == TL_T_REAL(0) ) continue;
+
+                typename t_simdF::t_vec l_acc;
+                t_simdF::load( l_c + l_n * TL_N_CRS, l_acc );
+                t_simdF::madd( l_b[l_n], l_a, l_acc );
+                t_simdF::store( l_acc, l_c + l_n * TL_N_CRS );
+              }
+            }
+          }
+        }
+
+        /**
+         * Fused kernel with fused B and C: C[r] = beta * C[r] + alpha * A.B[r], vectorized over the fused simulations.
+         *
+         * @param i_a matrix A.
+         * @param i_b matrix B.
+         * @param io_c matrix C.
+         **/
+        void fusedBC( TL_T_REAL const * i_a,
+                      TL_T_REAL const * i_b,
+                      TL_T_REAL       * io_c ) const {
+          for( unsigned int l_m = 0; l_m < m_m; l_m++ ) {
+            TL_T_REAL *l_c = io_c + l_m * m_ldC * TL_N_CRS;
+            initRow( l_c );
+
+            for( unsigned int l_k = 0; l_k < m_k; l_k++ ) {
+              TL_T_REAL l_a = i_a[l_m * m_ldA + l_k];
+              if( l_a == TL_T_REAL(0) ) continue;
+              l_a *= m_alpha;
+
+              TL_T_REAL const *l_b = i_b + l_k * m_ldB * TL_N_CRS;
+
+              for( unsigned int l_n = 0; l_n < m_n; l_n++ ) {
+                typename t_simdF::t_vec l_acc, l_vb;
+                t_simdF::load( l_c + l_n * TL_N_CRS, l_acc );
+                t_simdF::load( l_b + l_n * TL_N_CRS, l_vb );
+                t_simdF::madd( l_a, l_vb, l_acc );
+                t_simdF::store( l_acc, l_c + l_n * TL_N_CRS );
+              }
+            }
+          }
+        }
+
+      public:
+        /**
+         * Constructor.
+         *
+         * @param i_m number of rows in column-major A and C.
+         * @param i_n number of columns in column-major B and C.
+         * @param i_k number of columns/rows in column-major A/B.
+         * @param i_ldA leading dimension of column-major A.
+         * @param i_ldB leading dimension of column-major B.
+         * @param i_ldC leading dimension of column-major C.
+         * @param i_alpha alpha parameter.
+         * @param i_beta beta parameter.
+         * @param i_fusedAC true if matrices A and C are fused, false if matrices B and C are fused.
+         **/
+        Simd( unsigned int   i_m,
+              unsigned int   i_n,
+              unsigned int   i_k,
+              unsigned int   i_ldA,
+              unsigned int   i_ldB,
+              unsigned int   i_ldC,
+              TL_T_REAL      i_alpha,
+              TL_T_REAL      i_beta,
+              bool           i_fusedAC ): m_m( i_m ),
+                                          m_n( i_n ),
+                                          m_k( i_k ),
+                                          m_ldA( i_ldA ),
+                                          m_ldB( i_ldB ),
+                                          m_ldC( i_ldC ),
+                                          m_alpha( i_alpha ),
+                                          m_beta( i_beta ),
+                                          m_fusedAC( i_fusedAC ) {};
+
+          /**
+           * Overloads the function call operator with the kernel execution.
+           *
+           * @param i_a matrix A.
+           * @param i_b matrix B.
+           * @param io_c matrix C.
+           **/
+          void operator()( TL_T_REAL const * i_a,
+                           TL_T_REAL const * i_b,
+                           TL_T_REAL       * io_c ) const {
+            if( TL_N_CRS == 1 ) nonFused( i_a, i_b, io_c );
+            else if( m_fusedAC ) fusedAC( i_a, i_b, io_c );
+            else                 fusedBC( i_a, i_b, io_c );
+          };
+    };
+
+  public:
+    //! SIMD matrix kernels
+    std::vector< std::vector< Simd > > m_kernels;
+
+    /**
+     * Adds a SIMD kernel (either fused or non-fused).
+     * If the given kernel group does not exist, new groups until the given id are created.
+     *
+     * @param i_group id of the kernel group.
+     * @param i_m number of rows in column-major A and C.
+     * @param i_n number of columns in column-major B and C.
+     * @param i_k number of columns/rows in column-major A/B.
+     * @param i_ldA leading dimension of column-major A.
+     * @param i_ldB leading dimension of column-major B.
+     * @param i_ldC leading dimension of column-major C.
+     * @param i_alpha parameter alpha.
+     * @param i_beta parameter beta.
+     * @param i_fusedAC true if matrices A and C are fused.
+     * @param i_fusedBC true if matrices B and C are fused.
+     * @param i_nCfr number of fused simulations, has to match TL_N_CRS.
+     **/
+    void add( unsigned short i_group,
+              unsigned int   i_m,
+              unsigned int   i_n,
+              unsigned int   i_k,
+              unsigned int   i_ldA,
+              unsigned int   i_ldB,
+              unsigned int   i_ldC,
+              TL_T_REAL      i_alpha,
+              TL_T_REAL      i_beta,
+              bool           i_fusedAC,
+              bool           i_fusedBC,
+              unsigned short i_nCfr ) {
+      // verbose output
+      EDGE_VLOG(1) << "  adding simd-kernel #" << m_kernels.size() << " (dense)"
+                   << " M=" << i_m << " N=" << i_n << " K=" << i_k
+                   << " ldA=" << i_ldA << " ldB=" << i_ldB << " ldC=" << i_ldC
+                   << " alpha=" << i_alpha << " beta=" << i_beta
+                   << " fusedAC=" << i_fusedAC << " fusedBC=" << i_fusedBC
+                   << " cfr=" << i_nCfr;
+
+      EDGE_CHECK_EQ( i_nCfr, TL_N_CRS );
+      EDGE_CHECK( i_fusedAC || i_fusedBC );
+
+      // add kernel groups, if required
+      if( i_group >= m_kernels.size() ) m_kernels.resize( i_group+1 );
+
+      // add kernel
+      m_kernels[i_group].push_back( Simd( i_m, i_n, i_k,
+                                          i_ldA, i_ldB, i_ldC,
+                                          i_alpha,
+                                          i_beta,
+                                          i_fusedAC ) );
+    }
+};
+#endif
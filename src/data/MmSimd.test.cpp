@@ -0,0 +1,133 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Unit tests for the portable SIMD matrix kernels.
+ **/
+#include <catch.hpp>
+#include <cstdlib>
+#include "linalg/Matrix.h"
+#include "MmSimd.hpp"
+
+namespace edge {
+  namespace data {
+    namespace test {
+      /**
+       * Compares the SIMD kernels to the vanilla implementation for random matrices, which contain zero-entries.
+       *
+       * @param i_m number of rows in A and C.
+       * @param i_n number of columns in B and C.
+       * @param i_k number of columns/rows in A/B.
+       * @param i_alpha parameter alpha.
+       * @param i_beta parameter beta.
+       * @param i_fusedAC true if A and C are fused, false if B and C are fused.
+       *
+       * @paramt TL_T_REAL floating point precision.
+       * @paramt TL_N_CRS number of fused simulations.
+       **/
+      template< typename       TL_T_REAL,
+                unsigned short TL_N_CRS >
+      void mmSimd( unsigned int i_m,
+                   unsigned int i_n,
+                   unsigned int i_k,
+                   TL_T_REAL    i_alpha,
+                   TL_T_REAL    i_beta,
+                   bool         i_fusedAC ) {
+        // leading dimensions exceed the sizes
+        unsigned int l_ldA = i_k+1;
+        unsigned int l_ldB = i_n+2;
+        unsigned int l_ldC = i_n+3;
+
+        unsigned int l_nCrsA = (i_fusedAC) ? TL_N_CRS : 1;
+        unsigned int l_nCrsB = (i_fusedAC) ? 1 : TL_N_CRS;
+
+        TL_T_REAL *l_a = new TL_T_REAL[ i_m * l_ldA * l_nCrsA ];
+        TL_T_REAL *l_b = new TL_T_REAL[ i_k * l_ldB * l_nCrsB ];
+        TL_T_REAL *l_c0 = new TL_T_REAL[ i_m * l_ldC * TL_N_CRS ];
+        TL_T_REAL *l_c1 = new TL_T_REAL[ i_m * l_ldC * TL_N_CRS ];
+
+        srand( 1234 );
+        for( unsigned int l_en = 0; l_en < i_m * l_ldA * l_nCrsA; l_en++ ) {
+          l_a[l_en] = (rand() % 3 == 0) ? TL_T_REAL(0) : (TL_T_REAL) rand() / RAND_MAX - TL_T_REAL(0.5);
+        }
+        for( unsigned int l_en = 0; l_en < i_k * l_ldB * l_nCrsB; l_en++ ) {
+          l_b[l_en] = (rand() % 3 == 0) ? TL_T_REAL(0) : (TL_T_REAL) rand() / RAND_MAX - TL_T_REAL(0.5);
+        }
+        for( unsigned int l_en = 0; l_en < i_m * l_ldC * TL_N_CRS; l_en++ ) {
+          l_c0[l_en] = l_c1[l_en] = (TL_T_REAL) rand() / RAND_MAX;
+        }
+
+        // reference
+        if( i_fusedAC ) {
+          linalg::Matrix::matMulFusedAC( TL_N_CRS,
+                                         i_m, i_n, i_k,
+                                         l_ldA, l_ldB, l_ldC,
+                                         i_alpha, i_beta,
+                                         l_a, l_b, l_c0 );
+        }
+        else {
+          linalg::Matrix::matMulFusedBC( TL_N_CRS,
+                                         i_m, i_n, i_k,
+                                         l_ldA, l_ldB, l_ldC,
+                                         i_alpha, i_beta,
+                                         l_a, l_b, l_c0 );
+        }
+
+        // SIMD kernel
+        MmSimd< TL_T_REAL, TL_N_CRS > l_simd;
+        l_simd.add( 0,
+                    i_m, i_n, i_k,
+                    l_ldA, l_ldB, l_ldC,
+                    i_alpha, i_beta,
+                    i_fusedAC, !i_fusedAC,
+                    TL_N_CRS );
+        l_simd.m_kernels[0][0]( l_a, l_b, l_c1 );
+
+        for( unsigned int l_m = 0; l_m < i_m; l_m++ ) {
+          for( unsigned int l_n = 0; l_n < l_ldC * TL_N_CRS; l_n++ ) {
+            REQUIRE( l_c1[l_m * l_ldC * TL_N_CRS + l_n] == Approx( l_c0[l_m * l_ldC * TL_N_CRS + l_n] ).margin( 1E-5 ) );
+          }
+        }
+
+        delete[] l_a;
+        delete[] l_b;
+        delete[] l_c0;
+        delete[] l_c1;
+      }
+    }
+  }
+}
+
+TEST_CASE( "SIMD: GEMM without fused simulations.", "[mmSimd][nonFused]" ) {
+  // stiffness- and star-like shapes, including remainders of the vector length
+  edge::data::test::mmSimd< float, 1 >(  9, 20, 10, float(1), float(0), true  );
+  edge::data::test::mmSimd< float, 1 >(  9, 35,  9, float(1), float(1), false );
+  edge::data::test::mmSimd< float, 1 >(  3,  3,  3, float(2), float(1), true  );
+  edge::data::test::mmSimd< double, 1 >( 9, 35, 20, double(1), double(0), true  );
+  edge::data::test::mmSimd< double, 1 >( 6, 17,  5, double(0.5), double(1), false );
+}
+
+TEST_CASE( "SIMD: GEMM with fused simulations.", "[mmSimd][fused]" ) {
+  edge::data::test::mmSimd< float, 8 >(   9, 20, 10, float(1), float(0), true  );
+  edge::data::test::mmSimd< float, 8 >(   9, 20,  9, float(1), float(1), false );
+  edge::data::test::mmSimd< float, 16 >(  9, 35, 20, float(1), float(0), true  );
+  edge::data::test::mmSimd< float, 16 >(  9, 35,  9, float(2), float(1), false );
+  edge::data::test::mmSimd< double, 2 >(  4,  7,  5, double(1), double(1), true  );
+  edge::data::test::mmSimd< double, 4 >(  4,  7,  5, double(1), double(0), false );
+}
@@ -32,6 +32,7 @@
 #include "io/logging.h"
 #include "linalg/Matrix.h"
 #include "parallel/global.h"
+#include "MmXsmmKernels.hpp"
  
 #include <libxsmm.h>
 
@@ -45,11 +46,6 @@ namespace edge {
 
     template<>
     class MmXsmmFused< double >;
-
-    typedef struct MmXsmmStats {
-      size_t invocations;
-      size_t cycles;
-    } MmXsmmStats;
   }
 }
 
@@ -57,28 +53,12 @@ namespace edge {
  * Holds LIBXSMM kernels for fused, single precision simulations.
  **/
 template<>
-class edge::data::MmXsmmFused< float > {
+class edge::data::MmXsmmFused< float > : public MmXsmmKernels< libxsmm_smmfunction > {
   private:
     //! gemm descriptors of libxsmm
     std::vector< std::vector< const libxsmm_gemm_descriptor* > > m_descs;
  
   public:
-    //! generated kernels of libxsmm
-    std::vector< std::vector< libxsmm_smmfunction > > m_kernels;
-
-    //! number of flops performed by each libxsmm kernel
-    std::vector< std::vector< size_t > > m_kernelFlops;
-
-    //! stats for kernels 
-    std::vector< std::vector< std::vector< MmXsmmStats > > > m_kernelStats;
-
-    /**
-     * @brief Constructor.
-     */
-    MmXsmmFused() {
-      m_kernelStats.resize(edge::parallel::g_nThreads);
-    }
-
     /**
      * Adds a sparse, single-precision libxsmm-kernel for the given matrix in CSR- or CSC-format.
      *
@@ -118,13 +98,8 @@ class edge::data::MmXsmmFused< float > {
                    << " alpha=" << i_alpha << " beta=" << i_beta;
 
       // add kernel groups, if required
-      if( i_group >= m_kernels.size() ) {
+      if( i_group >= m_descs.size() ) {
         m_descs.resize( i_group+1 );
-        m_kernels.resize( i_group+1 );
-        m_kernelFlops.resize( i_group+1 );
-        for ( int i = 0; i < edge::parallel::g_nThreads; ++i ) {
-          m_kernelStats[i].resize( i_group+1 );
-        }
       }
 
       // add description
@@ -136,25 +111,25 @@ class edge::data::MmXsmmFused< float > {
  
       m_descs[i_group].push_back( l_desc );
  
-      // generate and store function for this kernels
+      // generate function for this kernel
+      libxsmm_smmfunction l_kernel = nullptr;
       if( i_csr )
-        m_kernels[i_group].push_back( libxsmm_create_packed_spxgemm_csr( m_descs[i_group].back(), i_nCrs, i_ptr, i_idx, i_val ).smm );
+        l_kernel = libxsmm_create_packed_spxgemm_csr( m_descs[i_group].back(), i_nCrs, i_ptr, i_idx, i_val ).smm;
       else
-        m_kernels[i_group].push_back( libxsmm_create_packed_spxgemm_csc( m_descs[i_group].back(), i_nCrs, i_ptr, i_idx, i_val ).smm );
+        l_kernel = libxsmm_create_packed_spxgemm_csc( m_descs[i_group].back(), i_nCrs, i_ptr, i_idx, i_val ).smm;
 
       // check that we generated a kernel
-      EDGE_CHECK( m_kernels[i_group].back() != 0 );
+      EDGE_CHECK( l_kernel != 0 );
 
-      // read flops and store them
+      // read flops
       libxsmm_kernel_info l_kinfo;
-      libxsmm_get_kernel_info( (const void*)m_kernels[i_group].back(), &l_kinfo );
-      m_kernelFlops[i_group].push_back( l_kinfo.nflops );
+      libxsmm_get_kernel_info( (const void*)l_kernel, &l_kinfo );
 
-      // Initalize stats telemetry
-      MmXsmmStats l_mystats = { 0 , 0 };
-      for ( int i = 0; i < edge::parallel::g_nThreads; ++i ) {
-        m_kernelStats[i][i_group].push_back( l_mystats );
-      }
+      // store kernel
+      MmXsmmDesc l_kDesc = { i_m, i_n, i_k, 0 };
+      l_kDesc.density  = i_ptr[ i_csr ? i_m : i_n ];
+      l_kDesc.density /= i_csr ? double(i_m) * i_k : double(i_k) * i_n;
+      addKernel( i_group, l_kernel, l_kDesc, l_kinfo.nflops );
     }
 
     /**
@@ -191,13 +166,8 @@ class edge::data::MmXsmmFused< float > {
       EDGE_CHECK( i_fusedBC || i_fusedAC );
 
       // add kernel groups, if required
-      if( i_group >= m_kernels.size() ) {
+      if( i_group >= m_descs.size() ) {
         m_descs.resize( i_group+1 );
-        m_kernels.resize( i_group+1 );
-        m_kernelFlops.resize( i_group+1 );
-        for ( int i = 0; i < edge::parallel::g_nThreads; ++i ) {
-          m_kernelStats[i].resize( i_group+1 );
-        }
       }
 
       // add description
@@ -214,6 +184,8 @@ class edge::data::MmXsmmFused< float > {
 
       m_descs[i_group].push_back( l_desc );
 
+      // generate function for this kernel
+      libxsmm_smmfunction l_kernel = nullptr;
       if( i_fusedBC ) {
         // generate fake CSR-structure
         unsigned int *l_rows = nullptr;
@@ -222,29 +194,25 @@ class edge::data::MmXsmmFused< float > {
         linalg::Matrix::fakeCsr( i_m, i_n, i_k,
                                  l_rows, l_cols, l_vals );
 
-        // generate and store function for this kernels
-        m_kernels[i_group].push_back( libxsmm_create_packed_spxgemm_csr( m_descs[i_group].back(), i_nCrs, l_rows, l_cols, l_vals ).smm );
+        l_kernel = libxsmm_create_packed_spxgemm_csr( m_descs[i_group].back(), i_nCrs, l_rows, l_cols, l_vals ).smm;
 
         // free memory of fake CSR-structure
         delete[] l_rows; delete[] l_cols; delete[] l_vals;
       }
       else {
-        m_kernels[i_group].push_back( libxsmm_create_packed_xgemm_ac_rm( m_descs[i_group].back(), i_nCrs ).smm );
+        l_kernel = libxsmm_create_packed_xgemm_ac_rm( m_descs[i_group].back(), i_nCrs ).smm;
       }
 
       // check that we generated a kernel
-      EDGE_CHECK( m_kernels[i_group].back() != 0 );
+      EDGE_CHECK( l_kernel != 0 );
 
-      // read flops and store them
+      // read flops
       libxsmm_kernel_info l_kinfo;
-      libxsmm_get_kernel_info( (const void*)m_kernels[i_group].back(), &l_kinfo );
-      m_kernelFlops[i_group].push_back( l_kinfo.nflops );
+      libxsmm_get_kernel_info( (const void*)l_kernel, &l_kinfo );
 
-      // Initalize stats telemetry
-      MmXsmmStats l_mystats = { 0 , 0 };
-      for ( int i = 0; i < edge::parallel::g_nThreads; ++i ) {
-        m_kernelStats[i][i_group].push_back( l_mystats );
-      }
+      // store kernel
+      MmXsmmDesc l_kDesc = { i_m, i_n, i_k, 1 };
+      addKernel( i_group, l_kernel, l_kDesc, l_kinfo.nflops );
     }
 };
 
@@ -252,28 +220,12 @@ class edge::data::MmXsmmFused< float > {
  * Holds LIBXSMM kernels for fused, double precision simulations.
  **/
 template<>
-class edge::data::MmXsmmFused< double > {
+class edge::data::MmXsmmFused< double > : public MmXsmmKernels< libxsmm_dmmfunction > {
   private:
     //! gemm descriptors of libxsmm
     std::vector< std::vector< const libxsmm_gemm_descriptor* > > m_descs;
  
   public:
-    //! generated kernels of libxsmm
-    std::vector< std::vector< libxsmm_dmmfunction > > m_kernels;
- 
-    //! number of flops performed by each libxsmm kernel
-    std::vector< std::vector< size_t > > m_kernelFlops;
-
-    //! stats for kernels 
-    std::vector< std::vector< std::vector< MmXsmmStats > > > m_kernelStats;
-
-    /**
-     * @brief Constructor, which limits the LIBXSMM target architecture, if required.
-     */
-    MmXsmmFused() {
-      m_kernelStats.resize(edge::parallel::g_nThreads);
-    }
-
     /**
      * Adds a sparse libxsmm-kernel for the given matrix in CSR- or CSC-format.
      *
@@ -314,13 +266,8 @@ class edge::data::MmXsmmFused< double > {
                    << " alpha=" << i_alpha << " beta=" << i_beta;
 
       // add kernel groups, if required
-      if( i_group >= m_kernels.size() ) {
+      if( i_group >= m_descs.size() ) {
         m_descs.resize( i_group+1 );
-        m_kernels.resize( i_group+1 );
-        m_kernelFlops.resize( i_group+1 );
-        for ( int i = 0; i < edge::parallel::g_nThreads; ++i ) {
-          m_kernelStats[i].resize( i_group+1 );
-        }
       }
 
       // add description
@@ -332,25 +279,25 @@ class edge::data::MmXsmmFused< double > {
 
       m_descs[i_group].push_back( l_desc );
 
-      // generate and store function for this kernels
+      // generate function for this kernel
+      libxsmm_dmmfunction l_kernel = nullptr;
       if( i_csr )
-        m_kernels[i_group].push_back( libxsmm_create_packed_spxgemm_csr( m_descs[i_group].back(), i_nCrs, i_ptr, i_idx, i_val ).dmm );
+        l_kernel = libxsmm_create_packed_spxgemm_csr( m_descs[i_group].back(), i_nCrs, i_ptr, i_idx, i_val ).dmm;
       else
-        m_kernels[i_group].push_back( libxsmm_create_packed_spxgemm_csc( m_descs[i_group].back(), i_nCrs, i_ptr, i_idx, i_val ).dmm );
+        l_kernel = libxsmm_create_packed_spxgemm_csc( m_descs[i_group].back(), i_nCrs, i_ptr, i_idx, i_val ).dmm;
 
       // check that we generated a kernel
-      EDGE_CHECK( m_kernels[i_group].back() != 0 );
+      EDGE_CHECK( l_kernel != 0 );
 
-      // read flops and store them
+      // read flops
       libxsmm_kernel_info l_kinfo;
-      libxsmm_get_kernel_info( (const void*)m_kernels[i_group].back(), &l_kinfo );
-      m_kernelFlops[i_group].push_back( l_kinfo.nflops );
+      libxsmm_get_kernel_info( (const void*)l_kernel, &l_kinfo );
 
-      // Initalize stats telemetry
-      MmXsmmStats l_mystats = { 0 , 0 };
-      for ( int i = 0; i < edge::parallel::g_nThreads; ++i ) {
-        m_kernelStats[i][i_group].push_back( l_mystats );
-      }
+      // store kernel
+      MmXsmmDesc l_kDesc = { i_m, i_n, i_k, 0 };
+      l_kDesc.density  = i_ptr[ i_csr ? i_m : i_n ];
+      l_kDesc.density /= i_csr ? double(i_m) * i_k : double(i_k) * i_n;
+      addKernel( i_group, l_kernel, l_kDesc, l_kinfo.nflops );
     }
 
     /**
@@ -387,13 +334,8 @@ class edge::data::MmXsmmFused< double > {
       EDGE_CHECK( i_fusedBC || i_fusedAC );
 
       // add kernel groups, if required
-      if( i_group >= m_kernels.size() ) {
+      if( i_group >= m_descs.size() ) {
         m_descs.resize( i_group+1 );
-        m_kernels.resize( i_group+1 );
-        m_kernelFlops.resize( i_group+1 );
-        for ( int i = 0; i < edge::parallel::g_nThreads; ++i ) {
-          m_kernelStats[i].resize( i_group+1 );
-        }
       }
 
       // add description
@@ -410,6 +352,8 @@ class edge::data::MmXsmmFused< double > {
 
       m_descs[i_group].push_back( l_desc );
 
+      // generate function for this kernel
+      libxsmm_dmmfunction l_kernel = nullptr;
       if( i_fusedBC ) {
         // generate fake CSR-structure
         unsigned int *l_rows = nullptr;
@@ -418,29 +362,25 @@ class edge::data::MmXsmmFused< double > {
         linalg::Matrix::fakeCsr( i_m, i_n, i_k,
                                  l_rows, l_cols, l_vals );
   
-        // generate and store function for this kernels
-        m_kernels[i_group].push_back( libxsmm_create_packed_spxgemm_csr( m_descs[i_group].back(), i_nCrs, l_rows, l_cols, l_vals ).dmm );
+        l_kernel = libxsmm_create_packed_spxgemm_csr( m_descs[i_group].back(), i_nCrs, l_rows, l_cols, l_vals ).dmm;
 
         // free memory of fake CSR-structure
         delete[] l_rows; delete[] l_cols; delete[] l_vals;
       }
       else {
-        m_kernels[i_group].push_back( libxsmm_create_packed_xgemm_ac_rm( m_descs[i_group].back(), i_nCrs ).dmm );
+        l_kernel = libxsmm_create_packed_xgemm_ac_rm( m_descs[i_group].back(), i_nCrs ).dmm;
       }
 
       // check that we generated a kernel
-      EDGE_CHECK( m_kernels[i_group].back() != 0 );
+      EDGE_CHECK( l_kernel != 0 );
 
-      // read flops and store them
+      // read flops
       libxsmm_kernel_info l_kinfo;
-      libxsmm_get_kernel_info( (const void*)m_kernels[i_group].back(), &l_kinfo );
-      m_kernelFlops[i_group].push_back( l_kinfo.nflops );
-      
-      // Initalize stats telemetry
-      MmXsmmStats l_mystats = { 0 , 0 };
-      for ( int i = 0; i < edge::parallel::g_nThreads; ++i ) {
-        m_kernelStats[i][i_group].push_back( l_mystats );
-      }
+      libxsmm_get_kernel_info( (const void*)l_kernel, &l_kinfo );
+
+      // store kernel
+      MmXsmmDesc l_kDesc = { i_m, i_n, i_k, 1 };
+      addKernel( i_group, l_kernel, l_kDesc, l_kinfo.nflops );
     }
 };
 #endif
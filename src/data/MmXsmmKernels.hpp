@@ -0,0 +1,219 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Generated LIBXSMM kernels with optional per-kernel performance telemetry.
+ **/
+
+#ifndef EDGE_DATA_MM_XSMM_KERNELS_HPP
+#define EDGE_DATA_MM_XSMM_KERNELS_HPP
+
+#include <vector>
+#include <string>
+#include <cstdio>
+#include "io/logging.h"
+#include "parallel/global.h"
+
+#ifdef PP_MMKERNEL_PERF
+#include <x86intrin.h>
+#include "monitor/Timer.hpp"
+#endif
+
+namespace edge {
+  namespace data {
+    typedef struct MmXsmmStats {
+      size_t invocations;
+      size_t cycles;
+    } MmXsmmStats;
+
+    typedef struct MmXsmmDesc {
+      unsigned int m;
+      unsigned int n;
+      unsigned int k;
+      // ratio of non-zeros in the sparse operand, 1 for dense kernels
+      double density;
+    } MmXsmmDesc;
+
+    template< typename TL_T_FUN >
+    class MmXsmmKernels;
+  }
+}
+
+/**
+ * Generated LIBXSMM kernels, organized in groups.
+ * If compiled with PP_MMKERNEL_PERF, the invocations and cycles of every kernel are recorded per thread.
+ *
+ * @paramt TL_T_FUN function type of the kernels.
+ **/
+template< typename TL_T_FUN >
+class edge::data::MmXsmmKernels {
+  protected:
+    /**
+     * Adds the kernel groups up to the given one, if not present.
+     *
+     * @param i_group id of the kernel group.
+     **/
+    void addGroup( unsigned short i_group ) {
+      if( i_group >= m_kernels.size() ) {
+        m_kernels.resize( i_group+1 );
+        m_kernelFlops.resize( i_group+1 );
+        m_kernelDescs.resize( i_group+1 );
+        for( std::size_t l_td = 0; l_td < m_kernelStats.size(); l_td++ ) {
+          m_kernelStats[l_td].resize( i_group+1 );
+        }
+      }
+    }
+
+    /**
+     * Adds a generated kernel to the given group.
+     *
+     * @param i_group id of the kernel group.
+     * @param i_kernel generated kernel.
+     * @param i_desc description of the kernel.
+     * @param i_flops number of floating point operations per invocation.
+     **/
+    void addKernel( unsigned short     i_group,
+                    TL_T_FUN           i_kernel,
+                    MmXsmmDesc const & i_desc,
+                    size_t             i_flops ) {
+      addGroup( i_group );
+
+      m_kernels[i_group].push_back( i_kernel );
+      m_kernelFlops[i_group].push_back( i_flops );
+      m_kernelDescs[i_group].push_back( i_desc );
+
+      MmXsmmStats l_stats = { 0, 0 };
+      for( std::size_t l_td = 0; l_td < m_kernelStats.size(); l_td++ ) {
+        m_kernelStats[l_td][i_group].push_back( l_stats );
+      }
+    }
+
+#ifdef PP_MMKERNEL_PERF
+    /**
+     * Estimates the frequency of the time stamp counter.
+     *
+     * @return ticks per second.
+     **/
+    static double tscRate() {
+      monitor::Timer l_timer;
+      l_timer.start();
+
+      // busy wait for 1E8 ticks
+      size_t l_ts0 = _rdtsc();
+      size_t l_ts1 = l_ts0;
+      while( l_ts1 - l_ts0 < 100000000 ) l_ts1 = _rdtsc();
+
+      l_timer.end();
+      return ( l_ts1 - l_ts0 ) / l_timer.elapsed();
+    }
+#endif
+
+  public:
+    //! generated kernels of libxsmm
+    std::vector< std::vector< TL_T_FUN > > m_kernels;
+
+    //! number of flops performed by each libxsmm kernel
+    std::vector< std::vector< size_t > > m_kernelFlops;
+
+    //! descriptions of the kernels
+    std::vector< std::vector< MmXsmmDesc > > m_kernelDescs;
+
+    //! per-thread stats of the kernels
+    mutable std::vector< std::vector< std::vector< MmXsmmStats > > > m_kernelStats;
+
+    /**
+     * Constructor.
+     **/
+    MmXsmmKernels() {
+      m_kernelStats.resize( edge::parallel::g_nThreads );
+    }
+
+    /**
+     * Executes a kernel and records its performance, if enabled.
+     *
+     * @param i_group id of the kernel group.
+     * @param i_kernel id of the kernel in the group.
+     * @param i_args arguments of the kernel.
+     *
+     * @paramt TL_T_ARGS types of the kernel's arguments.
+     **/
+    template< typename... TL_T_ARGS >
+    inline void exec( unsigned short i_group,
+                      unsigned short i_kernel,
+                      TL_T_ARGS...   i_args ) const {
+#ifdef PP_MMKERNEL_PERF
+      size_t l_start = _rdtsc();
+#endif
+      m_kernels[i_group][i_kernel]( i_args... );
+#ifdef PP_MMKERNEL_PERF
+      MmXsmmStats & l_stats = m_kernelStats[edge::parallel::g_thread][i_group][i_kernel];
+      l_stats.invocations++;
+      l_stats.cycles += _rdtsc() - l_start;
+#endif
+    }
+
+    /**
+     * Logs the recorded stats of the kernels, aggregated over all threads.
+     * One table is printed per kernel group.
+     *
+     * @param i_name name of the kernels.
+     **/
+    void logStats( std::string const & i_name ) const {
+#ifdef PP_MMKERNEL_PERF
+      double l_tscRate = tscRate();
+
+      EDGE_LOG_INFO << "matrix kernel telemetry of the " << i_name << " (summed over threads, " << l_tscRate * 1E-9 << " GHz time stamp counter):";
+
+      for( std::size_t l_gr = 0; l_gr < m_kernels.size(); l_gr++ ) {
+        if( m_kernels[l_gr].size() == 0 ) continue;
+
+        EDGE_LOG_INFO << "  group #" << l_gr;
+        EDGE_LOG_INFO << "    kernel     m     n     k  density  invocations        cycles  cycles/call  flops/cycle  gflops/core";
+
+        for( std::size_t l_ke = 0; l_ke < m_kernels[l_gr].size(); l_ke++ ) {
+          // aggregate over threads
+          MmXsmmStats l_stats = { 0, 0 };
+          for( std::size_t l_td = 0; l_td < m_kernelStats.size(); l_td++ ) {
+            l_stats.invocations += m_kernelStats[l_td][l_gr][l_ke].invocations;
+            l_stats.cycles      += m_kernelStats[l_td][l_gr][l_ke].cycles;
+          }
+
+          double l_flops = double(m_kernelFlops[l_gr][l_ke]) * l_stats.invocations;
+          double l_cycles = (l_stats.cycles > 0) ? double(l_stats.cycles) : 1.0;
+          double l_calls = (l_stats.invocations > 0) ? double(l_stats.invocations) : 1.0;
+          MmXsmmDesc const & l_desc = m_kernelDescs[l_gr][l_ke];
+
+          char l_row[256];
+          std::snprintf( l_row, 256, "    %6zu%6u%6u%6u%9.3f%13zu%14zu%13.1f%13.2f%13.2f",
+                         l_ke,
+                         l_desc.m, l_desc.n, l_desc.k,
+                         l_desc.density,
+                         l_stats.invocations,
+                         l_stats.cycles,
+                         l_stats.cycles / l_calls,
+                         l_flops / l_cycles,
+                         l_flops / l_cycles * l_tscRate * 1E-9 );
+          EDGE_LOG_INFO << l_row;
+        }
+      }
+#endif
+    }
+};
+
+#endif
@@ -29,6 +29,7 @@
 #include <vector>
 #include "constants.hpp"
 #include "io/logging.h"
+#include "MmXsmmKernels.hpp"
  
 #include <libxsmm.h>
  
@@ -49,15 +50,12 @@ namespace edge {
  * Holds LIBXSMM kernels for non-fused, single precision simulations.
  **/
 template<> 
-class edge::data::MmXsmmSingle< float > {
+class edge::data::MmXsmmSingle< float > : public MmXsmmKernels< libxsmm_smmfunction > {
   private:
     //! gemm descriptors of libxsmm
     std::vector< std::vector< const libxsmm_gemm_descriptor* > > m_descs;
  
   public:
-    //! generated kernels of libxsmm
-    std::vector< std::vector< libxsmm_smmfunction > > m_kernels;
- 
     /**
      * Adds a libxsmm dense GEMM kernel
      * Remark: LIBXSMM is col-major and so is this call,
@@ -91,9 +89,8 @@ class edge::data::MmXsmmSingle< float > {
                    << " alpha=" << i_alpha << " beta=" << i_beta;
  
       // add kernel groups, if required
-      if( i_group >= m_kernels.size() ) {
+      if( i_group >= m_descs.size() ) {
         m_descs.resize( i_group+1 );
-        m_kernels.resize( i_group+1 );
       }
 
       // add description
@@ -105,11 +102,15 @@ class edge::data::MmXsmmSingle< float > {
 
       m_descs[i_group].push_back( l_desc );
        
-      // generate and store function for this kernels
-      m_kernels[i_group].push_back( libxsmm_xmmdispatch( m_descs[i_group].back() ).smm );
- 
+      // generate function for this kernel
+      libxsmm_smmfunction l_kernel = libxsmm_xmmdispatch( m_descs[i_group].back() ).smm;
+
       // check that we generated a kernel
-      EDGE_CHECK_NE( m_kernels[i_group].back(), 0 );
+      EDGE_CHECK_NE( l_kernel, 0 );
+
+      // store kernel, dense flops
+      MmXsmmDesc l_kDesc = { i_m, i_n, i_k, 1 };
+      addKernel( i_group, l_kernel, l_kDesc, size_t(2) * i_m * i_n * i_k );
     }
 };
 
@@ -117,15 +118,12 @@ class edge::data::MmXsmmSingle< float > {
  * Holds LIBXSMM kernels for non-fused, double precision simulations.
  **/
 template<>
-class edge::data::MmXsmmSingle< double > {
+class edge::data::MmXsmmSingle< double > : public MmXsmmKernels< libxsmm_dmmfunction > {
   private:
     //! gemm descriptors of libxsmm
     std::vector< std::vector< const libxsmm_gemm_descriptor* > > m_descs;
   
   public:
-    //! generated kernels of libxsmm
-    std::vector< std::vector< libxsmm_dmmfunction > > m_kernels;
-  
     /**
      * Adds a libxsmm dense GEMM kernel
      * Remark: LIBXSMM is col-major and so is this call,
@@ -159,9 +157,8 @@ class edge::data::MmXsmmSingle< double > {
                    << " alpha=" << i_alpha << " beta=" << i_beta;
 
       // add kernel groups, if required
-      if( i_group >= m_kernels.size() ) {
+      if( i_group >= m_descs.size() ) {
         m_descs.resize( i_group+1 );
-        m_kernels.resize( i_group+1 );
       }
 
       // add description
@@ -173,11 +170,15 @@ class edge::data::MmXsmmSingle< double > {
 
       m_descs[i_group].push_back( l_desc );
         
-      // generate and store function for this kernels
-      m_kernels[i_group].push_back( libxsmm_xmmdispatch( m_descs[i_group].back() ).dmm );
-  
+      // generate function for this kernel
+      libxsmm_dmmfunction l_kernel = libxsmm_xmmdispatch( m_descs[i_group].back() ).dmm;
+
       // check that we generated a kernel
-      EDGE_CHECK_NE( m_kernels[i_group].back(), 0 );
+      EDGE_CHECK_NE( l_kernel, 0 );
+
+      // store kernel, dense flops
+      MmXsmmDesc l_kDesc = { i_m, i_n, i_k, 1 };
+      addKernel( i_group, l_kernel, l_kDesc, size_t(2) * i_m * i_n * i_k );
     }
 };
 #endif
@@ -0,0 +1,208 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Benchmark of the point location in the sparse entities.
+ **/
+#include "monitor/Bench.hpp"
+#include "SparseEntities.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace edge {
+  namespace data {
+    namespace bench {
+      //! vertex characteristics of the benchmark
+      typedef struct {
+        double coords[3];
+      } t_charsVe;
+
+      /**
+       * Generates a structured tetrahedral mesh of the unit cube, every cube of the grid is split into six tets.
+       *
+       * @param i_nCubes number of cubes per dimension.
+       * @param o_charsVe will be set to the vertex characteristics.
+       * @param o_elVe will be set to the vertices of the tets.
+       **/
+      void mesh( std::size_t                   i_nCubes,
+                 std::vector< t_charsVe >    & o_charsVe,
+                 std::vector< std::size_t >  & o_elVe );
+
+      /**
+       * Brute-force point location, which checks every point against every element.
+       *
+       * @param i_nPts number of points.
+       * @param i_ptCrds coordinates of the points.
+       * @param i_nEls number of elements.
+       * @param i_elVe vertices of the elements.
+       * @param i_charsVe vertex characteristics.
+       * @param o_de will be set to the closest elements.
+       **/
+      void bruteForce( std::size_t                i_nPts,
+                       double             const (*i_ptCrds)[3],
+                       std::size_t                i_nEls,
+                       std::size_t        const  *i_elVe,
+                       t_charsVe          const  *i_charsVe,
+                       std::size_t               *o_de );
+
+      /**
+       * Measures the setup time of the point location for increasing numbers of points and elements.
+       *
+       * @param io_recs records of the results will be appended.
+       **/
+      void ptToEn( std::vector< monitor::Bench::Record > & io_recs );
+    }
+  }
+}
+
+void edge::data::bench::mesh( std::size_t                   i_nCubes,
+                              std::vector< t_charsVe >    & o_charsVe,
+                              std::vector< std::size_t >  & o_elVe ) {
+  std::size_t l_nVes = i_nCubes+1;
+  double l_h = 1.0 / i_nCubes;
+
+  o_charsVe.resize( l_nVes*l_nVes*l_nVes );
+  for( std::size_t l_z = 0; l_z < l_nVes; l_z++ )
+    for( std::size_t l_y = 0; l_y < l_nVes; l_y++ )
+      for( std::size_t l_x = 0; l_x < l_nVes; l_x++ ) {
+        std::size_t l_ve = (l_z*l_nVes + l_y)*l_nVes + l_x;
+        o_charsVe[l_ve].coords[0] = l_x*l_h;
+        o_charsVe[l_ve].coords[1] = l_y*l_h;
+        o_charsVe[l_ve].coords[2] = l_z*l_h;
+      }
+
+  // Kuhn-triangulation: paths from corner 0 to corner 7 along the permuted axes
+  unsigned short const l_perms[6][3] = { {0,1,2}, {0,2,1}, {1,0,2}, {1,2,0}, {2,0,1}, {2,1,0} };
+
+  o_elVe.clear();
+  o_elVe.reserve( i_nCubes*i_nCubes*i_nCubes*6*4 );
+  for( std::size_t l_z = 0; l_z < i_nCubes; l_z++ )
+    for( std::size_t l_y = 0; l_y < i_nCubes; l_y++ )
+      for( std::size_t l_x = 0; l_x < i_nCubes; l_x++ )
+        for( unsigned short l_pe = 0; l_pe < 6; l_pe++ ) {
+          std::size_t l_crd[3] = { l_x, l_y, l_z };
+          std::size_t l_ves[4];
+          for( unsigned short l_ve = 0; l_ve < 4; l_ve++ ) {
+            if( l_ve > 0 ) l_crd[ l_perms[l_pe][l_ve-1] ]++;
+            l_ves[l_ve] = (l_crd[2]*l_nVes + l_crd[1])*l_nVes + l_crd[0];
+          }
+
+          // odd permutations of the axes invert the orientation
+          if( l_pe == 1 || l_pe == 2 || l_pe == 5 ) std::swap( l_ves[2], l_ves[3] );
+          o_elVe.insert( o_elVe.end(), l_ves, l_ves+4 );
+        }
+}
+
+void edge::data::bench::bruteForce( std::size_t                i_nPts,
+                                    double             const (*i_ptCrds)[3],
+                                    std::size_t                i_nEls,
+                                    std::size_t        const  *i_elVe,
+                                    t_charsVe          const  *i_charsVe,
+                                    std::size_t               *o_de ) {
+#ifdef PP_USE_OMP
+#pragma omp parallel for
+#endif
+  for( std::size_t l_pt = 0; l_pt < i_nPts; l_pt++ ) {
+    double l_minDist = std::numeric_limits< double >::max();
+    o_de[l_pt] = std::numeric_limits< std::size_t >::max();
+
+    for( std::size_t l_el = 0; l_el < i_nEls; l_el++ ) {
+      double l_ves[3*4];
+      for( unsigned short l_ve = 0; l_ve < 4; l_ve++ )
+        for( unsigned short l_di = 0; l_di < 3; l_di++ )
+          l_ves[l_di*4 + l_ve] = i_charsVe[ i_elVe[l_el*4 + l_ve] ].coords[l_di];
+
+      double l_crds[3] = { i_ptCrds[l_pt][0], i_ptCrds[l_pt][1], i_ptCrds[l_pt][2] };
+      linalg::Geom::closestPoint( TET4, l_ves, l_crds );
+      double l_dist = linalg::GeomT< 3 >::norm( l_crds, i_ptCrds[l_pt] );
+
+      if( l_dist < l_minDist ) {
+        l_minDist = l_dist;
+        o_de[l_pt] = l_el;
+      }
+    }
+  }
+}
+
+void edge::data::bench::ptToEn( std::vector< monitor::Bench::Record > & io_recs ) {
+  std::size_t l_nCubes[3] = { 8, 16, 32 };
+  std::size_t l_nPts[3] = { 1000, 10000, 100000 };
+
+  for( unsigned short l_me = 0; l_me < 3; l_me++ ) {
+    std::vector< t_charsVe > l_charsVe;
+    std::vector< std::size_t > l_elVe;
+    mesh( l_nCubes[l_me], l_charsVe, l_elVe );
+    std::size_t l_nEls = l_elVe.size() / 4;
+
+    for( unsigned short l_np = 0; l_np < 3; l_np++ ) {
+      // random points, 10% outside of the mesh
+      std::srand( 1234 );
+      std::vector< double > l_ptCrds( l_nPts[l_np]*3 );
+      for( std::size_t l_va = 0; l_va < l_ptCrds.size(); l_va++ ) {
+        l_ptCrds[l_va] = -0.035 + 1.07 * std::rand() / RAND_MAX;
+      }
+      double const (*l_pts)[3] = (double const (*)[3]) &l_ptCrds[0];
+
+      std::vector< std::size_t > l_de( l_nPts[l_np] );
+
+      std::chrono::steady_clock::time_point l_start = std::chrono::steady_clock::now();
+      std::size_t l_nOwn = SparseEntities::ptToEn( TET4,
+                                                   l_nPts[l_np],
+                                                   l_pts,
+                                                   l_nEls,
+                                                   &l_elVe[0],
+                                                   &l_charsVe[0],
+                                                   &l_de[0] );
+      std::chrono::duration< double > l_dur = std::chrono::steady_clock::now() - l_start;
+
+      monitor::Bench::Record l_rec;
+      l_rec.add( "n_elements", (double) l_nEls )
+           .add( "n_points", (double) l_nPts[l_np] )
+           .add( "n_owned", (double) l_nOwn )
+           .add( "time_bvh", l_dur.count() );
+
+      // brute force reference for the small configurations
+      if( l_nEls * l_nPts[l_np] <= 4000000 ) {
+        std::vector< std::size_t > l_deRef( l_nPts[l_np] );
+
+        l_start = std::chrono::steady_clock::now();
+        bruteForce( l_nPts[l_np],
+                    l_pts,
+                    l_nEls,
+                    &l_elVe[0],
+                    &l_charsVe[0],
+                    &l_deRef[0] );
+        l_dur = std::chrono::steady_clock::now() - l_start;
+
+        std::size_t l_nDiff = 0;
+        for( std::size_t l_pt = 0; l_pt < l_nPts[l_np]; l_pt++ ) l_nDiff += ( l_de[l_pt] != l_deRef[l_pt] );
+
+        l_rec.add( "time_brute_force", l_dur.count() )
+             .add( "n_mismatches", (double) l_nDiff );
+      }
+
+      io_recs.push_back( l_rec );
+    }
+  }
+}
+
+EDGE_BENCH( "data/sparse_entities/pt_to_en", edge::data::bench::ptToEn )
@@ -29,6 +29,7 @@
 #include <limits>
 #include "io/logging.h"
 #include "linalg/Geom.hpp"
+#include "linalg/Bvh.hpp"
 
 #include "EntityLayout.h"
 namespace edge {
@@ -850,6 +851,7 @@ class edge::data::SparseEntities {
      *        If an input point is outside the given entities, the closest-by entity is returned.
      *        If the respective entity resides outside the current partition, std::numeric_limits< TL_T_LID >::max() is returned.
      *        If an entity is part of the send-region and possibly duplicated, only the first entity is returned.
+     *        The entities are located through a bounding volume hierarchy.
      *
      * @param i_enType considered entity type.
      * @param i_nPts number of points.
@@ -892,39 +894,65 @@ class edge::data::SparseEntities {
         l_minDist[l_pt] = std::numeric_limits< TL_T_REAL >::max();
       }
 
+      // lambda, which buffers the vertex coordinates of an entity
+      auto l_enVeCrds = [&]( TL_T_LID i_en, TL_T_REAL o_veCrds[3*8] ) {
+        for( unsigned short l_ve = 0; l_ve < l_nVe; l_ve++ ) {
+          TL_T_LID l_veId = i_enVe[i_en*l_nVe+l_ve];
+
+          for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+            o_veCrds[l_di*l_nVe + l_ve] = i_charsVe[l_veId].coords[l_di];
+          }
+        }
+      };
+      EDGE_CHECK_LE( l_nVe, 8 );
+
+      // build bounding volume hierarchy of the entities
+      linalg::Bvh< TL_T_REAL > l_bvh;
+      l_bvh.build( C_ENT[i_enType].N_DIM,
+                   i_nEns,
+                   [&]( std::size_t i_en, TL_T_REAL o_bb[2][3] ) {
+                     TL_T_REAL l_tmpVe[ 3*8 ];
+                     l_enVeCrds( i_en, l_tmpVe );
+
+                     for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+                       o_bb[0][l_di] = o_bb[1][l_di] = l_tmpVe[l_di*l_nVe];
+                       for( unsigned short l_ve = 1; l_ve < l_nVe; l_ve++ ) {
+                         o_bb[0][l_di] = std::min( o_bb[0][l_di], l_tmpVe[l_di*l_nVe + l_ve] );
+                         o_bb[1][l_di] = std::max( o_bb[1][l_di], l_tmpVe[l_di*l_nVe + l_ve] );
+                       }
+                     }
+                   } );
+
       // iterate over the given points
 #ifdef PP_USE_OMP
-#pragma omp parallel for
+#pragma omp parallel for schedule(dynamic,64)
 #endif
       for( TL_T_LID l_pt = 0; l_pt < i_nPts; l_pt++ ) {
-        for( TL_T_LID l_en = 0; l_en < i_nEns; l_en++ ) {
-          // buffer entity ves
-          EDGE_CHECK_LE( l_nVe, 8 );
-          TL_T_REAL l_tmpVe[ 3*8 ];
-          for( unsigned short l_ve = 0; l_ve < l_nVe; l_ve++ ) {
-            TL_T_LID l_veId = i_enVe[l_en*l_nVe+l_ve];
-
-            for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
-              l_tmpVe[l_di*l_nVe + l_ve] = i_charsVe[l_veId].coords[l_di];
-            }
-          }
-
-          // compute distance (projected if not inside)
-          TL_T_REAL l_tmpCrds[3];
-          for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
-            l_tmpCrds[l_di] = i_ptCrds[l_pt][l_di];
-          }
-          edge::linalg::Geom::closestPoint( i_enType,
-                                            l_tmpVe,
-                                            l_tmpCrds );
-          TL_T_REAL l_dist = edge::linalg::GeomT< 3 >::norm( l_tmpCrds,
-                                                              i_ptCrds[l_pt] );
-
-          // save if this is a new minimum
-          if( l_dist < l_minDist[l_pt] ) {
-            o_de[l_pt] = l_en;
-            l_minDist[l_pt] = l_dist;
-          }
+        TL_T_REAL l_ptCrds[3];
+        for( unsigned short l_di = 0; l_di < 3; l_di++ ) l_ptCrds[l_di] = i_ptCrds[l_pt][l_di];
+
+        TL_T_REAL l_dist;
+        std::size_t l_en = l_bvh.nearest( l_ptCrds,
+                                          [&]( std::size_t i_en ) {
+                                            // compute distance (projected if not inside)
+                                            TL_T_REAL l_tmpVe[ 3*8 ];
+                                            l_enVeCrds( i_en, l_tmpVe );
+
+                                            TL_T_REAL l_tmpCrds[3];
+                                            for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+                                              l_tmpCrds[l_di] = l_ptCrds[l_di];
+                                            }
+                                            edge::linalg::Geom::closestPoint( i_enType,
+                                                                              l_tmpVe,
+                                                                              l_tmpCrds );
+                                            return edge::linalg::GeomT< 3 >::norm( l_tmpCrds,
+                                                                                    l_ptCrds );
+                                          },
+                                          l_dist );
+
+        if( l_en != std::numeric_limits< std::size_t >::max() ) {
+          o_de[l_pt] = l_en;
+          l_minDist[l_pt] = l_dist;
         }
       }
 
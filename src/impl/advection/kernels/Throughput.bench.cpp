@@ -0,0 +1,195 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Throughput benchmark of the advection kernels (time prediction, volume, local and neighboring surface integration).
+ **/
+#include "monitor/Bench.hpp"
+#include "data/Dynamic.h"
+#include "TimePred.hpp"
+#include "VolInt.hpp"
+#include "SurfInt.hpp"
+#include <cstdlib>
+#include <string>
+
+namespace edge {
+  namespace advection {
+    namespace kernels {
+      namespace bench {
+        //! number of dimensions
+        static unsigned short const N_DIS = N_DIM;
+
+        //! number of faces
+        static unsigned short const N_FAS = C_ENT[T_SDISC.ELEMENT].N_FACES;
+
+        //! number of element modes
+        static unsigned short const N_MDS_EL = N_ELEMENT_MODES;
+
+        //! number of face modes
+        static unsigned short const N_MDS_FA = N_FACE_MODES;
+
+        /**
+         * Gets the nominal number of floating point operations of a kernel per element.
+         *
+         * @param i_kernel kernel: ck, apply, local or neigh.
+         * @return number of floating point operations.
+         **/
+        double nFlops( std::string const & i_kernel );
+
+        /**
+         * Gets the compulsory memory traffic of a kernel per element, i.e., every element-local input is read once and every output is written once.
+         *
+         * @param i_kernel kernel: ck, apply, local or neigh.
+         * @return number of bytes.
+         **/
+        double nBytes( std::string const & i_kernel );
+
+        /**
+         * Measures the throughput of the individual kernels for a large number of elements.
+         *
+         * @param io_recs records of the results will be appended.
+         **/
+        void throughput( std::vector< monitor::Bench::Record > & io_recs );
+      }
+    }
+  }
+}
+
+double edge::advection::kernels::bench::nFlops( std::string const & i_kernel ) {
+  double l_flops = 0;
+
+  // stiffness matrices and scalar star matrices
+  if( i_kernel == "ck" ) l_flops = (ORDER-1) * ( N_DIS * 2.0 * N_MDS_EL * ( N_MDS_EL + 1 ) + 2.0 * N_MDS_EL );
+  else if( i_kernel == "apply" ) l_flops = N_DIS * 2.0 * N_MDS_EL * ( N_MDS_EL + 1 );
+  // two flux matrices and the scalar flux solver
+  else if( i_kernel == "local" || i_kernel == "neigh" ) l_flops = N_FAS * 2.0 * N_MDS_FA * ( 2.0 * N_MDS_EL + 0.5 );
+
+  return l_flops * N_CRUNS;
+}
+
+double edge::advection::kernels::bench::nBytes( std::string const & i_kernel ) {
+  double l_dofs = double(N_MDS_EL) * N_CRUNS * sizeof(real_base);
+
+  // read DOFs and star matrices, write tDOFs
+  if( i_kernel == "ck" )    return 2 * l_dofs + N_DIS * sizeof(real_base);
+  // read tDOFs and star matrices, update DOFs
+  if( i_kernel == "apply" ) return 3 * l_dofs + N_DIS * sizeof(real_base);
+  // read tDOFs and flux solvers, update DOFs
+  if( i_kernel == "local" ) return 3 * l_dofs + N_FAS * sizeof(real_base);
+  // read tDOFs of the face-neighbors and flux solvers, update DOFs
+  if( i_kernel == "neigh" ) return ( N_FAS + 2 ) * l_dofs + N_FAS * sizeof(real_base);
+
+  return 0;
+}
+
+void edge::advection::kernels::bench::throughput( std::vector< monitor::Bench::Record > & io_recs ) {
+  std::size_t l_nDofs = std::size_t(N_MDS_EL) * N_CRUNS;
+
+  // element arrays of ~256MiB, such that the data is streamed from memory
+  std::size_t l_nEls = ( std::size_t(256) << 20 ) / ( 2 * l_nDofs * sizeof(real_base) );
+
+  data::Dynamic l_dynMem;
+
+  TimePred< real_base, T_SDISC.ELEMENT, ORDER, ORDER, N_CRUNS > l_time( l_dynMem );
+  VolInt< real_base, T_SDISC.ELEMENT, ORDER, N_CRUNS > l_volInt( l_dynMem );
+  SurfInt< real_base, T_SDISC.ELEMENT, ORDER, N_CRUNS > l_surfInt( l_dynMem );
+
+  // element data
+  typedef real_base t_dofs[1][N_MDS_EL][N_CRUNS];
+
+  t_dofs *l_dofs  = (t_dofs*) l_dynMem.allocate( l_nEls * l_nDofs * sizeof(real_base) );
+  t_dofs *l_tDofs = (t_dofs*) l_dynMem.allocate( l_nEls * l_nDofs * sizeof(real_base) );
+  real_base (*l_star)[N_DIS] = (real_base (*)[N_DIS]) l_dynMem.allocate( l_nEls * N_DIS * sizeof(real_base) );
+  real_base (*l_fs)[N_FAS*2] = (real_base (*)[N_FAS*2]) l_dynMem.allocate( l_nEls * N_FAS * 2 * sizeof(real_base) );
+
+  // random values, small for the matrices to keep the DOFs bounded
+  std::srand( 1234 );
+  for( std::size_t l_va = 0; l_va < l_nEls * l_nDofs; l_va++ ) {
+    l_dofs[0][0][0][l_va] = real_base(1) * std::rand() / RAND_MAX;
+    l_tDofs[0][0][0][l_va] = real_base(1) * std::rand() / RAND_MAX;
+  }
+  for( std::size_t l_va = 0; l_va < l_nEls * N_DIS; l_va++ ) l_star[0][l_va] = real_base(1E-6) * std::rand() / RAND_MAX;
+  for( std::size_t l_va = 0; l_va < l_nEls * N_FAS * 2; l_va++ ) l_fs[0][l_va] = real_base(1E-6) * std::rand() / RAND_MAX;
+
+  // scratch memory
+  real_base l_der[ORDER][N_MDS_EL][N_CRUNS];
+
+  // neighbors of the elements, spread over the arrays
+  std::size_t l_strides[6] = { 1, l_nEls-1, 97, l_nEls-97, 9973, l_nEls-9973 };
+
+  real_base l_dt = real_base(1E-4);
+  std::string l_kernelNames[4] = { "ck", "apply", "local", "neigh" };
+
+  for( unsigned short l_ke = 0; l_ke < 4; l_ke++ ) {
+    std::string const & l_name = l_kernelNames[l_ke];
+
+    std::size_t l_nReps = 0;
+    double l_tm = monitor::Bench::time( [&]() {
+      for( std::size_t l_el = 0; l_el < l_nEls; l_el++ ) {
+        if( l_ke == 0 ) {
+          l_time.ck( l_dt,
+                     l_star[l_el],
+                     l_dofs[l_el][0],
+                     l_der,
+                     l_tDofs[l_el][0] );
+        }
+        else if( l_ke == 1 ) {
+          l_volInt.apply( l_star[l_el],
+                          l_tDofs[l_el],
+                          l_dofs[l_el] );
+        }
+        else if( l_ke == 2 ) {
+          l_surfInt.local( l_fs[l_el],
+                           l_tDofs[l_el],
+                           l_dofs[l_el] );
+        }
+        else {
+          for( unsigned short l_fa = 0; l_fa < N_FAS; l_fa++ ) {
+            std::size_t l_ne = ( l_el + l_strides[l_fa % 6] ) % l_nEls;
+
+            l_surfInt.neigh( l_fa,
+                             0,
+                             l_fa,
+                             l_fs[l_el][N_FAS+l_fa],
+                             l_tDofs[l_ne],
+                             l_dofs[l_el] );
+          }
+        }
+      }
+    }, 1.0, l_nReps );
+
+    monitor::Bench::Record l_rec;
+    l_rec.add( "kernel", l_name )
+         .add( "n_elements", (double) l_nEls )
+         .add( "n_reps", (double) l_nReps )
+         .add( "time_per_element", l_tm / l_nEls )
+         .add( "flops_per_element", nFlops( l_name ) )
+         .add( "bytes_per_element", nBytes( l_name ) )
+         .add( "gflops", nFlops( l_name ) * l_nEls * 1E-9 / l_tm )
+         .add( "bandwidth_gbs", nBytes( l_name ) * l_nEls * 1E-9 / l_tm );
+    io_recs.push_back( l_rec );
+  }
+
+  // prevent the compiler from removing the kernels
+  real_base l_chk = 0;
+  for( std::size_t l_el = 0; l_el < l_nEls; l_el++ ) l_chk += l_dofs[l_el][0][0][0];
+  if( l_chk != l_chk ) io_recs.back().add( "nan", 1.0 );
+}
+
+EDGE_BENCH( "advection/kernels/throughput", edge::advection::kernels::bench::throughput )
@@ -38,6 +38,11 @@ void edge::seismic::io::Config::print() {
     EDGE_LOG_INFO << "      frequency_ratio: " << m_attFreqs[1];
   }
 
+  // print matrix deduplication
+  if( m_dedupMats ) {
+    EDGE_LOG_INFO << "    deduplication of star matrices and flux solvers is enabled";
+  }
+
   // print info about the velocity model
   if( m_velDoms.size() > 0 ) {
     EDGE_LOG_INFO << "    found " << m_velDoms.size() << " velmodel-domains in the config: ";
@@ -133,6 +138,11 @@ edge::seismic::io::Config::Config( const pugi::xml_document &i_xml ) {
   EDGE_CHECK(    (m_attFreqs[0] > 0)
               && (m_attFreqs[1] > 0) ) << "found non-positive attenuation frequencies";
 
+  /*
+   * read deduplication of the ADER-DG matrices
+   */
+  m_dedupMats = l_setups.child("dedup_matrices").text().as_bool( false );
+
   /*
    * read velocity model, if available
    */
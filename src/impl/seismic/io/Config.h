@@ -58,6 +58,9 @@ class edge::seismic::io::Config {
     // attenuation: central frequency and frequency ratio
     double m_attFreqs[2];
 
+    //! if true, bitwise-identical star matrices and flux solvers are stored only once
+    bool m_dedupMats = false;
+
     //! friction law
     std::string m_frictionLaw = "";
 
@@ -0,0 +1,220 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Benchmark of the per-element and batched execution of the elastic seismic kernels in the local step.
+ **/
+#include "monitor/Bench.hpp"
+#include "Kernels.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+namespace edge {
+  namespace seismic {
+    namespace kernels {
+      namespace bench {
+        //! number of faces
+        static unsigned short const N_FAS = C_ENT[T_SDISC.ELEMENT].N_FACES;
+
+        //! number of entries in the dense elastic star matrices
+        static unsigned short const N_ENS_STAR = CE_N_ENS_STAR_E_DE( N_DIM );
+
+        //! number of entries in the elastic flux solvers
+        static unsigned short const N_ENS_FS = CE_N_ENS_FS_E_DE( N_DIM );
+
+        //! elastic kernels of the configuration
+        typedef Kernels< real_base,
+                         0,
+                         T_SDISC.ELEMENT,
+                         ORDER,
+                         ORDER,
+                         N_CRUNS > t_kernels;
+
+        /**
+         * Gets the nominal number of floating point operations per element of the local step (time prediction, volume and local surface integration).
+         * Only the dense matrix-matrix multiplications are considered.
+         *
+         * @return number of floating point operations.
+         **/
+        double flops();
+
+        /**
+         * Measures the local step for per-element and batched execution of the kernels.
+         *
+         * @param io_recs records of the results will be appended.
+         **/
+        void local( std::vector< monitor::Bench::Record > & io_recs );
+      }
+    }
+  }
+}
+
+double edge::seismic::kernels::bench::flops() {
+  double l_flops = 0;
+
+  // time prediction: transposed stiffness and star matrices
+  for( unsigned short l_de = 1; l_de < ORDER; l_de++ ) {
+    double l_nCk0 = CE_N_ELEMENT_MODES_CK( T_SDISC.ELEMENT, ORDER, l_de-1 );
+    double l_nCk1 = CE_N_ELEMENT_MODES_CK( T_SDISC.ELEMENT, ORDER, l_de );
+
+    l_flops += N_DIM * 2.0 * N_QUANTITIES * l_nCk1 * ( l_nCk0 + N_QUANTITIES );
+  }
+
+  // volume integration: stiffness and star matrices
+  double l_nCk1 = CE_N_ELEMENT_MODES_CK( T_SDISC.ELEMENT, ORDER, 1 );
+  l_flops += N_DIM * 2.0 * N_QUANTITIES * N_ELEMENT_MODES * ( l_nCk1 + N_QUANTITIES );
+
+  // local surface integration: two flux matrices and the flux solver
+  l_flops += N_FAS * 2.0 * N_QUANTITIES * N_FACE_MODES * ( 2.0 * N_ELEMENT_MODES + N_QUANTITIES );
+
+  return l_flops * N_CRUNS;
+}
+
+void edge::seismic::kernels::bench::local( std::vector< monitor::Bench::Record > & io_recs ) {
+  std::size_t const l_nBat = N_BATCH_ELEMENTS;
+  std::size_t l_nEls[3] = { 64*l_nBat, 512*l_nBat, 4096*l_nBat };
+  std::size_t l_nDofs = std::size_t(N_QUANTITIES) * N_ELEMENT_MODES * N_CRUNS;
+
+  data::Dynamic l_dynMem;
+  t_kernels l_kernels( nullptr, l_dynMem );
+
+  // scratch memory
+  real_base (*l_tmp)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS] = (real_base (*)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS]) l_dynMem.allocate( l_nBat * l_nDofs * sizeof(real_base) );
+  real_base (*l_der)[N_BATCH_ELEMENTS][N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS] = (real_base (*)[N_BATCH_ELEMENTS][N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS]) l_dynMem.allocate( ORDER * l_nBat * l_nDofs * sizeof(real_base) );
+  real_base (*l_tmpFa)[N_BATCH_ELEMENTS][N_QUANTITIES][N_FACE_MODES][N_CRUNS] = (real_base (*)[N_BATCH_ELEMENTS][N_QUANTITIES][N_FACE_MODES][N_CRUNS]) l_dynMem.allocate( 2 * l_nBat * std::size_t(N_QUANTITIES) * N_FACE_MODES * N_CRUNS * sizeof(real_base) );
+  real_base (*l_derEl)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS] = (real_base (*)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS]) l_dynMem.allocate( ORDER * l_nDofs * sizeof(real_base) );
+
+  for( unsigned short l_ne = 0; l_ne < 3; l_ne++ ) {
+    std::size_t l_nElsNe = l_nEls[l_ne];
+
+    // random element-local matrices and DOFs
+    std::srand( 1234 );
+    std::vector< real_base > l_starRaw( l_nElsNe * N_DIM * N_ENS_STAR );
+    std::vector< real_base > l_fsRaw( l_nElsNe * N_FAS * N_ENS_FS );
+    std::vector< real_base > l_dofsRaw( l_nElsNe * l_nDofs );
+    for( std::size_t l_va = 0; l_va < l_starRaw.size(); l_va++ ) l_starRaw[l_va] = real_base(1E-3) * std::rand() / RAND_MAX;
+    for( std::size_t l_va = 0; l_va < l_fsRaw.size(); l_va++ ) l_fsRaw[l_va] = real_base(1E-3) * std::rand() / RAND_MAX;
+    for( std::size_t l_va = 0; l_va < l_dofsRaw.size(); l_va++ ) l_dofsRaw[l_va] = real_base(1) * std::rand() / RAND_MAX;
+
+    real_base (*l_star)[N_DIM][N_ENS_STAR] = (real_base (*)[N_DIM][N_ENS_STAR]) &l_starRaw[0];
+    real_base (*l_fs)[N_FAS][N_ENS_FS] = (real_base (*)[N_FAS][N_ENS_FS]) &l_fsRaw[0];
+
+    // DOFs and time integrated DOFs of both variants
+    std::vector< real_base > l_dofsEl( l_dofsRaw );
+    std::vector< real_base > l_dofsBa( l_dofsRaw );
+    std::vector< real_base > l_tDofsEl( l_dofsRaw.size() );
+    std::vector< real_base > l_tDofsBa( l_dofsRaw.size() );
+
+    real_base (*l_dEl)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS] = (real_base (*)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS]) &l_dofsEl[0];
+    real_base (*l_dBa)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS] = (real_base (*)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS]) &l_dofsBa[0];
+    real_base (*l_tEl)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS] = (real_base (*)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS]) &l_tDofsEl[0];
+    real_base (*l_tBa)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS] = (real_base (*)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS]) &l_tDofsBa[0];
+
+    // repetitions, such that every configuration performs at least ~1 GFLOP
+    std::size_t l_nReps = std::max( std::size_t(1),
+                                    std::size_t( 1E9 / ( flops() * l_nElsNe ) ) );
+    real_base l_dt = real_base(1E-4);
+
+    // per-element execution
+    std::chrono::steady_clock::time_point l_start = std::chrono::steady_clock::now();
+    for( std::size_t l_re = 0; l_re < l_nReps; l_re++ ) {
+      for( std::size_t l_el = 0; l_el < l_nElsNe; l_el++ ) {
+        l_kernels.m_time.ck( l_dt,
+                             l_star[l_el],
+                             nullptr,
+                             nullptr,
+                             l_dEl[l_el],
+                             nullptr,
+                             l_tmp[0],
+                             l_derEl,
+                             nullptr,
+                             l_tEl[l_el],
+                             nullptr );
+
+        l_kernels.m_volInt.apply( l_star[l_el],
+                                  nullptr,
+                                  nullptr,
+                                  l_tEl[l_el],
+                                  nullptr,
+                                  l_dEl[l_el],
+                                  nullptr,
+                                  l_tmp[0] );
+
+        l_kernels.m_surfInt.local( l_fs[l_el],
+                                   nullptr,
+                                   l_tEl[l_el],
+                                   l_dEl[l_el],
+                                   nullptr,
+                                   l_tmpFa[0],
+                                   l_dEl[l_el],
+                                   l_tEl[l_el] );
+      }
+    }
+    std::chrono::duration< double > l_durEl = std::chrono::steady_clock::now() - l_start;
+
+    // batched execution
+    l_start = std::chrono::steady_clock::now();
+    for( std::size_t l_re = 0; l_re < l_nReps; l_re++ ) {
+      for( std::size_t l_el = 0; l_el < l_nElsNe; l_el += l_nBat ) {
+        l_kernels.m_time.ckBatch( l_dt,
+                                  l_star+l_el,
+                                  l_dBa+l_el,
+                                  l_tmp,
+                                  l_der,
+                                  l_tBa+l_el );
+
+        l_kernels.m_volInt.applyBatch( l_star+l_el,
+                                       l_tBa+l_el,
+                                       l_dBa+l_el,
+                                       l_tmp );
+
+        l_kernels.m_surfInt.localBatch( l_fs+l_el,
+                                        l_tBa+l_el,
+                                        l_dBa+l_el,
+                                        l_tmpFa );
+      }
+    }
+    std::chrono::duration< double > l_durBa = std::chrono::steady_clock::now() - l_start;
+
+    // maximum relative difference of the two variants
+    double l_maxDiff = 0;
+    for( std::size_t l_va = 0; l_va < l_dofsEl.size(); l_va++ ) {
+      double l_diff = std::abs( l_dofsEl[l_va] - l_dofsBa[l_va] ) / std::max( std::abs( double(l_dofsEl[l_va]) ), 1.0 );
+      l_maxDiff = std::max( l_maxDiff, l_diff );
+    }
+
+    double l_gflop = flops() * l_nElsNe * l_nReps * 1E-9;
+
+    monitor::Bench::Record l_rec;
+    l_rec.add( "n_elements", (double) l_nElsNe )
+         .add( "n_batch", (double) l_nBat )
+         .add( "n_reps", (double) l_nReps )
+         .add( "time_element", l_durEl.count() )
+         .add( "time_batched", l_durBa.count() )
+         .add( "gflops_element", l_gflop / l_durEl.count() )
+         .add( "gflops_batched", l_gflop / l_durBa.count() )
+         .add( "max_rel_diff", l_maxDiff );
+    io_recs.push_back( l_rec );
+  }
+}
+
+EDGE_BENCH( "seismic/kernels/local", edge::seismic::kernels::bench::local )
@@ -27,7 +27,7 @@
 #include "constants.hpp"
 #include "data/Dynamic.h"
 
-#if defined(PP_T_KERNELS_VANILLA)
+#if defined(PP_T_KERNELS_VANILLA) || defined(PP_T_KERNELS_SIMD)
 #include "TimePredVanilla.hpp"
 #include "VolIntVanilla.hpp"
 #include "SurfIntVanilla.hpp"
@@ -76,7 +76,7 @@ template< typename       TL_T_REAL,
           unsigned short TL_N_CRS >
 class edge::seismic::kernels::Kernels {
   public:
-#if defined(PP_T_KERNELS_VANILLA)
+#if defined(PP_T_KERNELS_VANILLA) || defined(PP_T_KERNELS_SIMD)
     TimePredVanilla< TL_T_REAL,
                      TL_N_RMS,
                      TL_T_EL,
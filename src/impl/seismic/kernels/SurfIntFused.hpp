@@ -32,10 +32,6 @@
 #include "data/MmXsmmFused.hpp"
 #include "FakeMats.hpp"
 
-#ifdef PP_MMKERNEL_PERF
-#include "parallel/global.h"
-#endif 
-
 namespace edge {
   namespace seismic {
     namespace kernels { 
@@ -393,41 +389,6 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
       }
     }
 
-    inline void execMmKernel( unsigned short         i_group, 
-                              unsigned short         i_kernel,
-                              TL_T_REAL      const * i_a,
-                              TL_T_REAL      const * i_b,
-                              TL_T_REAL            * io_c ) {
-#ifdef PP_MMKERNEL_PERF
-      size_t start = _rdtsc();
-#endif
-      m_mm.m_kernels[i_group][i_kernel]( i_a, i_b, io_c );
-#ifdef PP_MMKERNEL_PERF
-      size_t duration = _rdtsc() - start;
-      m_mm.m_kernelStats[edge::parallel::g_thread][i_group][i_kernel].invocations++;
-      m_mm.m_kernelStats[edge::parallel::g_thread][i_group][i_kernel].cycles += duration; 
-#endif
-    }
-
-    inline void execMmKernelPf( unsigned short         i_group, 
-                                unsigned short         i_kernel,
-                                TL_T_REAL      const * i_a,
-                                TL_T_REAL      const * i_b,
-                                TL_T_REAL            * io_c,
-                                TL_T_REAL      const * i_a_pf,
-                                TL_T_REAL      const * i_b_pf,
-                                TL_T_REAL      const * i_c_pf  ) {
-#ifdef PP_MMKERNEL_PERF
-      size_t start = _rdtsc();
-#endif
-      m_mm.m_kernels[i_group][i_kernel]( i_a, i_b, io_c, i_a_pf, i_b_pf, i_c_pf );
-#ifdef PP_MMKERNEL_PERF
-      size_t duration = _rdtsc() - start;
-      m_mm.m_kernelStats[edge::parallel::g_thread][i_group][i_kernel].invocations++;
-      m_mm.m_kernelStats[edge::parallel::g_thread][i_group][i_kernel].cycles += duration; 
-#endif
-    }
-
   public:
     /**
      * Constructor of the fused surface integration.
@@ -468,6 +429,55 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
                        l_fIntT );
     }
 
+    /**
+     * Logs the telemetry of the matrix kernels, if compiled with PP_MMKERNEL_PERF.
+     **/
+    void logMmStats() const {
+      m_mm.logStats( "surface integration" );
+    }
+
+    /**
+     * Gets the number of floating point operations of the matrix kernels in the local surface integration of an element.
+     *
+     * @return number of floating point operations, summed over the fused simulations.
+     **/
+    std::size_t flopsLocal() const {
+      std::size_t l_flops = 0;
+
+      for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ ) {
+        l_flops += m_mm.m_kernelFlops[0][l_fa];
+        l_flops += m_mm.m_kernelFlops[1][0];
+        l_flops += m_mm.m_kernelFlops[2][l_fa];
+        if( TL_N_RMS > 0 ) l_flops += m_mm.m_kernelFlops[3][0] + m_mm.m_kernelFlops[4][l_fa];
+      }
+
+      return l_flops;
+    }
+
+    /**
+     * Gets the number of floating point operations of the matrix kernels in the neighboring surface integration of an element.
+     * All faces are assumed to have neighbors, the neighboring flux matrices enter through their average.
+     *
+     * @return number of floating point operations, summed over the fused simulations.
+     **/
+    std::size_t flopsNeigh() const {
+      std::size_t l_fluxN = 0;
+      for( unsigned short l_fn = 0; l_fn < TL_N_FMNS; l_fn++ ) {
+        l_fluxN += m_mm.m_kernelFlops[0][TL_N_FAS + l_fn];
+      }
+      l_fluxN /= TL_N_FMNS;
+
+      std::size_t l_flops = 0;
+      for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ ) {
+        l_flops += l_fluxN;
+        l_flops += m_mm.m_kernelFlops[1][0];
+        l_flops += m_mm.m_kernelFlops[2][l_fa];
+        if( TL_N_RMS > 0 ) l_flops += m_mm.m_kernelFlops[3][0] + m_mm.m_kernelFlops[4][l_fa];
+      }
+
+      return l_flops;
+    }
+
     /**
      * Element local contribution for fused seismic simulations.
      *
@@ -504,33 +514,33 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
       // iterate over faces
       for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ ) {
         // local flux matrix
-        execMmKernel( 0, l_fa, i_tDofsE[0][0],
-                               m_fIntLN[l_fa],
-                               o_scratch[0][0][0] );
+        m_mm.exec( 0, l_fa, i_tDofsE[0][0],
+                            m_fIntLN[l_fa],
+                            o_scratch[0][0][0] );
 
         // flux solver
-        execMmKernelPf( 1, 0, i_fsE[l_fa],
-                              o_scratch[0][0][0],
-                              o_scratch[1][0][0],
-                              nullptr,
-                              (l_fa < TL_N_FAS_DIV2) ? i_dofsP[0][0] : i_tDofsP[0][0],
-                              nullptr );
+        m_mm.exec( 1, 0, i_fsE[l_fa],
+                         o_scratch[0][0][0],
+                         o_scratch[1][0][0],
+                         nullptr,
+                         (l_fa < TL_N_FAS_DIV2) ? i_dofsP[0][0] : i_tDofsP[0][0],
+                         nullptr );
 
         // transposed flux matrix
-        execMmKernel( 2, l_fa, o_scratch[1][0][0],
-                               m_fIntT[l_fa],
-                               io_dofsE[0][0] );
+        m_mm.exec( 2, l_fa, o_scratch[1][0][0],
+                            m_fIntT[l_fa],
+                            io_dofsE[0][0] );
 
         if( TL_N_RMS > 0 ) {
           // anelastic flux solver
-          execMmKernel( 3, 0, i_fsA[l_fa],
-                              o_scratch[0][0][0],
-                              o_scratch[1][0][0] );
+          m_mm.exec( 3, 0, i_fsA[l_fa],
+                           o_scratch[0][0][0],
+                           o_scratch[1][0][0] );
 
           // transposed flux matrix
-          execMmKernel( 4, l_fa, o_scratch[1][0][0],
-                                 m_fIntT[l_fa],
-                                 l_upAn[0][0] );
+          m_mm.exec( 4, l_fa, o_scratch[1][0][0],
+                              m_fIntT[l_fa],
+                              l_upAn[0][0] );
         }
       }
 
@@ -564,9 +574,9 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
       }
 
       // local or neighboring flux matrix
-      execMmKernel( 0, l_fMatId, i_tDofsE[0][0],
-                                 m_fIntLN[l_fMatId],
-                                 o_tDofsFiE[0][0] );
+      m_mm.exec( 0, l_fMatId, i_tDofsE[0][0],
+                              m_fIntLN[l_fMatId],
+                              o_tDofsFiE[0][0] );
     }
 
     /**
@@ -610,28 +620,28 @@ class edge::seismic::kernels::SurfIntFused: public edge::seismic::kernels::SurfI
       }
 
       // flux solver
-      execMmKernelPf( 1, 0,                     i_fsE,
-                                                l_tDofsFiE,
-                                                o_scratch[1][0][0],
-                                                nullptr,
-                            (TL_T_REAL const *) i_pre,
-                                                nullptr );
+      m_mm.exec( 1, 0,                     i_fsE,
+                                           l_tDofsFiE,
+                                           o_scratch[1][0][0],
+                                           nullptr,
+                       (TL_T_REAL const *) i_pre,
+                                           nullptr );
 
       // transposed flux matrix
-      execMmKernel( 2, i_fa, o_scratch[1][0][0],
-                             m_fIntT[i_fa],
-                             io_dofsE[0][0] );
+      m_mm.exec( 2, i_fa, o_scratch[1][0][0],
+                          m_fIntT[i_fa],
+                          io_dofsE[0][0] );
 
       if( TL_N_RMS > 0 ) {
         // anelastic flux solver
-        execMmKernel( 3, 0, i_fsA,
-                            l_tDofsFiE,
-                            o_scratch[1][0][0] );
+        m_mm.exec( 3, 0, i_fsA,
+                         l_tDofsFiE,
+                         o_scratch[1][0][0] );
 
         // transposed flux matrix
-        execMmKernel( 4, i_fa, o_scratch[1][0][0],
-                               m_fIntT[i_fa],
-                               io_dofsA[0][0] );
+        m_mm.exec( 4, i_fa, o_scratch[1][0][0],
+                            m_fIntT[i_fa],
+                            io_dofsA[0][0] );
       }
     }
 };
@@ -87,6 +87,9 @@ class edge::seismic::kernels::SurfIntSingle: public edge::seismic::kernels::Surf
     //! number of entries in the anelastic flux solvers
     static unsigned short const TL_N_ENS_FS_A = CE_N_ENS_FS_A_DE( TL_N_DIS );
 
+    //! number of elements in a batch
+    static unsigned short const TL_N_BAT = N_BATCH_ELEMENTS;
+
     //! pointers to the local flux matrices
     TL_T_REAL *m_fIntLN[TL_N_FAS+TL_N_FMNS] = {};
 
@@ -159,6 +162,31 @@ class edge::seismic::kernels::SurfIntSingle: public edge::seismic::kernels::Surf
                 static_cast<real_base>(1.0), // alpha
                 static_cast<real_base>(1.0), // beta
                 LIBXSMM_GEMM_PREFETCH_NONE );
+
+      // flux matrices, applied to a batch of elements
+      if( TL_N_RMS == 0 ) {
+        m_mm.add( 2,                           // group
+                  TL_N_MDS_FA,                 // m
+                  TL_N_BAT * TL_N_QTS_E,       // n
+                  TL_N_MDS_EL,                 // k
+                  TL_N_MDS_FA,                 // ldA
+                  TL_N_MDS_EL,                 // ldB
+                  TL_N_MDS_FA,                 // ldC
+                  static_cast<real_base>(1.0), // alpha
+                  static_cast<real_base>(0.0), // beta
+                  LIBXSMM_GEMM_PREFETCH_NONE );
+
+        m_mm.add( 2,                           // group
+                  TL_N_MDS_EL,                 // m
+                  TL_N_BAT * TL_N_QTS_E,       // n
+                  TL_N_MDS_FA,                 // k
+                  TL_N_MDS_EL,                 // ldA
+                  TL_N_MDS_FA,                 // ldB
+                  TL_N_MDS_EL,                 // ldC
+                  static_cast<real_base>(1.0), // alpha
+                  static_cast<real_base>(1.0), // beta
+                  LIBXSMM_GEMM_PREFETCH_NONE );
+      }
     }
 
   public:
@@ -183,6 +211,13 @@ class edge::seismic::kernels::SurfIntSingle: public edge::seismic::kernels::Surf
       generateKernels();
     }
 
+    /**
+     * Logs the telemetry of the matrix kernels, if compiled with PP_MMKERNEL_PERF.
+     **/
+    void logMmStats() const {
+      m_mm.logStats( "surface integration" );
+    }
+
     /**
      * Element local contribution for single forward simulations.
      *
@@ -217,36 +252,36 @@ class edge::seismic::kernels::SurfIntSingle: public edge::seismic::kernels::Surf
       // iterate over faces
       for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ ) {
         // multiply with first face integration matrix
-        m_mm.m_kernels[0][0]( m_fIntLN[l_fa],
-                              i_tDofsE[0][0],
-                              o_scratch[0][0][0],
-                              nullptr,
-                              i_dofsP[0][0],
-                              nullptr );
+        m_mm.exec( 0, 0, m_fIntLN[l_fa],
+                         i_tDofsE[0][0],
+                         o_scratch[0][0][0],
+                         nullptr,
+                         i_dofsP[0][0],
+                         nullptr );
 
         // multiply with flux solver
-        m_mm.m_kernels[0][1]( o_scratch[0][0][0],
-                              i_fsE[l_fa],
-                              o_scratch[1][0][0] );
+        m_mm.exec( 0, 1, o_scratch[0][0][0],
+                         i_fsE[l_fa],
+                         o_scratch[1][0][0] );
 
         // multiply with second face integration matrix
-        m_mm.m_kernels[0][2]( m_fIntT[l_fa],
-                              o_scratch[1][0][0],
-                              io_dofsE[0][0],
-                              nullptr,
-                              i_tDofsP[0][0],
-                              nullptr );
+        m_mm.exec( 0, 2, m_fIntT[l_fa],
+                         o_scratch[1][0][0],
+                         io_dofsE[0][0],
+                         nullptr,
+                         i_tDofsP[0][0],
+                         nullptr );
 
         if( TL_N_RMS > 0 ) {
           // multiply with anelastic flux solver
-          m_mm.m_kernels[1][0]( o_scratch[0][0][0],
-                                i_fsA[l_fa],
-                                o_scratch[1][0][0] );
+          m_mm.exec( 1, 0, o_scratch[0][0][0],
+                           i_fsA[l_fa],
+                           o_scratch[1][0][0] );
 
           // multiply with secand face integration matrix
-          m_mm.m_kernels[1][1]( m_fIntT[l_fa],
-                                o_scratch[1][0][0],
-                                l_upAn[0][0] );
+          m_mm.exec( 1, 1, m_fIntT[l_fa],
+                           o_scratch[1][0][0],
+                           l_upAn[0][0] );
         }
       }
 
@@ -254,6 +289,42 @@ class edge::seismic::kernels::SurfIntSingle: public edge::seismic::kernels::Surf
       if( TL_N_RMS > 0) this->scatterUpdateA( l_upAn, io_dofsA );
     }
 
+    /**
+     * Element local contribution of a batch of consecutive elements (elastic only, single forward simulations).
+     * The flux matrices are applied to all elements of the batch at once, the flux solvers per element.
+     *
+     * @param i_fsE elastic flux solvers of the batch's elements.
+     * @param i_tDofsE elastic time integrated DG-DOFs of the batch's elements.
+     * @param io_dofsE will be updated with local elastic contributions of the batch's elements to the surface integral.
+     * @param o_scratch will be used as scratch space for the computations.
+     **/
+    void localBatch( TL_T_REAL const (*i_fsE)[TL_N_FAS][TL_N_ENS_FS_E],
+                     TL_T_REAL const (*i_tDofsE)[TL_N_QTS_E][TL_N_MDS_EL][1],
+                     TL_T_REAL       (*io_dofsE)[TL_N_QTS_E][TL_N_MDS_EL][1],
+                     TL_T_REAL         o_scratch[2][TL_N_BAT][TL_N_QTS_E][TL_N_MDS_FA][1] ) const {
+      EDGE_CHECK_EQ( TL_N_RMS, 0 );
+
+      // iterate over faces
+      for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ ) {
+        // multiply all elements with first face integration matrix
+        m_mm.exec( 2, 0, m_fIntLN[l_fa],
+                         i_tDofsE[0][0][0],
+                         o_scratch[0][0][0][0] );
+
+        // multiply with the elements' flux solvers
+        for( unsigned short l_el = 0; l_el < TL_N_BAT; l_el++ ) {
+          m_mm.exec( 0, 1, o_scratch[0][l_el][0][0],
+                           i_fsE[l_el][l_fa],
+                           o_scratch[1][l_el][0][0] );
+        }
+
+        // multiply all elements with second face integration matrix
+        m_mm.exec( 2, 1, m_fIntT[l_fa],
+                         o_scratch[1][0][0][0],
+                         io_dofsE[0][0][0] );
+      }
+    }
+
     /**
      * Applies the first first face-integration matrix to the elastic DOFs.
      *
@@ -280,12 +351,12 @@ class edge::seismic::kernels::SurfIntSingle: public edge::seismic::kernels::Surf
       }
 
       // multiply with first face integration matrix
-      m_mm.m_kernels[0][0](                     m_fIntLN[l_fMatId],
-                                                i_tDofsE[0][0],
-                                                o_tDofsFiE[0][0],
-                                                nullptr,
-                            (TL_T_REAL const *) i_pre,
-                                                nullptr );
+      m_mm.exec( 0, 0,                     m_fIntLN[l_fMatId],
+                                           i_tDofsE[0][0],
+                                           o_tDofsFiE[0][0],
+                                           nullptr,
+                       (TL_T_REAL const *) i_pre,
+                                           nullptr );
     }
 
     /**
@@ -330,28 +401,28 @@ class edge::seismic::kernels::SurfIntSingle: public edge::seismic::kernels::Surf
       }
 
       // multiply with flux solver
-      m_mm.m_kernels[0][1]( l_tDofsFiE,
-                            i_fsE,
-                            o_scratch[1][0][0] );
+      m_mm.exec( 0, 1, l_tDofsFiE,
+                       i_fsE,
+                       o_scratch[1][0][0] );
 
       // multiply with second face integration matrix
-      m_mm.m_kernels[0][2](                     m_fIntT[i_fa],
-                                                o_scratch[1][0][0],
-                                                io_dofsE[0][0],
-                                                nullptr,
-                            (TL_T_REAL const *) i_pre,
-                                                nullptr );
+      m_mm.exec( 0, 2,                     m_fIntT[i_fa],
+                                           o_scratch[1][0][0],
+                                           io_dofsE[0][0],
+                                           nullptr,
+                       (TL_T_REAL const *) i_pre,
+                                           nullptr );
 
       if( TL_N_RMS > 0 ) {
         // multiply with anelastic flux solver
-        m_mm.m_kernels[1][0]( l_tDofsFiE,
-                              i_fsA,
-                              o_scratch[1][0][0] );
+        m_mm.exec( 1, 0, l_tDofsFiE,
+                         i_fsA,
+                         o_scratch[1][0][0] );
 
         // multiply with second face integration matrix
-        m_mm.m_kernels[1][1]( m_fIntT[i_fa],
-                              o_scratch[1][0][0],
-                              io_dofsA[0][0] );
+        m_mm.exec( 1, 1, m_fIntT[i_fa],
+                         o_scratch[1][0][0],
+                         io_dofsA[0][0] );
       }
     }
 };
@@ -56,6 +56,65 @@ TEST_CASE( "Local surface integration for single seismic simulations.", "[elasti
 }
 
 
+TEST_CASE( "Batched local surface integration for single seismic simulations.", "[elastic][SurfIntLocalSingle]" ) {
+  // set up matrix structures
+#include "SurfInt.test.inc"
+
+  // set up kernel
+  edge::data::Dynamic l_dynMem;
+  edge::seismic::kernels::SurfIntSingle< float,
+                                         0,
+                                         TET4,
+                                         3 > l_surf( nullptr, l_dynMem );
+
+  // batch of elements with scaled flux solvers and DOFs
+  float l_fSolvBat[N_BATCH_ELEMENTS][4][81];
+  float l_tDofsBat[N_BATCH_ELEMENTS][9][10][1];
+  float l_dofsBat[N_BATCH_ELEMENTS][9][10][1];
+  float l_dofsRef[N_BATCH_ELEMENTS][9][10][1];
+
+  for( unsigned short l_el = 0; l_el < N_BATCH_ELEMENTS; l_el++ ) {
+    for( unsigned short l_fa = 0; l_fa < 4; l_fa++ )
+      for( unsigned short l_en = 0; l_en < 81; l_en++ )
+        l_fSolvBat[l_el][l_fa][l_en] = (1 + 0.1f*l_el) * l_fSolvE[l_fa][l_en/9][l_en%9];
+
+    for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
+      for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
+        l_tDofsBat[l_el][l_qt][l_md][0] = (1 - 0.05f*l_el) * l_tDofsE[l_qt][l_md];
+        l_dofsBat[l_el][l_qt][l_md][0]  = l_dofsE[l_qt][l_md] + l_el;
+        l_dofsRef[l_el][l_qt][l_md][0]  = l_dofsBat[l_el][l_qt][l_md][0];
+      }
+    }
+  }
+
+  // per-element reference
+  float l_scratch[2][9][6][1];
+  for( unsigned short l_el = 0; l_el < N_BATCH_ELEMENTS; l_el++ ) {
+    l_surf.local( l_fSolvBat[l_el],
+                  nullptr,
+                  l_tDofsBat[l_el],
+                  l_dofsRef[l_el],
+                  nullptr,
+                  l_scratch );
+  }
+
+  // batched kernel
+  float l_scratchBat[2][N_BATCH_ELEMENTS][9][6][1];
+  l_surf.localBatch( l_fSolvBat,
+                     l_tDofsBat,
+                     l_dofsBat,
+                     l_scratchBat );
+
+  // check the results
+  for( unsigned short l_el = 0; l_el < N_BATCH_ELEMENTS; l_el++ ) {
+    for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
+      for( unsigned short l_md = 0; l_md < 10; l_md++ ) {
+        REQUIRE( l_dofsBat[l_el][l_qt][l_md][0] == Approx( l_dofsRef[l_el][l_qt][l_md][0] ) );
+      }
+    }
+  }
+}
+
 TEST_CASE( "Neighboring surface integration for single seismic forward simulations.", "[elastic][SurfIntNeighSingle]" ) {
   // set up matrix structures
 #include "SurfInt.test.inc"
@@ -28,7 +28,11 @@
 
 #include "SurfInt.hpp"
 #include "dg/Basis.h"
+#if defined(PP_T_KERNELS_SIMD)
+#include "data/MmSimd.hpp"
+#else
 #include "data/MmVanilla.hpp"
+#endif
 
 namespace edge {
   namespace seismic {
@@ -90,14 +94,22 @@ class edge::seismic::kernels::SurfIntVanilla: public edge::seismic::kernels::Sur
     //! number of entries in the anelastic flux solvers
     static unsigned short const TL_N_ENS_FS_A = CE_N_ENS_FS_A_DE( TL_N_DIS );
 
+    //! number of elements in a batch
+    static unsigned short const TL_N_BAT = N_BATCH_ELEMENTS;
+
     //! pointers to the local flux matrices
     TL_T_REAL *m_fIntLN[TL_N_FAS+TL_N_FMNS] = {};
 
     //! pointers to the transposed flux matrices
     TL_T_REAL *m_fIntT[TL_N_FAS] = {};
 
+#if defined(PP_T_KERNELS_SIMD)
+    //! matrix kernels, vectorized over the fused simulations (or the modes if not fused)
+    edge::data::MmSimd< TL_T_REAL, TL_N_CRS > m_mm;
+#else
     //! matrix kernels
     edge::data::MmVanilla< TL_T_REAL > m_mm;
+#endif
 
     /**
      * Generates the matrix kernels for the flux matrices and flux solvers.
@@ -172,6 +184,35 @@ class edge::seismic::kernels::SurfIntVanilla: public edge::seismic::kernels::Sur
                 true,                        // fused AC
                 false,                       // fused BC
                 TL_N_CRS );
+
+      // flux matrices, applied to a batch of elements
+      if( TL_N_RMS == 0 ) {
+        m_mm.add( 2,                           // group
+                  TL_N_BAT * TL_N_QTS_E,       // m
+                  TL_N_MDS_FA,                 // n
+                  TL_N_MDS_EL,                 // k
+                  TL_N_MDS_EL,                 // ldA
+                  TL_N_MDS_FA,                 // ldB
+                  TL_N_MDS_FA,                 // ldC
+                  static_cast<real_base>(1.0), // alpha
+                  static_cast<real_base>(0.0), // beta
+                  true,                        // fused AC
+                  false,                       // fused BC
+                  TL_N_CRS );
+
+        m_mm.add( 2,                           // group
+                  TL_N_BAT * TL_N_QTS_E,       // m
+                  TL_N_MDS_EL,                 // n
+                  TL_N_MDS_FA,                 // k
+                  TL_N_MDS_FA,                 // ldA
+                  TL_N_MDS_EL,                 // ldB
+                  TL_N_MDS_EL,                 // ldC
+                  static_cast<real_base>(1.0), // alpha
+                  static_cast<real_base>(1.0), // beta
+                  true,                        // fused AC
+                  false,                       // fused BC
+                  TL_N_CRS );
+      }
     }
 
   public:
@@ -261,6 +302,42 @@ class edge::seismic::kernels::SurfIntVanilla: public edge::seismic::kernels::Sur
       if( TL_N_RMS > 0) this->scatterUpdateA( l_upAn, io_dofsA );
     }
 
+    /**
+     * Element local contribution of a batch of consecutive elements (elastic only, vanilla implementation).
+     * The flux matrices are applied to all elements of the batch at once, the flux solvers per element.
+     *
+     * @param i_fsE elastic flux solvers of the batch's elements.
+     * @param i_tDofsE elastic time integrated DG-DOFs of the batch's elements.
+     * @param io_dofsE will be updated with local elastic contributions of the batch's elements to the surface integral.
+     * @param o_scratch will be used as scratch space for the computations.
+     **/
+    void localBatch( TL_T_REAL const (*i_fsE)[TL_N_FAS][TL_N_ENS_FS_E],
+                     TL_T_REAL const (*i_tDofsE)[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
+                     TL_T_REAL       (*io_dofsE)[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
+                     TL_T_REAL         o_scratch[2][TL_N_BAT][TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS] ) const {
+      EDGE_CHECK_EQ( TL_N_RMS, 0 );
+
+      // iterate over faces
+      for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ ) {
+        // local flux matrix
+        m_mm.m_kernels[2][0]( i_tDofsE[0][0][0],
+                              m_fIntLN[l_fa],
+                              o_scratch[0][0][0][0] );
+
+        // elastic flux solvers
+        for( unsigned short l_el = 0; l_el < TL_N_BAT; l_el++ ) {
+          m_mm.m_kernels[0][1]( i_fsE[l_el][l_fa],
+                                o_scratch[0][l_el][0][0],
+                                o_scratch[1][l_el][0][0] );
+        }
+
+        // transposed flux matrix
+        m_mm.m_kernels[2][1]( o_scratch[1][0][0][0],
+                              m_fIntT[l_fa],
+                              io_dofsE[0][0][0] );
+      }
+    }
+
     /**
      * Applies the first first face-integration matrix to the elastic DOFs.
      *
@@ -0,0 +1,298 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Throughput benchmark of the seismic kernels (time prediction, volume, local and neighboring surface integration).
+ **/
+#include "monitor/Bench.hpp"
+#include "Kernels.hpp"
+#include <cstdlib>
+#include <limits>
+#include <string>
+
+namespace edge {
+  namespace seismic {
+    namespace kernels {
+      namespace bench {
+        //! number of dimensions
+        static unsigned short const N_DIS = N_DIM;
+
+        //! number of faces
+        static unsigned short const N_FAS = C_ENT[T_SDISC.ELEMENT].N_FACES;
+
+        //! number of relaxation mechanisms
+        static unsigned short const N_RMS = N_RELAXATION_MECHANISMS;
+
+        //! number of relaxation mechanisms in the anelastic buffers (at least one)
+        static unsigned short const N_RMS_BUF = CE_MAX( int(N_RMS), 1 );
+
+        //! number of elastic quantities
+        static unsigned short const N_QTS_E = CE_N_QTS_E( N_DIM );
+
+        //! number of quantities per relaxation mechanism
+        static unsigned short const N_QTS_M = CE_N_QTS_M( N_DIM );
+
+        //! number of element modes
+        static unsigned short const N_MDS_EL = N_ELEMENT_MODES;
+
+        //! number of face modes
+        static unsigned short const N_MDS_FA = N_FACE_MODES;
+
+        //! number of entries in the elastic star matrices
+        static unsigned short const N_ENS_STAR_E = (MM_KERNELS_SPARSE) ? CE_N_ENS_STAR_E_SP( N_DIM ) : CE_N_ENS_STAR_E_DE( N_DIM );
+
+        //! number of entries in the anelastic star matrices
+        static unsigned short const N_ENS_STAR_A = (MM_KERNELS_SPARSE) ? CE_N_ENS_STAR_A_SP( N_DIM ) : CE_N_ENS_STAR_A_DE( N_DIM );
+
+        //! number of entries in the anelastic source matrices
+        static unsigned short const N_ENS_SRC_A = (MM_KERNELS_SPARSE) ? CE_N_ENS_SRC_A_SP( N_DIM ) : CE_N_ENS_SRC_A_DE( N_DIM );
+
+        //! number of entries in the elastic flux solvers
+        static unsigned short const N_ENS_FS_E = CE_N_ENS_FS_E_DE( N_DIM );
+
+        //! number of entries in the anelastic flux solvers
+        static unsigned short const N_ENS_FS_A = CE_N_ENS_FS_A_DE( N_DIM );
+
+        //! seismic kernels of the configuration
+        typedef Kernels< real_base,
+                         N_RMS,
+                         T_SDISC.ELEMENT,
+                         ORDER,
+                         ORDER,
+                         N_CRUNS > t_kernels;
+
+        /**
+         * Gets the nominal number of floating point operations of a kernel per element.
+         * All matrix-matrix multiplications are considered dense.
+         *
+         * @param i_kernel kernel: ck, apply, local or neigh.
+         * @return number of floating point operations.
+         **/
+        double nFlops( std::string const & i_kernel );
+
+        /**
+         * Gets the compulsory memory traffic of a kernel per element, i.e., every element-local input is read once and every output is written once.
+         *
+         * @param i_kernel kernel: ck, apply, local or neigh.
+         * @return number of bytes.
+         **/
+        double nBytes( std::string const & i_kernel );
+
+        /**
+         * Measures the throughput of the individual kernels for a large number of elements.
+         *
+         * @param io_recs records of the results will be appended.
+         **/
+        void throughput( std::vector< monitor::Bench::Record > & io_recs );
+      }
+    }
+  }
+}
+
+double edge::seismic::kernels::bench::nFlops( std::string const & i_kernel ) {
+  double l_flops = 0;
+  double l_nCk1 = CE_N_ELEMENT_MODES_CK( T_SDISC.ELEMENT, ORDER, 1 );
+
+  if( i_kernel == "ck" ) {
+    for( unsigned short l_de = 1; l_de < ORDER; l_de++ ) {
+      double l_nCkM = CE_N_ELEMENT_MODES_CK( T_SDISC.ELEMENT, ORDER, l_de-1 );
+      double l_nCkD = CE_N_ELEMENT_MODES_CK( T_SDISC.ELEMENT, ORDER, l_de );
+
+      // transposed stiffness and star matrices
+      l_flops += N_DIS * 2.0 * N_QTS_E * l_nCkD * ( l_nCkM + N_QTS_E );
+      // anelastic star and source matrices
+      if( N_RMS > 0 ) l_flops += N_DIS * 2.0 * N_QTS_M * N_DIS * l_nCkD;
+      l_flops += N_RMS * 2.0 * N_QTS_M * N_QTS_M * N_MDS_EL;
+    }
+  }
+  else if( i_kernel == "apply" ) {
+    // stiffness and star matrices
+    l_flops += N_DIS * 2.0 * N_QTS_E * N_MDS_EL * ( l_nCk1 + N_QTS_E );
+    // anelastic star and source matrices
+    if( N_RMS > 0 ) l_flops += N_DIS * 2.0 * N_QTS_M * N_DIS * N_MDS_EL;
+    l_flops += N_RMS * 2.0 * N_QTS_M * N_QTS_M * N_MDS_EL;
+  }
+  else if( i_kernel == "local" || i_kernel == "neigh" ) {
+    // two flux matrices and the flux solver
+    l_flops += N_FAS * 2.0 * N_QTS_E * N_MDS_FA * ( 2.0 * N_MDS_EL + N_QTS_E );
+    // anelastic flux solver and transposed flux matrix
+    if( N_RMS > 0 ) l_flops += N_FAS * 2.0 * N_QTS_M * N_MDS_FA * ( N_QTS_E + N_MDS_EL );
+  }
+
+  return l_flops * N_CRUNS;
+}
+
+double edge::seismic::kernels::bench::nBytes( std::string const & i_kernel ) {
+  double l_dofsE = double(N_QTS_E) * N_MDS_EL * N_CRUNS * sizeof(real_base);
+  double l_dofsA = double(N_RMS) * N_QTS_M * N_MDS_EL * N_CRUNS * sizeof(real_base);
+  double l_star  = ( double(N_DIS) * ( N_ENS_STAR_E + ( (N_RMS > 0) ? N_ENS_STAR_A : 0 ) ) + double(N_RMS) * N_ENS_SRC_A ) * sizeof(real_base);
+  double l_fs    = double(N_FAS) * ( N_ENS_FS_E + ( (N_RMS > 0) ? N_ENS_FS_A : 0 ) ) * sizeof(real_base);
+
+  // read DOFs and matrices, write tDOFs
+  if( i_kernel == "ck" )    return 2 * ( l_dofsE + l_dofsA ) + l_star;
+  // read tDOFs and matrices, update DOFs
+  if( i_kernel == "apply" ) return 3 * ( l_dofsE + l_dofsA ) + l_star;
+  // read tDOFs and flux solvers, update DOFs
+  if( i_kernel == "local" ) return 3 * l_dofsE + 2 * l_dofsA + l_fs;
+  // read tDOFs of the face-neighbors and flux solvers, update DOFs
+  if( i_kernel == "neigh" ) return ( N_FAS + 2 ) * l_dofsE + 2 * l_dofsA + l_fs;
+
+  return 0;
+}
+
+void edge::seismic::kernels::bench::throughput( std::vector< monitor::Bench::Record > & io_recs ) {
+  std::size_t l_nDofsE = std::size_t(N_QTS_E) * N_MDS_EL * N_CRUNS;
+  std::size_t l_nDofsA = std::size_t(N_RMS_BUF) * N_QTS_M * N_MDS_EL * N_CRUNS;
+
+  // element arrays of ~256MiB, such that the data is streamed from memory
+  std::size_t l_nEls = ( std::size_t(256) << 20 ) / ( ( 2 * l_nDofsE + 2 * l_nDofsA ) * sizeof(real_base) );
+  l_nEls = std::max( l_nEls, std::size_t(1024) );
+
+  data::Dynamic l_dynMem;
+
+  // relaxation frequencies
+  real_base l_rfs[N_RMS_BUF];
+  for( unsigned short l_rm = 0; l_rm < N_RMS_BUF; l_rm++ ) l_rfs[l_rm] = real_base(0.1) * (l_rm+1);
+  t_kernels l_kernels( (N_RMS > 0) ? l_rfs : nullptr, l_dynMem );
+
+  // element data
+  typedef real_base t_dofsE[N_QTS_E][N_MDS_EL][N_CRUNS];
+  typedef real_base t_dofsA[N_QTS_M][N_MDS_EL][N_CRUNS];
+
+  t_dofsE *l_dofsE  = (t_dofsE*) l_dynMem.allocate( l_nEls * l_nDofsE * sizeof(real_base) );
+  t_dofsE *l_tDofsE = (t_dofsE*) l_dynMem.allocate( l_nEls * l_nDofsE * sizeof(real_base) );
+  t_dofsA *l_dofsA  = (t_dofsA*) l_dynMem.allocate( l_nEls * l_nDofsA * sizeof(real_base) );
+  t_dofsA *l_tDofsA = (t_dofsA*) l_dynMem.allocate( l_nEls * l_nDofsA * sizeof(real_base) );
+
+  real_base (*l_starE)[N_DIS][N_ENS_STAR_E] = (real_base (*)[N_DIS][N_ENS_STAR_E]) l_dynMem.allocate( l_nEls * N_DIS * N_ENS_STAR_E * sizeof(real_base) );
+  real_base (*l_starA)[N_DIS][N_ENS_STAR_A] = (real_base (*)[N_DIS][N_ENS_STAR_A]) l_dynMem.allocate( l_nEls * N_DIS * N_ENS_STAR_A * sizeof(real_base) );
+  real_base (*l_srcA)[N_ENS_SRC_A] = (real_base (*)[N_ENS_SRC_A]) l_dynMem.allocate( l_nEls * N_RMS_BUF * N_ENS_SRC_A * sizeof(real_base) );
+  real_base (*l_fsE)[N_FAS][N_ENS_FS_E] = (real_base (*)[N_FAS][N_ENS_FS_E]) l_dynMem.allocate( l_nEls * N_FAS * N_ENS_FS_E * sizeof(real_base) );
+  real_base (*l_fsA)[N_FAS][N_ENS_FS_A] = (real_base (*)[N_FAS][N_ENS_FS_A]) l_dynMem.allocate( l_nEls * N_FAS * N_ENS_FS_A * sizeof(real_base) );
+
+  // random values, small for the matrices to keep the DOFs bounded
+  std::srand( 1234 );
+  for( std::size_t l_va = 0; l_va < l_nEls * l_nDofsE; l_va++ ) {
+    l_dofsE[0][0][0][l_va] = real_base(1) * std::rand() / RAND_MAX;
+    l_tDofsE[0][0][0][l_va] = real_base(1) * std::rand() / RAND_MAX;
+  }
+  for( std::size_t l_va = 0; l_va < l_nEls * l_nDofsA; l_va++ ) {
+    l_dofsA[0][0][0][l_va] = real_base(1) * std::rand() / RAND_MAX;
+    l_tDofsA[0][0][0][l_va] = real_base(1) * std::rand() / RAND_MAX;
+  }
+  for( std::size_t l_va = 0; l_va < l_nEls * N_DIS * N_ENS_STAR_E; l_va++ ) l_starE[0][0][l_va] = real_base(1E-6) * std::rand() / RAND_MAX;
+  for( std::size_t l_va = 0; l_va < l_nEls * N_DIS * N_ENS_STAR_A; l_va++ ) l_starA[0][0][l_va] = real_base(1E-6) * std::rand() / RAND_MAX;
+  for( std::size_t l_va = 0; l_va < l_nEls * N_RMS_BUF * N_ENS_SRC_A; l_va++ ) l_srcA[0][l_va] = real_base(1E-6) * std::rand() / RAND_MAX;
+  for( std::size_t l_va = 0; l_va < l_nEls * N_FAS * N_ENS_FS_E; l_va++ ) l_fsE[0][0][l_va] = real_base(1E-6) * std::rand() / RAND_MAX;
+  for( std::size_t l_va = 0; l_va < l_nEls * N_FAS * N_ENS_FS_A; l_va++ ) l_fsA[0][0][l_va] = real_base(1E-6) * std::rand() / RAND_MAX;
+
+  // scratch memory
+  t_dofsE *l_tmp = (t_dofsE*) l_dynMem.allocate( l_nDofsE * sizeof(real_base) );
+  t_dofsE *l_derE = (t_dofsE*) l_dynMem.allocate( ORDER * l_nDofsE * sizeof(real_base) );
+  real_base (*l_derA)[ORDER][N_QTS_M][N_MDS_EL][N_CRUNS] = (real_base (*)[ORDER][N_QTS_M][N_MDS_EL][N_CRUNS]) l_dynMem.allocate( ORDER * l_nDofsA * sizeof(real_base) );
+  real_base (*l_tmpFa)[N_QTS_E][N_MDS_FA][N_CRUNS] = (real_base (*)[N_QTS_E][N_MDS_FA][N_CRUNS]) l_dynMem.allocate( 2 * std::size_t(N_QTS_E) * N_MDS_FA * N_CRUNS * sizeof(real_base) );
+  t_dofsA *l_upA = (t_dofsA*) l_dynMem.allocate( std::size_t(N_QTS_M) * N_MDS_EL * N_CRUNS * sizeof(real_base) );
+
+  // neighbors of the elements, spread over the arrays
+  std::size_t l_strides[6] = { 1, l_nEls-1, 97, l_nEls-97, 9973, l_nEls-9973 };
+
+  real_base l_dt = real_base(1E-4);
+  std::string l_kernelNames[4] = { "ck", "apply", "local", "neigh" };
+
+  for( unsigned short l_ke = 0; l_ke < 4; l_ke++ ) {
+    std::string const & l_name = l_kernelNames[l_ke];
+
+    std::size_t l_nReps = 0;
+    double l_time = monitor::Bench::time( [&]() {
+      for( std::size_t l_el = 0; l_el < l_nEls; l_el++ ) {
+        if( l_ke == 0 ) {
+          l_kernels.m_time.ck( l_dt,
+                               l_starE[l_el],
+                               (N_RMS > 0) ? l_starA[l_el] : nullptr,
+                               l_srcA+l_el*std::size_t(N_RMS),
+                               l_dofsE[l_el],
+                               (N_RMS > 0) ? l_dofsA+l_el*std::size_t(N_RMS) : nullptr,
+                               l_tmp[0],
+                               l_derE,
+                               (N_RMS > 0) ? l_derA : nullptr,
+                               l_tDofsE[l_el],
+                               (N_RMS > 0) ? l_tDofsA+l_el*std::size_t(N_RMS) : nullptr );
+        }
+        else if( l_ke == 1 ) {
+          l_kernels.m_volInt.apply( l_starE[l_el],
+                                    (N_RMS > 0) ? l_starA[l_el] : nullptr,
+                                    l_srcA+l_el*std::size_t(N_RMS),
+                                    l_tDofsE[l_el],
+                                    (N_RMS > 0) ? l_tDofsA+l_el*std::size_t(N_RMS) : nullptr,
+                                    l_dofsE[l_el],
+                                    (N_RMS > 0) ? l_dofsA+l_el*std::size_t(N_RMS) : nullptr,
+                                    l_tmp[0] );
+        }
+        else if( l_ke == 2 ) {
+          l_kernels.m_surfInt.local( l_fsE[l_el],
+                                     (N_RMS > 0) ? l_fsA[l_el] : nullptr,
+                                     l_tDofsE[l_el],
+                                     l_dofsE[l_el],
+                                     (N_RMS > 0) ? l_dofsA+l_el*std::size_t(N_RMS) : nullptr,
+                                     l_tmpFa,
+                                     l_dofsE[ std::min( l_el+1, l_nEls-1 ) ],
+                                     l_tDofsE[ std::min( l_el+1, l_nEls-1 ) ] );
+        }
+        else {
+          for( unsigned short l_fa = 0; l_fa < N_FAS; l_fa++ ) {
+            std::size_t l_ne = ( l_el + l_strides[l_fa % 6] ) % l_nEls;
+
+            l_kernels.m_surfInt.neigh( l_fa,
+                                       0,
+                                       l_fa,
+                                       l_fsE[l_el][l_fa],
+                                       (N_RMS > 0) ? l_fsA[l_el][l_fa] : nullptr,
+                                       l_tDofsE[l_ne],
+                                       nullptr,
+                                       l_dofsE[l_el],
+                                       l_upA[0],
+                                       l_tmpFa,
+                                       l_tDofsE[l_ne] );
+          }
+        }
+      }
+    }, 1.0, l_nReps );
+
+    double l_gflops = nFlops( l_name ) * l_nEls * 1E-9 / l_time;
+    double l_gbs = nBytes( l_name ) * l_nEls * 1E-9 / l_time;
+
+    monitor::Bench::Record l_rec;
+    l_rec.add( "kernel", l_name )
+         .add( "n_elements", (double) l_nEls )
+         .add( "n_reps", (double) l_nReps )
+         .add( "time_per_element", l_time / l_nEls )
+         .add( "flops_per_element", nFlops( l_name ) )
+         .add( "bytes_per_element", nBytes( l_name ) )
+         .add( "gflops", l_gflops )
+         .add( "bandwidth_gbs", l_gbs );
+    io_recs.push_back( l_rec );
+  }
+
+  // prevent the compiler from removing the kernels
+  real_base l_chk = 0;
+  for( std::size_t l_el = 0; l_el < l_nEls; l_el++ ) l_chk += l_dofsE[l_el][0][0][0];
+  if( l_chk != l_chk ) io_recs.back().add( "nan", 1.0 );
+}
+
+EDGE_BENCH( "seismic/kernels/throughput", edge::seismic::kernels::bench::throughput )
@@ -388,6 +388,35 @@ class edge::seismic::kernels::TimePredFused: public edge::seismic::kernels::Time
       generateKernels( l_stiffT );
     };
 
+    /**
+     * Logs the telemetry of the matrix kernels, if compiled with PP_MMKERNEL_PERF.
+     **/
+    void logMmStats() const {
+      m_mm.logStats( "time prediction" );
+    }
+
+    /**
+     * Gets the number of floating point operations of the matrix kernels in a single time prediction.
+     *
+     * @return number of floating point operations, summed over the fused simulations.
+     **/
+    std::size_t flops() const {
+      std::size_t l_flops = 0;
+
+      for( unsigned int l_de = 1; l_de < TL_O_TI; l_de++ ) {
+        unsigned short l_re = (TL_N_RMS == 0) ? l_de : 1;
+
+        for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+          l_flops += m_mm.m_kernelFlops[0][(l_re-1)*(TL_N_DIS)+l_di];
+          l_flops += m_mm.m_kernelFlops[1][l_re-1];
+          if( TL_N_RMS > 0 ) l_flops += m_mm.m_kernelFlops[2][0];
+        }
+        if( TL_N_RMS > 0 ) l_flops += TL_N_RMS * m_mm.m_kernelFlops[2][1];
+      }
+
+      return l_flops;
+    }
+
     /**
      * Applies the Cauchy–Kowalevski procedure (fused LIBXSMM version) and computes time derivatives and time integrated DOFs.
      *
@@ -471,19 +500,19 @@ class edge::seismic::kernels::TimePredFused: public edge::seismic::kernels::Time
           }
 
           // multiply with transposed stiffness matrices and inverse mass matrix
-          m_mm.m_kernels[0][(l_re-1)*(TL_N_DIS)+l_di]( o_derE[l_de-1][0][0],
-                                                       m_stiffT[l_re-1][l_di],
-                                                       o_scratch[0][0] );
+          m_mm.exec( 0, (l_re-1)*(TL_N_DIS)+l_di, o_derE[l_de-1][0][0],
+                                                  m_stiffT[l_re-1][l_di],
+                                                  o_scratch[0][0] );
           // multiply with star matrices
-          m_mm.m_kernels[1][l_re-1]( i_starE[l_di],
-                                     o_scratch[0][0],
-                                     o_derE[l_de][0][0] );
+          m_mm.exec( 1, l_re-1, i_starE[l_di],
+                                o_scratch[0][0],
+                                o_derE[l_de][0][0] );
 
           if( TL_N_RMS > 0 ) {
             // multiply with anelastic star matrices
-            m_mm.m_kernels[2][0]( i_starA[l_di],
-                                  o_scratch[0][0],
-                                  l_scratch[0][0] );
+            m_mm.exec( 2, 0, i_starA[l_di],
+                             o_scratch[0][0],
+                             l_scratch[0][0] );
           }
         }
 
@@ -493,9 +522,9 @@ class edge::seismic::kernels::TimePredFused: public edge::seismic::kernels::Time
         // anelastic: update derivatives and time integrated DOFs
         for( unsigned short l_rm = 0; l_rm < TL_N_RMS; l_rm++ ) {
           // add contribution of source matrix
-          m_mm.m_kernels[2][1]( i_srcA[l_rm],
-                                o_derA[l_rm][l_de-1][0][0],
-                                o_derE[l_de][0][0] );
+          m_mm.exec( 2, 1, i_srcA[l_rm],
+                           o_derA[l_rm][l_de-1][0][0],
+                           o_derE[l_de][0][0] );
 
           // multiply with relaxation frequency and add
           for( unsigned short l_qt = 0; l_qt < TL_N_QTS_M; l_qt++ ) {
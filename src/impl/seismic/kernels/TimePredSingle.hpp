@@ -84,6 +84,9 @@ class edge::seismic::kernels::TimePredSingle: public edge::seismic::kernels::Tim
     //! number of non-zeros in the anelastic source matrices
     static unsigned short const TL_N_ENS_SRC_A = CE_N_ENS_SRC_A_DE( TL_N_DIS );
 
+    //! number of elements in a batch
+    static unsigned short const TL_N_BAT = N_BATCH_ELEMENTS;
+
     //! pointers to the (possibly recursive) stiffness matrices
     TL_T_REAL *m_stiffT[CE_MAX(TL_O_TI-1,1)][TL_N_DIS] = {};
 
@@ -147,6 +150,22 @@ class edge::seismic::kernels::TimePredSingle: public edge::seismic::kernels::Tim
                     LIBXSMM_GEMM_PREFETCH_NONE );
         }
       }
+
+      // transposed stiffness matrices, applied to a batch of elements
+      if( TL_N_RMS == 0 ) {
+        for( unsigned int l_de = 1; l_de < TL_O_TI; l_de++ ) {
+          m_mm.add( 3,                                                 // group
+                    CE_N_ELEMENT_MODES_CK( TL_T_EL, TL_O_SP, l_de ),   // m
+                    TL_N_BAT * TL_N_QTS_E,                             // n
+                    CE_N_ELEMENT_MODES_CK( TL_T_EL, TL_O_SP, l_de-1 ), // k
+                    TL_N_MDS,                                          // ldA
+                    TL_N_MDS,                                          // ldB
+                    TL_N_MDS,                                          // ldC
+                    static_cast<TL_T_REAL>(1.0),                       // alpha
+                    static_cast<TL_T_REAL>(0.0),                       // beta
+                    LIBXSMM_GEMM_PREFETCH_NONE );
+        }
+      }
     }
 
   public:
@@ -172,6 +191,13 @@ class edge::seismic::kernels::TimePredSingle: public edge::seismic::kernels::Tim
       generateKernels();
     };
 
+    /**
+     * Logs the telemetry of the matrix kernels, if compiled with PP_MMKERNEL_PERF.
+     **/
+    void logMmStats() const {
+      m_mm.logStats( "time prediction" );
+    }
+
     /**
      * Applies the Cauchy–Kowalevski procedure (single forward run LIBXSMM version) and computes time derivatives and time integrated DOFs.
      *
@@ -246,19 +272,19 @@ class edge::seismic::kernels::TimePredSingle: public edge::seismic::kernels::Tim
         // compute the derivatives
         for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
           // multiply with transposed stiffness matrices and inverse mass matrix
-          m_mm.m_kernels[0][l_re-1]( m_stiffT[l_re-1][l_di],
-                                     o_derE[l_de-1][0][0],
-                                     o_scratch[0][0] );
+          m_mm.exec( 0, l_re-1, m_stiffT[l_re-1][l_di],
+                                o_derE[l_de-1][0][0],
+                                o_scratch[0][0] );
           // multiply with star matrices
-          m_mm.m_kernels[1][l_re-1]( o_scratch[0][0],
-                                     i_starE[l_di],
-                                     o_derE[l_de][0][0] );
+          m_mm.exec( 1, l_re-1, o_scratch[0][0],
+                                i_starE[l_di],
+                                o_derE[l_de][0][0] );
 
           if( TL_N_RMS > 0 ) {
             // multiply with anelastic star matrices
-            m_mm.m_kernels[2][0]( o_scratch[TL_N_QTS_M][0],
-                                  i_starA[l_di],
-                                  l_scratch[0] );
+            m_mm.exec( 2, 0, o_scratch[TL_N_QTS_M][0],
+                             i_starA[l_di],
+                             l_scratch[0] );
           }
         }
 
@@ -267,9 +293,9 @@ class edge::seismic::kernels::TimePredSingle: public edge::seismic::kernels::Tim
 
         for( unsigned short l_rm = 0; l_rm < TL_N_RMS; l_rm++ ) {
           // add contribution of source matrix
-          m_mm.m_kernels[2][1]( o_derA[l_rm][l_de-1][0][0],
-                                i_srcA[l_rm],
-                                o_derE[l_de][0][0] );
+          m_mm.exec( 2, 1, o_derA[l_rm][l_de-1][0][0],
+                           i_srcA[l_rm],
+                           o_derE[l_de][0][0] );
 
           // multiply with relaxation frequency and add
           for( unsigned short l_qt = 0; l_qt < TL_N_QTS_M; l_qt++ ) {
@@ -292,6 +318,79 @@ class edge::seismic::kernels::TimePredSingle: public edge::seismic::kernels::Tim
         }
       }
     }
+
+    /**
+     * Applies the Cauchy–Kowalevski procedure to a batch of consecutive elements (elastic only, single forward run LIBXSMM version).
+     * The transposed stiffness matrices are applied to all elements of the batch at once, the star matrices per element.
+     *
+     * @param i_dT time step.
+     * @param i_starE elastic star matrices of the batch's elements.
+     * @param i_dofsE elastic DOFs of the batch's elements.
+     * @param o_scratch will be used as scratch memory.
+     * @param o_derE will be set to elastic time derivatives, ordered by derivative and element.
+     * @param o_tIntE will be set to elastic time integrated DOFs of the batch's elements.
+     **/
+    void ckBatch( TL_T_REAL         i_dT,
+                  TL_T_REAL const (*i_starE)[TL_N_DIS][TL_N_ENS_STAR_E],
+                  TL_T_REAL const (*i_dofsE)[TL_N_QTS_E][TL_N_MDS][1],
+                  TL_T_REAL       (*o_scratch)[TL_N_QTS_E][TL_N_MDS][1],
+                  TL_T_REAL         o_derE[TL_O_TI][TL_N_BAT][TL_N_QTS_E][TL_N_MDS][1],
+                  TL_T_REAL       (*o_tIntE)[TL_N_QTS_E][TL_N_MDS][1] ) const {
+      EDGE_CHECK_EQ( TL_N_RMS, 0 );
+
+      // scalar for the time integration
+      TL_T_REAL l_scalar = i_dT;
+
+      // initialize zero-derivative, reset time integrated dofs
+      for( unsigned short l_el = 0; l_el < TL_N_BAT; l_el++ ) {
+        for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ ) {
+#pragma omp simd
+          for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ ) {
+            o_derE[0][l_el][l_qt][l_md][0] = i_dofsE[l_el][l_qt][l_md][0];
+            o_tIntE[l_el][l_qt][l_md][0]   = l_scalar * i_dofsE[l_el][l_qt][l_md][0];
+          }
+        }
+      }
+
+      // iterate over time derivatives
+      for( unsigned short l_de = 1; l_de < TL_O_TI; l_de++ ) {
+        // reset this derivative
+        for( unsigned short l_el = 0; l_el < TL_N_BAT; l_el++ )
+          for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+#pragma omp simd
+            for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ ) o_derE[l_de][l_el][l_qt][l_md][0] = 0;
+
+        // compute the derivatives
+        for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+          // multiply all elements with transposed stiffness matrices and inverse mass matrix
+          m_mm.exec( 3, l_de-1, m_stiffT[l_de-1][l_di],
+                                o_derE[l_de-1][0][0][0],
+                                o_scratch[0][0][0] );
+
+          // multiply with the elements' star matrices
+          for( unsigned short l_el = 0; l_el < TL_N_BAT; l_el++ ) {
+            m_mm.exec( 1, l_de-1, o_scratch[l_el][0][0],
+                                  i_starE[l_el][l_di],
+                                  o_derE[l_de][l_el][0][0] );
+          }
+        }
+
+        // update scalar
+        l_scalar *= i_dT / (l_de+1);
+
+        // update time integrated dofs
+        unsigned short l_nCpMds = CE_N_ELEMENT_MODES_CK( TL_T_EL, TL_O_SP, l_de );
+
+        for( unsigned short l_el = 0; l_el < TL_N_BAT; l_el++ ) {
+          for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ ) {
+#pragma omp simd
+            for( unsigned short l_md = 0; l_md < l_nCpMds; l_md++ ) {
+              o_tIntE[l_el][l_qt][l_md][0] += l_scalar * o_derE[l_de][l_el][l_qt][l_md][0];
+            }
+          }
+        }
+      }
+    }
 };
 
 #endif
\ No newline at end of file
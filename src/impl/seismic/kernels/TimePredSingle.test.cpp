@@ -74,6 +74,79 @@ TEST_CASE( "Optimized elastic ADER time prediction for single forward simulation
   }
 }
 
+TEST_CASE( "Optimized batched elastic ADER time prediction for single forward simulations.", "[elastic][TimePredSingle]" ) {
+  // set up matrix structures
+#include "TimePred.test.inc"
+
+  // set up kernel
+  edge::data::Dynamic l_dynMem;
+  edge::seismic::kernels::TimePredSingle< float,
+                                          0,
+                                          TET4,
+                                          4,
+                                          4 > l_predElastic( nullptr, l_dynMem );
+
+  // batch of elements with scaled star matrices and DOFs
+  float l_starBat[N_BATCH_ELEMENTS][3][81];
+  float l_dofsBat[N_BATCH_ELEMENTS][9][20][1];
+
+  for( unsigned short l_el = 0; l_el < N_BATCH_ELEMENTS; l_el++ ) {
+    for( unsigned short l_di = 0; l_di < 3; l_di++ )
+      for( unsigned short l_en = 0; l_en < 81; l_en++ )
+        l_starBat[l_el][l_di][l_en] = (1 + 0.1f*l_el) * l_starE[l_di][l_en/9][l_en%9];
+
+    for( unsigned short l_qt = 0; l_qt < 9; l_qt++ )
+      for( unsigned short l_md = 0; l_md < 20; l_md++ )
+        l_dofsBat[l_el][l_qt][l_md][0] = (1 - 0.05f*l_el) * l_dofsE[l_qt][l_md];
+  }
+
+  // per-element reference
+  float l_scratch[N_BATCH_ELEMENTS][9][20][1];
+  float l_dersRef[N_BATCH_ELEMENTS][4][9][20][1];
+  float l_tDofsRef[N_BATCH_ELEMENTS][9][20][1];
+
+  for( unsigned short l_el = 0; l_el < N_BATCH_ELEMENTS; l_el++ ) {
+    l_predElastic.ck( 0.017,
+                      l_starBat[l_el],
+                      nullptr,
+                      nullptr,
+                      l_dofsBat[l_el],
+                      nullptr,
+                      l_scratch[0],
+                      l_dersRef[l_el],
+                      nullptr,
+                      l_tDofsRef[l_el],
+                      nullptr );
+  }
+
+  // batched kernel
+  float l_dersBat[4][N_BATCH_ELEMENTS][9][20][1];
+  float l_tDofsBat[N_BATCH_ELEMENTS][9][20][1];
+
+  l_predElastic.ckBatch( 0.017,
+                         l_starBat,
+                         l_dofsBat,
+                         l_scratch,
+                         l_dersBat,
+                         l_tDofsBat );
+
+  // check the results
+  for( unsigned short l_el = 0; l_el < N_BATCH_ELEMENTS; l_el++ ) {
+    for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
+      for( unsigned short l_md = 0; l_md < 20; l_md++ ) {
+        REQUIRE( l_tDofsBat[l_el][l_qt][l_md][0] == Approx( l_tDofsRef[l_el][l_qt][l_md][0] ) );
+
+        for( unsigned short l_de = 0; l_de < 4; l_de++ ) {
+          unsigned short l_nCpMds = CE_N_ELEMENT_MODES_CK( TET4, 4, l_de );
+          if( l_md < l_nCpMds ) {
+            REQUIRE( l_dersBat[l_de][l_el][l_qt][l_md][0] == Approx( l_dersRef[l_el][l_de][l_qt][l_md][0] ) );
+          }
+        }
+      }
+    }
+  }
+}
+
 TEST_CASE( "Optimized viscoelastic ADER time prediction for single forward simulations.", "[visco][TimePredSingle]" ) {
   // set up matrix structures
 #include "TimePred.test.inc"
@@ -27,7 +27,11 @@
 #define EDGE_SEISMIC_KERNELS_TIME_PRED_VANILLA_HPP
 
 #include "TimePred.hpp"
+#if defined(PP_T_KERNELS_SIMD)
+#include "data/MmSimd.hpp"
+#else
 #include "data/MmVanilla.hpp"
+#endif
 
 namespace edge {
   namespace seismic {
@@ -87,8 +91,16 @@ class edge::seismic::kernels::TimePredVanilla: public edge::seismic::kernels::Ti
     //! number of non-zeros in the anelastic source matrices
     static unsigned short const TL_N_ENS_SRC_A = CE_N_ENS_SRC_A_DE( TL_N_DIS );
 
+    //! number of elements in a batch
+    static unsigned short const TL_N_BAT = N_BATCH_ELEMENTS;
+
+#if defined(PP_T_KERNELS_SIMD)
+    //! matrix kernels, vectorized over the fused simulations (or the modes if not fused)
+    edge::data::MmSimd< TL_T_REAL, TL_N_CRS > m_mm;
+#else
     //! matrix kernels
     edge::data::MmVanilla< TL_T_REAL > m_mm;
+#endif
 
     //! pointers to the (possibly recursive) stiffness matrices
     TL_T_REAL *m_stiffT[CE_MAX(TL_O_TI-1,1)][TL_N_DIS] = {};
@@ -128,6 +140,24 @@ class edge::seismic::kernels::TimePredVanilla: public edge::seismic::kernels::Ti
                   TL_N_CRS );
       }
 
+      // transposed stiffness matrices, applied to a batch of elements
+      if( TL_N_RMS == 0 ) {
+        for( unsigned short l_de = 1; l_de < TL_O_TI; l_de++ ) {
+          m_mm.add( 3,                                                 // group
+                    TL_N_BAT * TL_N_QTS_E,                             // m
+                    CE_N_ELEMENT_MODES_CK( TL_T_EL, TL_O_SP, l_de   ), // n
+                    CE_N_ELEMENT_MODES_CK( TL_T_EL, TL_O_SP, l_de-1 ), // k
+                    TL_N_MDS,                                          // ldA
+                    TL_N_MDS,                                          // ldB
+                    TL_N_MDS,                                          // ldC
+                    TL_T_REAL(1.0),                                    // alpha
+                    TL_T_REAL(0.0),                                    // beta
+                    true,                                              // fused AC
+                    false,                                             // fused BC
+                    TL_N_CRS );
+        }
+      }
+
       if( TL_N_RMS > 0 ) {
         // anelastic star matrix
         m_mm.add( 2,                                             // group
@@ -304,6 +334,81 @@ class edge::seismic::kernels::TimePredVanilla: public edge::seismic::kernels::Ti
         }
       }
     }
+
+    /**
+     * Applies the Cauchy–Kowalevski procedure to a batch of consecutive elements (elastic only, vanilla implementation).
+     * The transposed stiffness matrices are applied to all elements of the batch at once, the star matrices per element.
+     *
+     * @param i_dT time step.
+     * @param i_starE elastic star matrices of the batch's elements.
+     * @param i_dofsE elastic DOFs of the batch's elements.
+     * @param o_scratch will be used as scratch memory.
+     * @param o_derE will be set to elastic time derivatives, ordered by derivative and element.
+     * @param o_tIntE will be set to elastic time integrated DOFs of the batch's elements.
+     **/
+    void ckBatch( TL_T_REAL         i_dT,
+                  TL_T_REAL const (*i_starE)[TL_N_DIS][TL_N_ENS_STAR_E],
+                  TL_T_REAL const (*i_dofsE)[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                  TL_T_REAL       (*o_scratch)[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                  TL_T_REAL         o_derE[TL_O_TI][TL_N_BAT][TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                  TL_T_REAL       (*o_tIntE)[TL_N_QTS_E][TL_N_MDS][TL_N_CRS] ) const {
+      EDGE_CHECK_EQ( TL_N_RMS, 0 );
+
+      // scalar for the time integration
+      TL_T_REAL l_scalar = i_dT;
+
+      // initialize zero-derivative, reset time integrated dofs
+      for( unsigned short l_el = 0; l_el < TL_N_BAT; l_el++ ) {
+        for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ ) {
+          for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ ) {
+            for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+              o_derE[0][l_el][l_qt][l_md][l_cr] = i_dofsE[l_el][l_qt][l_md][l_cr];
+              o_tIntE[l_el][l_qt][l_md][l_cr]   = l_scalar * i_dofsE[l_el][l_qt][l_md][l_cr];
+            }
+          }
+        }
+      }
+
+      // iterate over time derivatives
+      for( unsigned short l_de = 1; l_de < TL_O_TI; l_de++ ) {
+        // reset this derivative
+        for( unsigned short l_el = 0; l_el < TL_N_BAT; l_el++ )
+          for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+            for( unsigned short l_md = 0; l_md < TL_N_MDS; l_md++ )
+              for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) o_derE[l_de][l_el][l_qt][l_md][l_cr] = 0;
+
+        // compute the derivatives
+        for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+          // multiply all elements with transposed stiffness matrices and inverse mass matrix
+          m_mm.m_kernels[3][l_de-1]( o_derE[l_de-1][0][0][0],
+                                     m_stiffT[l_de-1][l_di],
+                                     o_scratch[0][0][0] );
+
+          // multiply with the elements' star matrices
+          for( unsigned short l_el = 0; l_el < TL_N_BAT; l_el++ ) {
+            m_mm.m_kernels[1][l_de-1]( i_starE[l_el][l_di],
+                                       o_scratch[l_el][0][0],
+                                       o_derE[l_de][l_el][0][0] );
+          }
+        }
+
+        // update scalar
+        l_scalar *= i_dT / (l_de+1);
+
+        // update time integrated DOFs
+        unsigned short l_nCpMds = CE_N_ELEMENT_MODES_CK( TL_T_EL, TL_O_SP, l_de );
+
+        for( unsigned short l_el = 0; l_el < TL_N_BAT; l_el++ ) {
+          for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ ) {
+            for( unsigned short l_md = 0; l_md < l_nCpMds; l_md++ ) {
+              for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+                o_tIntE[l_el][l_qt][l_md][l_cr] += l_scalar * o_derE[l_de][l_el][l_qt][l_md][l_cr];
+              }
+            }
+          }
+        }
+      }
+    }
 };
 
 #endif
\ No newline at end of file
@@ -346,6 +346,31 @@ class edge::seismic::kernels::VolIntFused: edge::seismic::kernels::VolInt< TL_T_
       generateKernels( l_stiff );
     }
 
+    /**
+     * Logs the telemetry of the matrix kernels, if compiled with PP_MMKERNEL_PERF.
+     **/
+    void logMmStats() const {
+      m_mm.logStats( "volume integration" );
+    }
+
+    /**
+     * Gets the number of floating point operations of the matrix kernels in a single volume integration.
+     *
+     * @return number of floating point operations, summed over the fused simulations.
+     **/
+    std::size_t flops() const {
+      std::size_t l_flops = 0;
+
+      for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+        l_flops += m_mm.m_kernelFlops[0][l_di];
+        l_flops += m_mm.m_kernelFlops[1][0];
+        if( TL_N_RMS > 0 ) l_flops += m_mm.m_kernelFlops[2][0];
+      }
+      if( TL_N_RMS > 0 ) l_flops += TL_N_RMS * m_mm.m_kernelFlops[2][1];
+
+      return l_flops;
+    }
+
     /**
      * Optimized volume contribution for fused seismic forward simulations.
      *
@@ -390,39 +415,39 @@ class edge::seismic::kernels::VolIntFused: edge::seismic::kernels::VolInt< TL_T_
         // elastic: utilize zero-block in star matrix multiplication
         if( TL_N_RMS == 0 ) {
           // multiply with star matrix
-          m_mm.m_kernels[1][0]( i_starE[l_di],
-                                i_tDofsE[0][0],
-                                o_scratch[0][0] );
+          m_mm.exec( 1, 0, i_starE[l_di],
+                           i_tDofsE[0][0],
+                           o_scratch[0][0] );
 
           // multiply with stiffness and inverse mass matrix
-          m_mm.m_kernels[0][l_di]( o_scratch[0][0],
-                                   m_stiff[l_di],
-                                   io_dofsE[0][0] );
+          m_mm.exec( 0, l_di, o_scratch[0][0],
+                              m_stiff[l_di],
+                              io_dofsE[0][0] );
         }
         // viscoelastic: re-use stiffness matrix multiplication
         else {
           // multiply with stiffness and inverse mass matrix
-          m_mm.m_kernels[0][l_di]( i_tDofsE[0][0],
-                                   m_stiff[l_di],
-                                   o_scratch[0][0] );
+          m_mm.exec( 0, l_di, i_tDofsE[0][0],
+                              m_stiff[l_di],
+                              o_scratch[0][0] );
 
           // multiply with elastic star matrix
-          m_mm.m_kernels[1][0]( i_starE[l_di],
-                                o_scratch[0][0],
-                                io_dofsE[0][0] );
+          m_mm.exec( 1, 0, i_starE[l_di],
+                           o_scratch[0][0],
+                           io_dofsE[0][0] );
 
           // multiply with anelastic star matrices
-          m_mm.m_kernels[2][0]( i_starA[l_di],
-                                o_scratch[0][0],
-                                l_scratch[0][0] );
+          m_mm.exec( 2, 0, i_starA[l_di],
+                           o_scratch[0][0],
+                           l_scratch[0][0] );
         }
       }
 
       for( unsigned short l_rm = 0; l_rm < TL_N_RMS; l_rm++ ) {
         // add contribution of source matrix
-        m_mm.m_kernels[2][1]( i_srcA[l_rm],
-                              i_tDofsA[l_rm][0][0],
-                              io_dofsE[0][0] );
+        m_mm.exec( 2, 1, i_srcA[l_rm],
+                         i_tDofsA[l_rm][0][0],
+                         io_dofsE[0][0] );
 
         // multiply with relaxation frequency and add
         for( unsigned short l_qt = 0; l_qt < TL_N_QTS_M; l_qt++ ) {
@@ -81,6 +81,9 @@ class edge::seismic::kernels::VolIntSingle: edge::seismic::kernels::VolInt < TL_
     //! number of non-zeros in the anelastic source matrices
     static unsigned short const TL_N_ENS_SRC_A = CE_N_ENS_SRC_A_DE( TL_N_DIS );
 
+    //! number of elements in a batch
+    static unsigned short const TL_N_BAT = N_BATCH_ELEMENTS;
+
     //! matrix kernels
     edge::data::MmXsmmSingle< TL_T_REAL > m_mm;
 
@@ -140,6 +143,20 @@ class edge::seismic::kernels::VolIntSingle: edge::seismic::kernels::VolInt < TL_
                   static_cast<TL_T_REAL>(1.0), // beta
                   LIBXSMM_GEMM_PREFETCH_NONE );
         }
+
+      // stiffness matrix, applied to a batch of elements
+      if( TL_N_RMS == 0 ) {
+        m_mm.add( 2,                                            // group
+                  TL_N_MDS,                                     // m
+                  TL_N_BAT * TL_N_QTS_E,                        // n
+                  CE_N_ELEMENT_MODES_CK( TL_T_EL, TL_O_SP, 1 ), // k
+                  TL_N_MDS,                                     // ldA
+                  TL_N_MDS,                                     // ldB
+                  TL_N_MDS,                                     // ldC
+                  static_cast<TL_T_REAL>(1.0),                  // alpha
+                  static_cast<TL_T_REAL>(0.0),                  // beta
+                  LIBXSMM_GEMM_PREFETCH_NONE );
+      }
     }
 
   public:
@@ -164,6 +181,13 @@ class edge::seismic::kernels::VolIntSingle: edge::seismic::kernels::VolInt < TL_
       generateKernels();
     }
 
+    /**
+     * Logs the telemetry of the matrix kernels, if compiled with PP_MMKERNEL_PERF.
+     **/
+    void logMmStats() const {
+      m_mm.logStats( "volume integration" );
+    }
+
     /**
      * Optimized volume contribution for single forward simulations.
      *
@@ -194,28 +218,28 @@ class edge::seismic::kernels::VolIntSingle: edge::seismic::kernels::VolInt < TL_
       // iterate over dimensions
       for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
         // stiffness and inverse mass matrix
-        m_mm.m_kernels[0][0]( m_stiff[l_di],
-                              i_tDofsE[0][0],
-                              o_scratch[0][0] );
+        m_mm.exec( 0, 0, m_stiff[l_di],
+                         i_tDofsE[0][0],
+                         o_scratch[0][0] );
 
         // star matrix
-        m_mm.m_kernels[0][1]( o_scratch[0][0],
-                              i_starE[l_di],
-                              io_dofsE[0][0] );
+        m_mm.exec( 0, 1, o_scratch[0][0],
+                         i_starE[l_di],
+                         io_dofsE[0][0] );
 
         if( TL_N_RMS > 0 ) {
           // anelastic star matrix
-          m_mm.m_kernels[1][0]( o_scratch[TL_N_QTS_M][0],
-                                i_starA[l_di],
-                                l_scratch[0][0] );
+          m_mm.exec( 1, 0, o_scratch[TL_N_QTS_M][0],
+                           i_starA[l_di],
+                           l_scratch[0][0] );
         }
       }
 
       for( unsigned short l_rm = 0; l_rm < TL_N_RMS; l_rm++ ) {
         // add contribution of source matrix
-        m_mm.m_kernels[1][1]( i_tDofsA[l_rm][0][0],
-                              i_srcA[l_rm],
-                              io_dofsE[0][0] );
+        m_mm.exec( 1, 1, i_tDofsA[l_rm][0][0],
+                         i_srcA[l_rm],
+                         io_dofsE[0][0] );
 
         // multiply with relaxation frequency and add
         for( unsigned short l_qt = 0; l_qt < TL_N_QTS_M; l_qt++ ) {
@@ -226,6 +250,37 @@ class edge::seismic::kernels::VolIntSingle: edge::seismic::kernels::VolInt < TL_
         }
       }
     }
+
+    /**
+     * Volume contribution of a batch of consecutive elements (elastic only, single forward run LIBXSMM version).
+     * The stiffness matrices are applied to all elements of the batch at once, the star matrices per element.
+     *
+     * @param i_starE elastic star matrices of the batch's elements.
+     * @param i_tDofsE time integrated elastic DOFs of the batch's elements.
+     * @param io_dofsE will be updated with the elastic volume contributions of the batch's elements.
+     * @param o_scratch will be used as scratch space for the computations.
+     **/
+    void applyBatch( TL_T_REAL const (*i_starE)[TL_N_DIS][TL_N_ENS_STAR_E],
+                     TL_T_REAL const (*i_tDofsE)[TL_N_QTS_E][TL_N_MDS][1],
+                     TL_T_REAL       (*io_dofsE)[TL_N_QTS_E][TL_N_MDS][1],
+                     TL_T_REAL       (*o_scratch)[TL_N_QTS_E][TL_N_MDS][1] ) const {
+      EDGE_CHECK_EQ( TL_N_RMS, 0 );
+
+      // iterate over dimensions
+      for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+        // multiply all elements with stiffness and inverse mass matrix
+        m_mm.exec( 2, 0, m_stiff[l_di],
+                         i_tDofsE[0][0][0],
+                         o_scratch[0][0][0] );
+
+        // multiply with the elements' star matrices
+        for( unsigned short l_el = 0; l_el < TL_N_BAT; l_el++ ) {
+          m_mm.exec( 0, 1, o_scratch[l_el][0][0],
+                           i_starE[l_el][l_di],
+                           io_dofsE[l_el][0][0] );
+        }
+      }
+    }
 };
 
 #endif
\ No newline at end of file
@@ -28,7 +28,11 @@
 
 #include "VolInt.hpp"
 #include "dg/Basis.h"
+#if defined(PP_T_KERNELS_SIMD)
+#include "data/MmSimd.hpp"
+#else
 #include "data/MmVanilla.hpp"
+#endif
 
 namespace edge {
   namespace seismic {
@@ -84,8 +88,16 @@ class edge::seismic::kernels::VolIntVanilla: edge::seismic::kernels::VolInt < TL
     //! number of non-zeros in the anelastic source matrices
     static unsigned short const TL_N_ENS_SRC_A = CE_N_ENS_SRC_A_DE( TL_N_DIS );
 
+    //! number of elements in a batch
+    static unsigned short const TL_N_BAT = N_BATCH_ELEMENTS;
+
+#if defined(PP_T_KERNELS_SIMD)
+    //! matrix kernels, vectorized over the fused simulations (or the modes if not fused)
+    edge::data::MmSimd< TL_T_REAL, TL_N_CRS > m_mm;
+#else
     //! matrix kernels
     edge::data::MmVanilla< TL_T_REAL > m_mm;
+#endif
 
     //! pointers to the stiffness matrices
     TL_T_REAL *m_stiff[TL_N_DIS] = {};
@@ -151,6 +163,22 @@ class edge::seismic::kernels::VolIntVanilla: edge::seismic::kernels::VolInt < TL
                   true,           // fused BC
                   TL_N_CRS );
         }
+
+      // stiffness matrix, applied to a batch of elements
+      if( TL_N_RMS == 0 ) {
+        m_mm.add( 2,                                            // group
+                  TL_N_BAT * TL_N_QTS_E,                        // m
+                  TL_N_MDS,                                     // n
+                  CE_N_ELEMENT_MODES_CK( TL_T_EL, TL_O_SP, 1 ), // k
+                  TL_N_MDS,                                     // ldA
+                  TL_N_MDS,                                     // ldB
+                  TL_N_MDS,                                     // ldC
+                  TL_T_REAL(1.0),                               // alpha
+                  TL_T_REAL(0.0),                               // beta
+                  true,                                         // fused AC
+                  false,                                        // fused BC
+                  TL_N_CRS );
+      }
     }
 
   public:
@@ -239,6 +267,37 @@ class edge::seismic::kernels::VolIntVanilla: edge::seismic::kernels::VolInt < TL
         }
       }
     }
+
+    /**
+     * Volume contribution of a batch of consecutive elements (elastic only, vanilla implementation).
+     * The stiffness matrices are applied to all elements of the batch at once, the star matrices per element.
+     *
+     * @param i_starE elastic star matrices of the batch's elements.
+     * @param i_tDofsE time integrated elastic DOFs of the batch's elements.
+     * @param io_dofsE will be updated with the elastic volume contributions of the batch's elements.
+     * @param o_scratch will be used as scratch space for the computations.
+     **/
+    void applyBatch( TL_T_REAL const (*i_starE)[TL_N_DIS][TL_N_ENS_STAR_E],
+                     TL_T_REAL const (*i_tDofsE)[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                     TL_T_REAL       (*io_dofsE)[TL_N_QTS_E][TL_N_MDS][TL_N_CRS],
+                     TL_T_REAL       (*o_scratch)[TL_N_QTS_E][TL_N_MDS][TL_N_CRS] ) const {
+      EDGE_CHECK_EQ( TL_N_RMS, 0 );
+
+      // iterate over dimensions
+      for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ ) {
+        // multiply all elements with stiffness and inverse mass matrix
+        m_mm.m_kernels[2][0]( i_tDofsE[0][0][0],
+                              m_stiff[l_di],
+                              o_scratch[0][0][0] );
+
+        // multiply with the elements' star matrices
+        for( unsigned short l_el = 0; l_el < TL_N_BAT; l_el++ ) {
+          m_mm.m_kernels[0][1]( i_starE[l_el][l_di],
+                                o_scratch[l_el][0][0],
+                                io_dofsE[l_el][0][0] );
+        }
+      }
+    }
 };
 
 #endif
\ No newline at end of file
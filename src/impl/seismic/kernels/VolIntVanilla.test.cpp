@@ -59,6 +59,68 @@ TEST_CASE( "Elastic volume integration using vanilla kernels.", "[elastic][VolIn
   }
 }
 
+TEST_CASE( "Batched elastic volume integration using vanilla kernels.", "[elastic][VolIntVanilla]" ) {
+  // set up matrix structures
+#include "VolInt.test.inc"
+
+  // kernel
+  edge::data::Dynamic l_dynMem;
+  edge::seismic::kernels::VolIntVanilla< float,
+                                         0,
+                                         TET4,
+                                         4,
+                                         1 > l_volE( nullptr,
+                                                     l_dynMem );
+
+  // batch of elements with scaled star matrices and DOFs
+  float l_starBat[N_BATCH_ELEMENTS][3][81];
+  float l_tDofsBat[N_BATCH_ELEMENTS][9][20][1];
+  float l_dofsBat[N_BATCH_ELEMENTS][9][20][1];
+  float l_dofsRef[N_BATCH_ELEMENTS][9][20][1];
+
+  for( unsigned short l_el = 0; l_el < N_BATCH_ELEMENTS; l_el++ ) {
+    for( unsigned short l_di = 0; l_di < 3; l_di++ )
+      for( unsigned short l_en = 0; l_en < 81; l_en++ )
+        l_starBat[l_el][l_di][l_en] = (1 + 0.1f*l_el) * l_starE[l_di][l_en/9][l_en%9];
+
+    for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
+      for( unsigned short l_md = 0; l_md < 20; l_md++ ) {
+        l_tDofsBat[l_el][l_qt][l_md][0] = (1 - 0.05f*l_el) * l_tDofsE[l_qt][l_md];
+        l_dofsBat[l_el][l_qt][l_md][0]  = l_dofsE[l_qt][l_md] + l_el;
+        l_dofsRef[l_el][l_qt][l_md][0]  = l_dofsBat[l_el][l_qt][l_md][0];
+      }
+    }
+  }
+
+  // per-element reference
+  float l_scratch[N_BATCH_ELEMENTS][9][20][1];
+  for( unsigned short l_el = 0; l_el < N_BATCH_ELEMENTS; l_el++ ) {
+    l_volE.apply( l_starBat[l_el],
+                  nullptr,
+                  nullptr,
+                  l_tDofsBat[l_el],
+                  nullptr,
+                  l_dofsRef[l_el],
+                  nullptr,
+                  l_scratch[0] );
+  }
+
+  // batched kernel
+  l_volE.applyBatch( l_starBat,
+                     l_tDofsBat,
+                     l_dofsBat,
+                     l_scratch );
+
+  // check the results
+  for( unsigned short l_el = 0; l_el < N_BATCH_ELEMENTS; l_el++ ) {
+    for( unsigned short l_qt = 0; l_qt < 9; l_qt++ ) {
+      for( unsigned short l_md = 0; l_md < 20; l_md++ ) {
+        REQUIRE( l_dofsBat[l_el][l_qt][l_md][0] == Approx( l_dofsRef[l_el][l_qt][l_md][0] ) );
+      }
+    }
+  }
+}
+
 TEST_CASE( "Viscoelastic volume integration using vanilla kernels.", "[visco][VolIntVanilla]" ) {
   // set up matrix structures
 #include "VolInt.test.inc"
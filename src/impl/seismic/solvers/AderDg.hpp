@@ -27,6 +27,7 @@
 #define EDGE_SEISMIC_SOLVERS_ADER_DG_HPP
 
 #include <limits>
+#include <type_traits>
 #include "constants.hpp"
 #include "mesh/common.hpp"
 #include "impl/seismic/common.hpp"
@@ -34,6 +35,7 @@
 #include "linalg/Mappings.hpp"
 #include "../kernels/Kernels.hpp"
 #include "io/Receivers.h"
+#include "data/Dedup.hpp"
 #include "AderDgInit.hpp"
 
 namespace edge {
@@ -45,7 +47,8 @@ namespace edge {
                 unsigned short TL_O_SP,
                 unsigned short TL_O_TI,
                 unsigned short TL_N_CRS,
-                bool           TL_MATS_SP >
+                bool           TL_MATS_SP,
+                typename       TL_T_REAL_FA = TL_T_REAL >
       class AderDg;
     }
   }
@@ -61,6 +64,7 @@ namespace edge {
  * @paramt TL_O_TI temporal order.
  * @paramt TL_N_CRS number of fused simulations.
  * @paramt TL_MATS_SPARSE true if the element-local matrices are initialized as sparse.
+ * @paramt TL_T_REAL_FA storage precision of the face-local and communication buffers; converted from and to TL_T_REAL in the solver.
  **/
 template< typename       TL_T_REAL,
           unsigned short TL_N_RMS,
@@ -68,7 +72,8 @@ template< typename       TL_T_REAL,
           unsigned short TL_O_SP,
           unsigned short TL_O_TI,
           unsigned short TL_N_CRS,
-          bool           TL_MATS_SP >
+          bool           TL_MATS_SP,
+          typename       TL_T_REAL_FA >
 class edge::seismic::solvers::AderDg {
   private:
     //! number of dimensions
@@ -101,6 +106,9 @@ class edge::seismic::solvers::AderDg {
     //! number of subcells per DG-element
     static unsigned short const TL_N_SCS = CE_N_SUB_CELLS( TL_T_EL, TL_O_SP );
 
+    //! number of elements in a batch of the local step
+    static unsigned short const TL_N_BAT = N_BATCH_ELEMENTS;
+
     //! elastic star matrices
     static unsigned short const TL_N_ENS_STAR_E = (TL_MATS_SP) ? CE_N_ENS_STAR_E_SP( TL_N_DIS )
                                                                : CE_N_ENS_STAR_E_DE( TL_N_DIS );
@@ -124,6 +132,15 @@ class edge::seismic::solvers::AderDg {
     static unsigned short const TL_N_ENS_FS_A = CE_N_ENS_FS_A_DE( TL_N_DIS );
     TL_T_REAL (*m_fsA[2])[TL_N_FAS][TL_N_ENS_FS_A] = { nullptr, nullptr };
 
+    //! ids of the unique element-local matrices (star matrices, local flux solvers, source matrices), nullptr if not deduplicated
+    unsigned int *m_idsEl = nullptr;
+
+    //! ids of the unique neighboring flux solvers per element-face pair, nullptr if not deduplicated
+    unsigned int *m_idsFa = nullptr;
+
+    //! pre-computed face-local time integrated DOFs for on-node neighbors, nullptr for faces without
+    TL_T_REAL_FA (**m_tDofsFi)[TL_N_MDS_FA][TL_N_CRS] = nullptr;
+
     //! kernels
     kernels::Kernels< TL_T_REAL,
                       TL_N_RMS,
@@ -198,6 +215,409 @@ class edge::seismic::solvers::AderDg {
       }
     }
 
+    /**
+     * Gets the id of the element-local matrices.
+     *
+     * @param i_el element.
+     * @return id of the element's star matrices, local flux solvers and source matrices.
+     **/
+    std::size_t idEl( std::size_t i_el ) const {
+      return (m_idsEl == nullptr) ? i_el : m_idsEl[i_el];
+    }
+
+    /**
+     * Gets the id of a neighboring flux solver.
+     *
+     * @param i_el element.
+     * @param i_fa local face of the element.
+     * @return id of the neighboring flux solver, w.r.t. to the flattened element-face pairs.
+     **/
+    std::size_t idFa( std::size_t    i_el,
+                      unsigned short i_fa ) const {
+      return (m_idsFa == nullptr) ? i_el*TL_N_FAS + i_fa : m_idsFa[i_el*TL_N_FAS + i_fa];
+    }
+
+    /**
+     * Deduplicates the bitwise-identical element-local matrices and neighboring flux solvers.
+     * The per-element data is replaced by compact tables of the unique matrices, indexed by m_idsEl and m_idsFa.
+     *
+     * @param i_nEls number of elements.
+     * @param i_align alignment of the compact tables.
+     * @param io_dynMem dynamic memory allocations, holding the compact tables.
+     **/
+    void dedup( std::size_t     i_nEls,
+                std::size_t     i_align,
+                data::Dynamic & io_dynMem ) {
+      /*
+       * element-local matrices
+       */
+      unsigned char const *l_arsEl[5] = { (unsigned char const *) m_starE,
+                                          (unsigned char const *) m_fsE[0],
+                                          (unsigned char const *) m_srcA,
+                                          (unsigned char const *) m_starA,
+                                          (unsigned char const *) m_fsA[0] };
+      std::size_t l_nBytesEl[5] = { TL_N_DIS * TL_N_ENS_STAR_E * sizeof(TL_T_REAL),
+                                    TL_N_FAS * TL_N_ENS_FS_E   * sizeof(TL_T_REAL),
+                                    TL_N_RMS * TL_N_ENS_SRC_A  * sizeof(TL_T_REAL),
+                                    TL_N_DIS * TL_N_ENS_STAR_A * sizeof(TL_T_REAL),
+                                    TL_N_FAS * TL_N_ENS_FS_A   * sizeof(TL_T_REAL) };
+      unsigned short l_nArsEl = (TL_N_RMS > 0) ? 5 : 2;
+
+      m_idsEl = (unsigned int *) io_dynMem.allocate( i_nEls * sizeof(unsigned int) );
+      std::size_t l_nUnEl = data::Dedup::ids( i_nEls,
+                                              l_nArsEl,
+                                              l_nBytesEl,
+                                              l_arsEl,
+                                              m_idsEl );
+
+      unsigned char *l_unEl[5] = { nullptr, nullptr, nullptr, nullptr, nullptr };
+      for( unsigned short l_ar = 0; l_ar < l_nArsEl; l_ar++ ) {
+        l_unEl[l_ar] = (unsigned char *) io_dynMem.allocate( l_nUnEl * l_nBytesEl[l_ar],
+                                                             i_align,
+                                                             false,
+                                                             true );
+        data::Dedup::compact( i_nEls,
+                              l_nBytesEl[l_ar],
+                              m_idsEl,
+                              l_arsEl[l_ar],
+                              l_unEl[l_ar] );
+      }
+
+      m_starE  = ( TL_T_REAL (*) [TL_N_DIS][TL_N_ENS_STAR_E] ) l_unEl[0];
+      m_fsE[0] = ( TL_T_REAL (*) [TL_N_FAS][TL_N_ENS_FS_E]   ) l_unEl[1];
+      if( TL_N_RMS > 0 ) {
+        m_srcA   = ( TL_T_REAL (*) [TL_N_ENS_SRC_A]            ) l_unEl[2];
+        m_starA  = ( TL_T_REAL (*) [TL_N_DIS][TL_N_ENS_STAR_A] ) l_unEl[3];
+        m_fsA[0] = ( TL_T_REAL (*) [TL_N_FAS][TL_N_ENS_FS_A]   ) l_unEl[4];
+      }
+
+      /*
+       * neighboring flux solvers
+       */
+      unsigned char const *l_arsFa[2] = { (unsigned char const *) m_fsE[1],
+                                          (unsigned char const *) m_fsA[1] };
+      std::size_t l_nBytesFa[2] = { TL_N_ENS_FS_E * sizeof(TL_T_REAL),
+                                    TL_N_ENS_FS_A * sizeof(TL_T_REAL) };
+      unsigned short l_nArsFa = (TL_N_RMS > 0) ? 2 : 1;
+
+      m_idsFa = (unsigned int *) io_dynMem.allocate( i_nEls * TL_N_FAS * sizeof(unsigned int) );
+      std::size_t l_nUnFa = data::Dedup::ids( i_nEls * TL_N_FAS,
+                                              l_nArsFa,
+                                              l_nBytesFa,
+                                              l_arsFa,
+                                              m_idsFa );
+
+      unsigned char *l_unFa[2] = { nullptr, nullptr };
+      for( unsigned short l_ar = 0; l_ar < l_nArsFa; l_ar++ ) {
+        l_unFa[l_ar] = (unsigned char *) io_dynMem.allocate( l_nUnFa * l_nBytesFa[l_ar],
+                                                             i_align,
+                                                             false,
+                                                             true );
+        data::Dedup::compact( i_nEls * TL_N_FAS,
+                              l_nBytesFa[l_ar],
+                              m_idsFa,
+                              l_arsFa[l_ar],
+                              l_unFa[l_ar] );
+      }
+
+      m_fsE[1] = ( TL_T_REAL (*) [TL_N_FAS][TL_N_ENS_FS_E] ) l_unFa[0];
+      if( TL_N_RMS > 0 ) {
+        m_fsA[1] = ( TL_T_REAL (*) [TL_N_FAS][TL_N_ENS_FS_A] ) l_unFa[1];
+      }
+
+      EDGE_LOG_INFO << "    deduplicated ADER-DG matrices: "
+                    << l_nUnEl << " unique element-local sets for " << i_nEls << " elements, "
+                    << l_nUnFa << " unique neighboring flux solvers for " << i_nEls * TL_N_FAS << " element-face pairs";
+    }
+
+    /**
+     * Allocates the buffers of the face-local time integrated DOFs.
+     * The buffers are owned by the element computing them in the local step.
+     * Only faces with an adjacent element in the partition get a buffer,
+     * boundary conditions and MPI-faces use the time integrated DOFs or receive buffers.
+     * Buffers of faces, where the element has a greater time step than the adjacent one, hold two time intervals.
+     *
+     * @param i_nEls number of elements.
+     * @param i_faEl elements adjacent to faces.
+     * @param i_elFa faces adjacent to elements.
+     * @param i_faChars face characteristics.
+     * @param i_elChars element characteristics.
+     * @param i_rateMax maximum LTS rate, which is the number of time intervals of faces in greater-than LTS relations.
+     * @param i_align alignment of the buffers.
+     * @param io_dynMem dynamic memory allocations.
+     *
+     * @paramt TL_T_LID integral type of local ids.
+     **/
+    template< typename TL_T_LID >
+    void allocTDofsFi( std::size_t            i_nEls,
+                       TL_T_LID       const (* i_faEl)[2],
+                       TL_T_LID       const (* i_elFa)[TL_N_FAS],
+                       t_faceChars    const  * i_faChars,
+                       t_elementChars const  * i_elChars,
+                       unsigned short          i_rateMax,
+                       std::size_t             i_align,
+                       data::Dynamic         & io_dynMem ) {
+      // size of a single time interval
+      std::size_t l_sizeFa = std::size_t(TL_N_QTS_E) * TL_N_MDS_FA * TL_N_CRS;
+
+      // derive the number of time intervals and offsets of the buffers
+      unsigned short *l_nIvs = new unsigned short[i_nEls*TL_N_FAS];
+      std::size_t    *l_offs = new std::size_t[i_nEls*TL_N_FAS];
+      std::size_t     l_size = 0;
+
+      for( std::size_t l_el = 0; l_el < i_nEls; l_el++ ) {
+        for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ ) {
+          l_nIvs[l_el*TL_N_FAS + l_fa] = 0;
+          l_offs[l_el*TL_N_FAS + l_fa] = l_size;
+
+          TL_T_LID l_faId = i_elFa[l_el][l_fa];
+          if( l_faId == std::numeric_limits< TL_T_LID >::max() ) continue;
+
+          // boundary conditions and MPI-faces
+          if(    (i_faChars[l_faId].spType & OUTFLOW)      == OUTFLOW
+              || (i_faChars[l_faId].spType & FREE_SURFACE) == FREE_SURFACE
+              || i_faEl[l_faId][0] == std::numeric_limits< TL_T_LID >::max()
+              || i_faEl[l_faId][1] == std::numeric_limits< TL_T_LID >::max() ) continue;
+
+          // one interval per time step of the adjacent element, if the element has a greater time step than the adjacent one
+          if(    (i_elChars[l_el].spType & C_LTS_AD[l_fa][AD_EQ]) != C_LTS_AD[l_fa][AD_EQ]
+              && (i_elChars[l_el].spType & C_LTS_AD[l_fa][AD_LT]) != C_LTS_AD[l_fa][AD_LT] ) l_nIvs[l_el*TL_N_FAS + l_fa] = i_rateMax;
+          else                                                                             l_nIvs[l_el*TL_N_FAS + l_fa] = 1;
+
+          l_size += l_nIvs[l_el*TL_N_FAS + l_fa] * l_sizeFa;
+        }
+      }
+
+      // allocate pointers and raw data
+      m_tDofsFi = ( TL_T_REAL_FA (**) [TL_N_MDS_FA][TL_N_CRS] ) io_dynMem.allocate( i_nEls * TL_N_FAS * sizeof(TL_T_REAL_FA*) );
+
+      TL_T_REAL_FA *l_raw = nullptr;
+      if( l_size > 0 ) {
+        l_raw = (TL_T_REAL_FA *) io_dynMem.allocate( l_size * sizeof(TL_T_REAL_FA),
+                                                     i_align,
+                                                     false,
+                                                     true );
+      }
+
+      // assign pointers and zero-init the buffers (first touch by the owning threads)
+#ifdef PP_USE_OMP
+#pragma omp parallel for
+#endif
+      for( std::size_t l_el = 0; l_el < i_nEls; l_el++ ) {
+        for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ ) {
+          std::size_t l_id = l_el*TL_N_FAS + l_fa;
+
+          if( l_nIvs[l_id] == 0 ) {
+            m_tDofsFi[l_id] = nullptr;
+          }
+          else {
+            m_tDofsFi[l_id] = ( TL_T_REAL_FA (*) [TL_N_MDS_FA][TL_N_CRS] ) (l_raw + l_offs[l_id]);
+
+            for( std::size_t l_en = 0; l_en < l_nIvs[l_id] * l_sizeFa; l_en++ )
+              l_raw[l_offs[l_id] + l_en] = TL_T_REAL_FA( TL_T_REAL(0) );
+          }
+        }
+      }
+
+      delete[] l_nIvs;
+      delete[] l_offs;
+    }
+
+    /**
+     * Converts face-local time integrated DOFs between the compute and the storage precision.
+     *
+     * @param i_nQts number of quantities.
+     * @param i_src source data.
+     * @param o_dst will be set to the converted data.
+     *
+     * @paramt TL_T_SRC floating point type of the source.
+     * @paramt TL_T_DST floating point type of the destination.
+     **/
+    template< typename TL_T_SRC,
+              typename TL_T_DST >
+    static void convertFa( unsigned short         i_nQts,
+                           TL_T_SRC const       (*i_src)[TL_N_MDS_FA][TL_N_CRS],
+                           TL_T_DST             (*o_dst)[TL_N_MDS_FA][TL_N_CRS] ) {
+      for( unsigned short l_qt = 0; l_qt < i_nQts; l_qt++ )
+        for( unsigned short l_md = 0; l_md < TL_N_MDS_FA; l_md++ )
+#pragma omp simd
+          for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ )
+            o_dst[l_qt][l_md][l_cr] = TL_T_DST( i_src[l_qt][l_md][l_cr] );
+    }
+
+    /**
+     * Finalizes the time prediction of an element in the local step.
+     * Updates the LTS buffers, the face-local time integrated DOFs (incl. send buffers of MPI-faces) and the receivers.
+     *
+     * @param i_el element.
+     * @param i_stLt time step of the element within the cycle of the next larger time group (less-than LTS relations).
+     * @param i_rateLt rate of the next larger time group w.r.t. the element's one.
+     * @param i_rateGt rate of the element's time group w.r.t. the next smaller one (greater-than LTS relations).
+     * @param i_time time of the initial DOFs.
+     * @param i_dt time step.
+     * @param i_elChars element characteristics.
+     * @param i_vIdElFaEl vertex ids of the face-adjacent elements w.r.t. to the elements' vertex 0.
+     * @param i_der elastic time derivatives of the element.
+     * @param o_tDofs time integrated DG DOFs (==, <, >) which will be set or updated.
+     * @param o_sendDofs send buffers of the MPI-faces.
+     * @param io_recvs will be updated with receiver info.
+     * @param io_enRe sparse receiver entity, incremented if the element holds receivers.
+     * @param o_tmp will be used as scratch memory for the intermediate time integrals and the receivers.
+     *
+     * @paramt TL_T_LID integer type of local entity ids.
+     **/
+    template < typename TL_T_LID >
+    void localTimePred( TL_T_LID                             i_el,
+                        unsigned short                       i_stLt,
+                        unsigned short                       i_rateLt,
+                        unsigned short                       i_rateGt,
+                        double                               i_time,
+                        double                               i_dt,
+                        t_elementChars              const  * i_elChars,
+                        unsigned short const              (* i_vIdElFaEl)[TL_N_FAS],
+                        TL_T_REAL                         (* i_der)[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
+                        TL_T_REAL        (* const * const    o_tDofs[3])[TL_N_MDS_EL][TL_N_CRS],
+                        TL_T_REAL_FA     (* const * const    o_sendDofs)[TL_N_MDS_FA][TL_N_CRS],
+                        edge::io::Receivers                & io_recvs,
+                        unsigned int                       & io_enRe,
+                        TL_T_REAL                         (* o_tmp)[TL_N_MDS_EL][TL_N_CRS] ) const {
+      // update summed time integrated elastic DOFs, if an adjacent element has a larger time step
+      if( (i_elChars[i_el].spType & C_LTS_EL[EL_INT_LT]) == C_LTS_EL[EL_INT_LT] ) {
+        // reset, if required
+        if( i_stLt == 0 ) {
+          for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+            for( unsigned short l_md = 0; l_md < TL_N_MDS_EL; l_md++ )
+              for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ )
+                o_tDofs[1][i_el][l_qt][l_md][l_cr] = 0;
+        }
+
+        // add tDofs of this time step
+        for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+          for( unsigned short l_md = 0; l_md < TL_N_MDS_EL; l_md++ )
+            for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ )
+              o_tDofs[1][i_el][l_qt][l_md][l_cr] += o_tDofs[0][i_el][l_qt][l_md][l_cr];
+      }
+
+      // compute [0, dt/rate] time integrated DOFs, if an adjacent element has a smaller time step
+      if( (i_elChars[i_el].spType & C_LTS_EL[EL_INT_GT]) == C_LTS_EL[EL_INT_GT] ) {
+        m_kernels->m_time.integrate( TL_T_REAL(i_dt/i_rateGt),
+                                     i_der,
+                                     o_tDofs[2][i_el] );
+      }
+
+      // project the time integrated DOFs to the faces, shared with the adjacent elements
+      for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ ) {
+        unsigned short l_vId = i_vIdElFaEl[i_el][l_fa];
+
+        // send buffer of MPI-faces or face-local buffer of on-node neighbors
+        TL_T_REAL_FA (*l_tDofsFiSt)[TL_N_MDS_FA][TL_N_CRS] = m_tDofsFi[i_el*TL_N_FAS + l_fa];
+#ifdef PP_USE_MPI
+        if( o_sendDofs[i_el*TL_N_FAS + l_fa] != nullptr ) l_tDofsFiSt = o_sendDofs[i_el*TL_N_FAS + l_fa];
+#endif
+
+        if( l_tDofsFiSt != nullptr ) {
+          // the kernels write directly to the buffer, if stored in compute precision
+          TL_T_REAL l_tDofsFiCo[1][TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS];
+          TL_T_REAL (*l_tDofsFi)[TL_N_MDS_FA][TL_N_CRS] = l_tDofsFiCo[0];
+          if( std::is_same< TL_T_REAL, TL_T_REAL_FA >::value ) l_tDofsFi = (TL_T_REAL (*)[TL_N_MDS_FA][TL_N_CRS]) l_tDofsFiSt;
+          unsigned short l_nIvs = 1;
+
+          // gts
+          if( (i_elChars[i_el].spType & C_LTS_AD[l_fa][AD_EQ]) == C_LTS_AD[l_fa][AD_EQ] ) {
+            m_kernels->m_surfInt.neighFluxInt( std::numeric_limits< unsigned short >::max(),
+                                               l_vId,
+                                               l_fa,
+                                               o_tDofs[0][i_el],
+                                               l_tDofsFi );
+          }
+          // less than
+          else if( (i_elChars[i_el].spType & C_LTS_AD[l_fa][AD_LT]) == C_LTS_AD[l_fa][AD_LT] ) {
+            if( i_stLt == i_rateLt-1 ) {
+              m_kernels->m_surfInt.neighFluxInt( std::numeric_limits< unsigned short >::max(),
+                                                 l_vId,
+                                                 l_fa,
+                                                 o_tDofs[1][i_el],
+                                                 l_tDofsFi );
+            }
+            else l_nIvs = 0;
+          }
+          // greater than
+          else {
+            // projected integrals over [0, (iv+1)/rate dt], consecutive ones give the intervals [iv/rate dt, (iv+1)/rate dt]
+            TL_T_REAL l_tDofsFiCu[2][TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS];
+
+            for( unsigned short l_iv = 0; l_iv < i_rateGt; l_iv++ ) {
+              TL_T_REAL (*l_tDofsCu)[TL_N_MDS_EL][TL_N_CRS] = o_tDofs[0][i_el];
+              if( l_iv == 0 ) l_tDofsCu = o_tDofs[2][i_el];
+              else if( l_iv < i_rateGt-1 ) {
+                m_kernels->m_time.integrate( TL_T_REAL( (l_iv+1)*i_dt/i_rateGt ),
+                                             i_der,
+                                             o_tmp );
+                l_tDofsCu = o_tmp;
+              }
+
+              TL_T_REAL (*l_cu)[TL_N_MDS_FA][TL_N_CRS] = l_tDofsFiCu[l_iv%2];
+              m_kernels->m_surfInt.neighFluxInt( std::numeric_limits< unsigned short >::max(),
+                                                 l_vId,
+                                                 l_fa,
+                                                 l_tDofsCu,
+                                                 l_cu );
+
+              // move the integral from [0, (iv+1)/rate dt] to [iv/rate dt, (iv+1)/rate dt]
+              TL_T_REAL (*l_iv0)[TL_N_MDS_FA][TL_N_CRS] = l_tDofsFiCu[(l_iv+1)%2];
+              TL_T_REAL (*l_ivFi)[TL_N_MDS_FA][TL_N_CRS] = l_tDofsFi+l_iv*TL_N_QTS_E;
+              if( !std::is_same< TL_T_REAL, TL_T_REAL_FA >::value ) l_ivFi = l_tDofsFi;
+
+              for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ ) {
+                for( unsigned short l_md = 0; l_md < TL_N_MDS_FA; l_md++ ) {
+                  for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
+                    l_ivFi[l_qt][l_md][l_cr] = (l_iv == 0) ? l_cu[l_qt][l_md][l_cr] : l_cu[l_qt][l_md][l_cr] - l_iv0[l_qt][l_md][l_cr];
+                  }
+                }
+              }
+
+              if( !std::is_same< TL_T_REAL, TL_T_REAL_FA >::value ) {
+                convertFa( TL_N_QTS_E,
+                           l_ivFi,
+                           l_tDofsFiSt+l_iv*TL_N_QTS_E );
+              }
+            }
+
+            // the intervals are stored one by one
+            l_nIvs = 0;
+          }
+
+          // convert to the storage precision
+          if( !std::is_same< TL_T_REAL, TL_T_REAL_FA >::value ) {
+            convertFa( l_nIvs*TL_N_QTS_E,
+                       l_tDofsFi,
+                       l_tDofsFiSt );
+          }
+        }
+      }
+
+      // write receivers (if required)
+      if( !( (i_elChars[i_el].spType & RECEIVER) == RECEIVER) ) {} // no receivers in the current element
+      else { // we have receivers in the current element
+        while( true ) { // iterate of possible multiple receiver-ouput per time step
+          double l_rePt = io_recvs.getRecvTimeRel( io_enRe, i_time, i_dt );
+          if( !(l_rePt >= 0) ) break;
+          else {
+            TL_T_REAL l_rePts = l_rePt;
+            // eval time prediction at the given point
+            m_kernels->m_time.evalTimePrediction(  1,
+                                                 & l_rePts,
+                                                   i_der,
+                        (TL_T_REAL (*)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS])o_tmp );
+
+            // write this time prediction
+            io_recvs.writeRecvAll( io_enRe, o_tmp );
+          }
+        }
+        io_enRe++;
+      }
+    }
+
   public:
     /**
      * Initializes the ADER-DG solver.
@@ -218,6 +638,8 @@ class edge::seismic::solvers::AderDg {
      * @param i_bgParsRe background parameters of the receive elements.
      * @param i_freqCen central frequency for attenuation.
      * @param i_freqRat frequency ratio between upper and lower frequencies for attenuation.
+     * @param i_dedupMats if true, bitwise-identical star matrices and flux solvers are stored only once.
+     * @param i_rateMax maximum LTS rate of the time groups.
      * @param io_dynMem dynamic memory management.
      *
      * @paramt TL_T_LID integral type of local ids.
@@ -239,6 +661,8 @@ class edge::seismic::solvers::AderDg {
             t_bgPars       const  * i_bgParsRe,
             double                  i_freqCen,
             double                  i_freqRat,
+            bool                    i_dedupMats,
+            unsigned short          i_rateMax,
             data::Dynamic         & io_dynMem ) {
       // total number of elements
       std::size_t l_nEls = i_nElsIn + i_nElsSe;
@@ -266,10 +690,21 @@ class edge::seismic::solvers::AderDg {
         delete[] l_rfs;
       }
 
-      // allocate constant data
+      // allocate constant data, temporarily if deduplicated after the init
+      data::Dynamic l_tmpMem;
       alloc( l_nEls,
              ALIGNMENT.BASE.HEAP,
-             io_dynMem );
+             (i_dedupMats) ? l_tmpMem : io_dynMem );
+
+      // allocate the face-local time integrated DOFs
+      allocTDofsFi( l_nEls,
+                    i_faEl,
+                    i_elFa,
+                    i_faChars,
+                    i_elChars,
+                    i_rateMax,
+                    ALIGNMENT.BASE.HEAP,
+                    io_dynMem );
 
       // init anelastic source matrices and compute elastic Lame parameters in viscoelastic settings
       if( TL_N_RMS > 0 ) {
@@ -309,6 +744,13 @@ class edge::seismic::solvers::AderDg {
                                         i_bgParsRe,
                                         m_fsE,
                                         m_fsA );
+
+      // replace the per-element data with tables of unique matrices
+      if( i_dedupMats ) {
+        dedup( l_nEls,
+               ALIGNMENT.BASE.HEAP,
+               io_dynMem );
+      }
     }
 
     /**
@@ -318,12 +760,56 @@ class edge::seismic::solvers::AderDg {
       delete m_kernels;
     }
 
+    /**
+     * Gets an estimate of the floating point operations per element in the local step.
+     * Only available for the fused LIBXSMM kernels, which expose the operation counts of the generated kernels.
+     *
+     * @return number of floating point operations, 0 if not available.
+     **/
+    double flopsLocal() const {
+#if defined(PP_T_KERNELS_XSMM)
+      return   m_kernels->m_time.flops()
+             + m_kernels->m_volInt.flops()
+             + m_kernels->m_surfInt.flopsLocal();
+#else
+      return 0;
+#endif
+    }
+
+    /**
+     * Gets an estimate of the floating point operations per element in the neighboring step.
+     * Only available for the fused LIBXSMM kernels, which expose the operation counts of the generated kernels.
+     *
+     * @return number of floating point operations, 0 if not available.
+     **/
+    double flopsNeigh() const {
+#if defined(PP_T_KERNELS_XSMM)
+      return m_kernels->m_surfInt.flopsNeigh();
+#else
+      return 0;
+#endif
+    }
+
+    /**
+     * Logs the telemetry of the matrix kernels.
+     * Only available for the LIBXSMM kernels, which record their invocations and cycles if compiled with PP_MMKERNEL_PERF.
+     **/
+    void logMmStats() const {
+#if defined(PP_T_KERNELS_XSMM) || defined(PP_T_KERNELS_XSMM_DENSE_SINGLE)
+      m_kernels->m_time.logMmStats();
+      m_kernels->m_volInt.logMmStats();
+      m_kernels->m_surfInt.logMmStats();
+#endif
+    }
+
     /**
      * Local step: ADER + volume + local surface.
      *
      * @param i_first first element considered.
      * @param i_nEls number of elements.
-     * @param i_firstTs true if this is the first time step of every rate-2 ts pair.
+     * @param i_stLt time step of the elements within the cycle of the next larger time group (less-than LTS relations).
+     * @param i_rateLt rate of the next larger time group w.r.t. the elements' one.
+     * @param i_rateGt rate of the elements' time group w.r.t. the next smaller one (greater-than LTS relations).
      * @param i_time time of the initial DOFs.
      * @param i_dt time step.
      * @param i_firstSpRe first sparse receiver entity.
@@ -338,7 +824,9 @@ class edge::seismic::solvers::AderDg {
     template < typename TL_T_LID >
     void local( TL_T_LID                             i_first,
                 TL_T_LID                             i_nEls,
-                bool                                 i_firstTs,
+                unsigned short                       i_stLt,
+                unsigned short                       i_rateLt,
+                unsigned short                       i_rateGt,
                 double                               i_time,
                 double                               i_dt,
                 TL_T_LID                             i_firstSpRe,
@@ -347,7 +835,7 @@ class edge::seismic::solvers::AderDg {
                 TL_T_REAL                         (* io_dofsE)[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
                 TL_T_REAL                         (* io_dofsA)[TL_N_MDS_EL][TL_N_CRS],
                 TL_T_REAL        (* const * const    o_tDofs[3])[TL_N_MDS_EL][TL_N_CRS],
-                TL_T_REAL        (* const * const    o_sendDofs)[TL_N_MDS_FA][TL_N_CRS],
+                TL_T_REAL_FA     (* const * const    o_sendDofs)[TL_N_MDS_FA][TL_N_CRS],
                 edge::io::Receivers                & io_recvs ) const {
       // counter for receivers
       unsigned int l_enRe = i_firstSpRe;
@@ -358,8 +846,98 @@ class edge::seismic::solvers::AderDg {
       // buffer for derivatives
       TL_T_REAL (*l_derBuffer)[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS] = parallel::g_scratchMem->dBuf;
 
-      // iterate over all elements
-      for( TL_T_LID l_el = i_first; l_el < i_first+i_nEls; l_el++ ) {
+      // first element, which is not processed as part of a batch
+      TL_T_LID l_el = i_first;
+
+#if !defined(PP_T_KERNELS_XSMM)
+      // process full batches of consecutive elements, which share the stiffness and flux matrices
+      if( TL_N_RMS == 0 ) {
+        // batched derivatives, time integrated DOFs and scratch memory
+        TL_T_REAL (*l_derBat)[TL_N_BAT][TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS] = parallel::g_scratchMem->dBufBat;
+        TL_T_REAL (*l_tmpBat)[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS] = parallel::g_scratchMem->tResBat;
+        TL_T_REAL (*l_tmpFaBat)[TL_N_BAT][TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS] = parallel::g_scratchMem->tResSurfBat;
+
+        // gathered star matrices and local flux solvers of a batch with deduplicated matrices
+        TL_T_REAL l_starGa[TL_N_BAT][TL_N_DIS][TL_N_ENS_STAR_E];
+        TL_T_REAL l_fsGa[TL_N_BAT][TL_N_FAS][TL_N_ENS_FS_E];
+
+        for( ; l_el+TL_N_BAT <= i_first+i_nEls; l_el += TL_N_BAT ) {
+          // batched kernels require the time integrated DOFs to be contiguous
+          TL_T_REAL (*l_tDofsBat)[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS] =
+            (TL_T_REAL (*) [TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS]) o_tDofs[0][l_el];
+          if( o_tDofs[0][l_el+TL_N_BAT-1] != l_tDofsBat[TL_N_BAT-1] ) break;
+
+          // star matrices and local flux solvers of the batch
+          TL_T_REAL (*l_starBat)[TL_N_DIS][TL_N_ENS_STAR_E] = m_starE+l_el;
+          TL_T_REAL (*l_fsBat)[TL_N_FAS][TL_N_ENS_FS_E] = m_fsE[0]+l_el;
+
+          if( m_idsEl != nullptr ) {
+            for( unsigned short l_ba = 0; l_ba < TL_N_BAT; l_ba++ ) {
+              std::size_t l_id = idEl( l_el+l_ba );
+              for( unsigned short l_di = 0; l_di < TL_N_DIS; l_di++ )
+                for( unsigned short l_en = 0; l_en < TL_N_ENS_STAR_E; l_en++ )
+                  l_starGa[l_ba][l_di][l_en] = m_starE[l_id][l_di][l_en];
+              for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ )
+                for( unsigned short l_en = 0; l_en < TL_N_ENS_FS_E; l_en++ )
+                  l_fsGa[l_ba][l_fa][l_en] = m_fsE[0][l_id][l_fa][l_en];
+            }
+            l_starBat = l_starGa;
+            l_fsBat = l_fsGa;
+          }
+
+          // compute ADER time integration
+          m_kernels->m_time.ckBatch( i_dt,
+                                     l_starBat,
+                                     io_dofsE+l_el,
+                                     l_tmpBat,
+                                     l_derBat,
+                                     l_tDofsBat );
+
+          for( unsigned short l_ba = 0; l_ba < TL_N_BAT; l_ba++ ) {
+            // gather the element's derivatives, if required by the integration or receivers
+            if(    (i_elChars[l_el+l_ba].spType & C_LTS_EL[EL_INT_GT]) == C_LTS_EL[EL_INT_GT]
+                || (i_elChars[l_el+l_ba].spType & RECEIVER) == RECEIVER ) {
+              for( unsigned short l_de = 0; l_de < TL_O_TI; l_de++ )
+                for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
+                  for( unsigned short l_md = 0; l_md < TL_N_MDS_EL; l_md++ )
+                    for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ )
+                      l_derBuffer[l_de][l_qt][l_md][l_cr] = l_derBat[l_de][l_ba][l_qt][l_md][l_cr];
+            }
+
+            // LTS buffers, send buffers and receivers
+            localTimePred( l_el+l_ba,
+                           i_stLt,
+                           i_rateLt,
+                           i_rateGt,
+                           i_time,
+                           i_dt,
+                           i_elChars,
+                           i_vIdElFaEl,
+                           l_derBuffer,
+                           o_tDofs,
+                           o_sendDofs,
+                           io_recvs,
+                           l_enRe,
+                           l_tmp );
+          }
+
+          // compute volume integral
+          m_kernels->m_volInt.applyBatch( l_starBat,
+                                          l_tDofsBat,
+                                          io_dofsE+l_el,
+                                          l_tmpBat );
+
+          // compute local surface contribution
+          m_kernels->m_surfInt.localBatch( l_fsBat,
+                                           l_tDofsBat,
+                                           io_dofsE+l_el,
+                                           l_tmpFaBat );
+        }
+      }
+#endif
+
+      // iterate over the remaining elements
+      for( ; l_el < i_first+i_nEls; l_el++ ) {
         // pointer to anelastic dofs
         TL_T_REAL (*l_dofsA)[TL_N_QTS_M][TL_N_MDS_EL][TL_N_CRS] =
           (TL_T_REAL (*) [TL_N_QTS_M][TL_N_MDS_EL][TL_N_CRS]) (io_dofsA+l_el*std::size_t(TL_N_RMS)*std::size_t(TL_N_QTS_M));
@@ -367,11 +945,14 @@ class edge::seismic::solvers::AderDg {
         TL_T_REAL l_tDofsA[CE_MAX(int(TL_N_RMS),1)][TL_N_QTS_M][TL_N_MDS_EL][TL_N_CRS];
         TL_T_REAL l_derA[CE_MAX(int(TL_N_RMS),1)][TL_O_SP][TL_N_QTS_M][TL_N_MDS_EL][TL_N_CRS];
 
+        // id of the element-local matrices
+        std::size_t l_id = idEl( l_el );
+
         // compute ADER time integration
         m_kernels->m_time.ck( i_dt,
-                              m_starE[l_el],
-                              (TL_N_RMS > 0) ? m_starA[l_el] : nullptr,
-                              m_srcA+l_el*std::size_t(TL_N_RMS),
+                              m_starE[l_id],
+                              (TL_N_RMS > 0) ? m_starA[l_id] : nullptr,
+                              m_srcA+l_id*std::size_t(TL_N_RMS),
                               io_dofsE[l_el],
                               l_dofsA,
                               l_tmp,
@@ -380,105 +961,26 @@ class edge::seismic::solvers::AderDg {
                               o_tDofs[0][l_el],
                               l_tDofsA );
 
-        // update summed time integrated elastic DOFs, if an adjacent element has a larger time step
-        if( (i_elChars[l_el].spType & C_LTS_EL[EL_INT_LT]) == C_LTS_EL[EL_INT_LT] ) {
-          // reset, if required
-          if( i_firstTs ) {
-            for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
-              for( unsigned short l_md = 0; l_md < TL_N_MDS_EL; l_md++ )
-                for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ )
-                  o_tDofs[1][l_el][l_qt][l_md][l_cr] = 0;
-          }
-
-          // add tDofs of this time step
-          for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ )
-            for( unsigned short l_md = 0; l_md < TL_N_MDS_EL; l_md++ )
-              for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ )
-                o_tDofs[1][l_el][l_qt][l_md][l_cr] += o_tDofs[0][l_el][l_qt][l_md][l_cr];
-        }
-
-        // compute [0, 0.5dt] time integrated DOFs, if an adjacent element has a smaller time step
-        if( (i_elChars[l_el].spType & C_LTS_EL[EL_INT_GT]) == C_LTS_EL[EL_INT_GT] ) {
-          m_kernels->m_time.integrate( TL_T_REAL(0.5*i_dt),
-                                       l_derBuffer,
-                                       o_tDofs[2][l_el] );
-        }
-
-#ifdef PP_USE_MPI
-        for( unsigned short l_fa = 0; l_fa < TL_N_FAS; l_fa++ ) {
-          unsigned short l_vId = i_vIdElFaEl[l_el][l_fa];
-
-          if( o_sendDofs[l_el*TL_N_FAS + l_fa] != nullptr ) {
-            // gts
-            if( (i_elChars[l_el].spType & C_LTS_AD[l_fa][AD_EQ]) == C_LTS_AD[l_fa][AD_EQ] ) {
-              m_kernels->m_surfInt.neighFluxInt( std::numeric_limits< unsigned short >::max(),
-                                                 l_vId,
-                                                 l_fa,
-                                                 o_tDofs[0][l_el],
-                                                 o_sendDofs[l_el*TL_N_FAS + l_fa] );
-            }
-            // less than
-            else if( (i_elChars[l_el].spType & C_LTS_AD[l_fa][AD_LT]) == C_LTS_AD[l_fa][AD_LT] ) {
-              if( !i_firstTs ) {
-                m_kernels->m_surfInt.neighFluxInt( std::numeric_limits< unsigned short >::max(),
-                                                   l_vId,
-                                                   l_fa,
-                                                   o_tDofs[1][l_el],
-                                                   o_sendDofs[l_el*TL_N_FAS + l_fa] );
-              }
-            }
-            // greater than
-            else {
-              m_kernels->m_surfInt.neighFluxInt( std::numeric_limits< unsigned short >::max(),
-                                                 l_vId,
-                                                 l_fa,
-                                                 o_tDofs[2][l_el],
-                                                 o_sendDofs[l_el*TL_N_FAS + l_fa] );
-
-              m_kernels->m_surfInt.neighFluxInt( std::numeric_limits< unsigned short >::max(),
-                                                 l_vId,
-                                                 l_fa,
-                                                 o_tDofs[0][l_el],
-                                                 o_sendDofs[l_el*TL_N_FAS + l_fa]+TL_N_QTS_E );
-
-              // move second integral from [0, dt] to [1/2dt, dt]
-              for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ ) {
-                for( unsigned short l_md = 0; l_md < TL_N_MDS_FA; l_md++ ) {
-                  for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
-                    o_sendDofs[l_el*TL_N_FAS + l_fa][TL_N_QTS_E+l_qt][l_md][l_cr] -= o_sendDofs[l_el*TL_N_FAS + l_fa][l_qt][l_md][l_cr];
-                  }
-                }
-              }
-            }
-          }
-        }
-#endif
-
-        // write receivers (if required)
-        if( !( (i_elChars[l_el].spType & RECEIVER) == RECEIVER) ) {} // no receivers in the current element
-        else { // we have receivers in the current element
-          while( true ) { // iterate of possible multiple receiver-ouput per time step
-            double l_rePt = io_recvs.getRecvTimeRel( l_enRe, i_time, i_dt );
-            if( !(l_rePt >= 0) ) break;
-            else {
-              TL_T_REAL l_rePts = l_rePt;
-              // eval time prediction at the given point
-              m_kernels->m_time.evalTimePrediction(  1,
-                                                   & l_rePts,
-                                                     l_derBuffer,
-                          (TL_T_REAL (*)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS])l_tmp );
-
-              // write this time prediction
-              io_recvs.writeRecvAll( l_enRe, l_tmp );
-            }
-          }
-          l_enRe++;
-        }
+        // LTS buffers, send buffers and receivers
+        localTimePred( l_el,
+                       i_stLt,
+                       i_rateLt,
+                       i_rateGt,
+                       i_time,
+                       i_dt,
+                       i_elChars,
+                       i_vIdElFaEl,
+                       l_derBuffer,
+                       o_tDofs,
+                       o_sendDofs,
+                       io_recvs,
+                       l_enRe,
+                       l_tmp );
 
         // compute volume integral
-        m_kernels->m_volInt.apply( m_starE[l_el],
-                                   (TL_N_RMS > 0) ? m_starA[l_el] : nullptr,
-                                   m_srcA+l_el*std::size_t(TL_N_RMS),
+        m_kernels->m_volInt.apply( m_starE[l_id],
+                                   (TL_N_RMS > 0) ? m_starA[l_id] : nullptr,
+                                   m_srcA+l_id*std::size_t(TL_N_RMS),
                                    o_tDofs[0][l_el],
                                    l_tDofsA,
                                    io_dofsE[l_el],
@@ -504,8 +1006,8 @@ class edge::seismic::solvers::AderDg {
         // reuse derivative buffer
         TL_T_REAL (*l_tmpFa)[N_QUANTITIES][N_FACE_MODES][N_CRUNS] = parallel::g_scratchMem->tResSurf;
         // call kernel
-        m_kernels->m_surfInt.local( m_fsE[0][l_el],
-                                    (TL_N_RMS > 0) ? m_fsA[0][l_el] : nullptr,
+        m_kernels->m_surfInt.local( m_fsE[0][l_id],
+                                    (TL_N_RMS > 0) ? m_fsA[0][l_id] : nullptr,
                                     o_tDofs[0][l_el],
                                     io_dofsE[l_el],
                                     l_dofsA,
@@ -517,17 +1019,19 @@ class edge::seismic::solvers::AderDg {
 
     /**
      * Performs the neighboring updates of the ADER-DG scheme.
+     * Adjacent elements in the partition contribute through the face-local time integrated DOFs of the local step.
      *
      * @param i_first first element considered.
      * @param i_nEls number of elements.
-     * @param i_firstTs true if this is the first time step of every rate-2 ts pair.
+     * @param i_stLt time step of the elements within the cycle of the next larger time group (less-than LTS relations).
+     * @param i_rateLt rate of the next larger time group w.r.t. the elements' one.
      * @param i_faChars face characteristics.
      * @param i_elChars element characteristics.
      * @param i_elFa elements' adjacent faces.
      * @param i_elFaEl face-neighboring elements.
      * @param i_fIdElFaEl local face ids of face-neighboring elememts.
      * @param i_vIdElFaEl local vertex ids w.r.t. the shared face from the neighboring elements' perspsective.
-     * @param i_tDofs time integrated DG DOFs (==, <, >).
+     * @param i_tDofs time integrated DG DOFs (==, <, >), used for faces without face-local buffers, e.g., at the free surface.
      * @param io_dofs DOFs which will be updated with neighboring elements' contribution.
      *
      * @paramt TL_T_LID integer type of local entity ids.
@@ -535,7 +1039,8 @@ class edge::seismic::solvers::AderDg {
     template< typename TL_T_LID >
     void neigh( TL_T_LID                              i_first,
                 TL_T_LID                              i_nEls,
-                bool                                  i_firstTs,
+                unsigned short                        i_stLt,
+                unsigned short                        i_rateLt,
                 t_faceChars    const                * i_faChars,
                 t_elementChars const                * i_elChars,
                 TL_T_LID       const               (* i_elFa)[TL_N_FAS],
@@ -545,7 +1050,7 @@ class edge::seismic::solvers::AderDg {
                 TL_T_REAL            (* const * const i_tDofs[3])[TL_N_MDS_EL][TL_N_CRS],
                 TL_T_REAL                          (* io_dofsE)[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS],
                 TL_T_REAL                          (* io_dofsA)[TL_N_MDS_EL][TL_N_CRS],
-                TL_T_REAL      const (* const * const i_recvDofs)[TL_N_MDS_FA][TL_N_CRS] ) const {
+                TL_T_REAL_FA   const (* const * const i_recvDofs)[TL_N_MDS_FA][TL_N_CRS] ) const {
       // temporary product for three-way mult
       TL_T_REAL (*l_tmpFa)[N_QUANTITIES][N_FACE_MODES][N_CRUNS] = parallel::g_scratchMem->tResSurf;
 
@@ -576,24 +1081,42 @@ class edge::seismic::solvers::AderDg {
              * prefetches
              */
             const TL_T_REAL (* l_pre)[TL_N_MDS_EL][TL_N_CRS] = nullptr;
-            TL_T_LID l_neUp = std::numeric_limits<TL_T_LID>::max();
-            // prefetch for the upcoming surface integration of this element
-            if( l_fa < TL_N_FAS-1 ) l_neUp = i_elFaEl[l_el][l_fa+1];
-            // first surface integration of the next element
-            else if( l_el < i_first+i_nEls-1 ) l_neUp = i_elFaEl[l_el+1][0];
-
-            // only proceed with adjacent data if the element exists
-            if( l_neUp != std::numeric_limits<TL_T_LID>::max() ) l_pre = i_tDofs[0][l_neUp];
-            // next element data in case of boundary conditions
-            else if( l_el < i_first+i_nEls-1 )              l_pre = io_dofsE[l_el+1];
+            // adjacent data is read from the face-local buffers, thus prefetch the DOFs of the next element
+            if( l_el < i_first+i_nEls-1 ) l_pre = io_dofsE[l_el+1];
             // default to element data to avoid performance penality
-            else                                                 l_pre = io_dofsE[l_el];
+            else                          l_pre = io_dofsE[l_el];
 
             // assemble the neighboring time integrated DOFs
             TL_T_REAL l_tDofs[TL_N_QTS_E][TL_N_MDS_EL][TL_N_CRS];
-            TL_T_REAL const (*l_tDofsFiE)[TL_N_MDS_FA][TL_N_CRS] = nullptr;
+            TL_T_REAL_FA const (*l_tDofsFiSt)[TL_N_MDS_FA][TL_N_CRS] = nullptr;
+
+            // offset of the second time interval in the face-local buffers
+            std::size_t l_off = 0;
+            if( (i_elChars[l_el].spType & C_LTS_AD[l_fa][AD_LT]) == C_LTS_AD[l_fa][AD_LT] ) {
+              l_off = std::size_t(i_stLt) * TL_N_QTS_E;
+            }
+
+            // face of the adjacent element, owning the pre-computed face-local buffer
+            unsigned short l_neFa = std::numeric_limits< unsigned short >::max();
+            if( (i_faChars[l_faId].spType & FREE_SURFACE) != FREE_SURFACE ) l_neFa = i_fIdElFaEl[l_el][l_fa];
+
+            if( i_recvDofs != nullptr && i_recvDofs[l_el*TL_N_FAS + l_fa] != nullptr ) {
+#ifdef PP_USE_MPI
+              l_tDofsFiSt = i_recvDofs[l_el*TL_N_FAS + l_fa]+l_off;
+#else
+              EDGE_LOG_FATAL;
+#endif
+            }
+            else if(    l_neFa < TL_N_FAS
+                     && m_tDofsFi[l_ne*TL_N_FAS + l_neFa] != nullptr ) {
+              l_tDofsFiSt = m_tDofsFi[l_ne*TL_N_FAS + l_neFa]+l_off;
+            }
+            // free surface (and faces without buffers): assemble the time integrated DOFs
+            else {
+              // the element-wise LTS buffers hold the first and, for rate-2 LTS, the last interval only
+              EDGE_CHECK(    (i_elChars[l_el].spType & C_LTS_AD[l_fa][AD_LT]) != C_LTS_AD[l_fa][AD_LT]
+                          || i_stLt == 0 || i_rateLt == 2 );
 
-            if( i_recvDofs == nullptr || i_recvDofs[l_el*TL_N_FAS + l_fa] == nullptr ) {
               for( unsigned short l_qt = 0; l_qt < TL_N_QTS_E; l_qt++ ) {
                 for( unsigned short l_md = 0; l_md < TL_N_MDS_EL; l_md++ ) {
                   for( unsigned short l_cr = 0; l_cr < TL_N_CRS; l_cr++ ) {
@@ -607,7 +1130,7 @@ class edge::seismic::solvers::AderDg {
                     }
                     // element has a time step less than the adjacent one
                     else {
-                      if( i_firstTs )
+                      if( i_stLt == 0 )
                         l_tDofs[l_qt][l_md][l_cr] = i_tDofs[2][l_ne][l_qt][l_md][l_cr];
                       else
                         l_tDofs[l_qt][l_md][l_cr] = i_tDofs[0][l_ne][l_qt][l_md][l_cr] - i_tDofs[2][l_ne][l_qt][l_md][l_cr];
@@ -616,19 +1139,16 @@ class edge::seismic::solvers::AderDg {
                 }
               }
             }
-#ifdef PP_USE_MPI
-            else {
-              // derive offset
-              std::size_t l_off = 0;
-              if( (i_elChars[l_el].spType & C_LTS_AD[l_fa][AD_LT]) == C_LTS_AD[l_fa][AD_LT] ) {
-                l_off = (i_firstTs) ? 0 : TL_N_QTS_E;
-              }
-
-              l_tDofsFiE = i_recvDofs[l_el*TL_N_FAS + l_fa]+l_off;
+            // face-local time integrated DOFs in compute precision
+            TL_T_REAL l_tDofsFiCo[TL_N_QTS_E][TL_N_MDS_FA][TL_N_CRS];
+            TL_T_REAL const (*l_tDofsFiE)[TL_N_MDS_FA][TL_N_CRS] = (TL_T_REAL const (*)[TL_N_MDS_FA][TL_N_CRS]) l_tDofsFiSt;
+            if( l_tDofsFiSt != nullptr && !std::is_same< TL_T_REAL, TL_T_REAL_FA >::value ) {
+              convertFa( TL_N_QTS_E,
+                         l_tDofsFiSt,
+                         l_tDofsFiCo );
+              l_tDofsFiE = l_tDofsFiCo;
             }
-#else
-            else EDGE_LOG_FATAL;
-#endif
+
             /*
              * solve
              */
@@ -641,11 +1161,14 @@ class edge::seismic::solvers::AderDg {
               l_fId = i_fIdElFaEl[l_el][l_fa];
             }
 
+            // id of the neighboring flux solvers
+            std::size_t l_idFs = idFa( l_el, l_fa );
+
             m_kernels->m_surfInt.neigh( l_fa,
                                         l_vId,
                                         l_fId,
-                                        m_fsE[1][l_el][l_fa],
-                                        (TL_N_RMS > 0) ? m_fsA[1][l_el][l_fa] : nullptr,
+                                        ( (TL_T_REAL (*) [TL_N_ENS_FS_E]) m_fsE[1] )[l_idFs],
+                                        (TL_N_RMS > 0) ? ( (TL_T_REAL (*) [TL_N_ENS_FS_A]) m_fsA[1] )[l_idFs] : nullptr,
                                         l_tDofs,
                                         l_tDofsFiE,
                                         io_dofsE[l_el],
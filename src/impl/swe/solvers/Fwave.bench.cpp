@@ -0,0 +1,105 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Throughput benchmark of the f-wave solver.
+ **/
+#include "monitor/Bench.hpp"
+#include "data/Dynamic.h"
+#include "Fwave.hpp"
+#include <cstdlib>
+
+namespace edge {
+  namespace swe {
+    namespace solvers {
+      namespace bench {
+        /**
+         * Measures the throughput of the f-wave solver for the faces of a large synthetic mesh.
+         * The left and right states are gathered from the adjacent elements as in the finite volume solver.
+         *
+         * @param io_recs records of the results will be appended.
+         **/
+        void fwave( std::vector< monitor::Bench::Record > & io_recs );
+      }
+    }
+  }
+}
+
+void edge::swe::solvers::bench::fwave( std::vector< monitor::Bench::Record > & io_recs ) {
+  // element arrays of ~256MiB, two faces per element
+  std::size_t l_nEls = ( std::size_t(256) << 20 ) / ( ( 2 * N_CRUNS + 1 ) * sizeof(real_base) );
+  std::size_t l_nFas = 2 * l_nEls;
+
+  data::Dynamic l_dynMem;
+
+  real_base (*l_dofs)[2][N_CRUNS] = (real_base (*)[2][N_CRUNS]) l_dynMem.allocate( l_nEls * 2 * N_CRUNS * sizeof(real_base) );
+  real_base *l_bath = (real_base*) l_dynMem.allocate( l_nEls * sizeof(real_base) );
+  real_base (*l_nus)[2][2][N_CRUNS] = (real_base (*)[2][2][N_CRUNS]) l_dynMem.allocate( l_nFas * 4 * N_CRUNS * sizeof(real_base) );
+  std::size_t (*l_faEl)[2] = (std::size_t (*)[2]) l_dynMem.allocate( l_nFas * 2 * sizeof(std::size_t) );
+
+  // wet elements with random heights and momenta
+  std::srand( 1234 );
+  for( std::size_t l_el = 0; l_el < l_nEls; l_el++ ) {
+    for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ ) {
+      l_dofs[l_el][0][l_cr] = real_base(1) + real_base(9) * std::rand() / RAND_MAX;
+      l_dofs[l_el][1][l_cr] = real_base(2) * std::rand() / RAND_MAX - real_base(1);
+    }
+    l_bath[l_el] = -real_base(100) * std::rand() / RAND_MAX;
+  }
+
+  // face-adjacent elements, neighbors spread over the arrays
+  for( std::size_t l_fa = 0; l_fa < l_nFas; l_fa++ ) {
+    l_faEl[l_fa][0] = l_fa / 2;
+    l_faEl[l_fa][1] = ( l_fa / 2 + ( (l_fa % 2 == 0) ? 1 : 997 ) ) % l_nEls;
+  }
+
+  std::size_t l_nReps = 0;
+  double l_time = monitor::Bench::time( [&]() {
+    for( std::size_t l_fa = 0; l_fa < l_nFas; l_fa++ ) {
+      std::size_t l_elL = l_faEl[l_fa][0];
+      std::size_t l_elR = l_faEl[l_fa][1];
+
+      Fwave< N_CRUNS >::nusN( l_dofs[l_elL][0], l_dofs[l_elR][0],
+                              l_dofs[l_elL][1], l_dofs[l_elR][1],
+                              l_bath[l_elL],    l_bath[l_elR],
+                              l_nus[l_fa][0],   l_nus[l_fa][1] );
+    }
+  }, 1.0, l_nReps );
+
+  // read the adjacency and both states, write the net-updates
+  double l_bytes = 2.0 * sizeof(std::size_t) + ( 2 * ( 2.0 * N_CRUNS + 1 ) + 4.0 * N_CRUNS ) * sizeof(real_base);
+
+  monitor::Bench::Record l_rec;
+  l_rec.add( "kernel", "nusN" )
+       .add( "n_faces", (double) l_nFas )
+       .add( "n_reps", (double) l_nReps )
+       .add( "time_per_face", l_time / l_nFas )
+       .add( "bytes_per_face", l_bytes )
+       .add( "updates_per_second", l_nFas * N_CRUNS / l_time )
+       .add( "bandwidth_gbs", l_bytes * l_nFas * 1E-9 / l_time );
+
+  // prevent the compiler from removing the solver
+  real_base l_chk = 0;
+  for( std::size_t l_fa = 0; l_fa < l_nFas; l_fa++ ) l_chk += l_nus[l_fa][0][0][0];
+  if( l_chk != l_chk ) l_rec.add( "nan", 1.0 );
+
+  io_recs.push_back( l_rec );
+}
+
+EDGE_BENCH( "swe/solvers/fwave", edge::swe::solvers::bench::fwave )
@@ -0,0 +1,216 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Asynchronous checkpoints of the solver state, which allow restarts at synchronization points.
+ **/
+#include "Checkpoint.h"
+#include "logging.h"
+#include "FileSystem.hpp"
+#include "parallel/global.h"
+
+#include <cstdio>
+#include <cstring>
+
+edge::io::Checkpoint::Checkpoint( std::string const & i_dir ): m_dir( i_dir ) {
+  if( m_dir == "" ) return;
+
+  m_dirRank = m_dir + "/" + std::to_string( parallel::g_rank );
+  FileSystem::createDir( m_dirRank );
+}
+
+edge::io::Checkpoint::~Checkpoint() {
+  if( m_pending.valid() ) m_pending.wait();
+}
+
+std::string edge::io::Checkpoint::path( std::size_t i_id ) const {
+  return m_dirRank + "/ckpt_" + std::to_string( i_id ) + ".bin";
+}
+
+void edge::io::Checkpoint::add( std::string const & i_name,
+                                void              * i_ptr,
+                                std::size_t         i_size ) {
+  EDGE_CHECK( !m_pending.valid() ) << "regions can't be added while a checkpoint is written";
+  m_regs.push_back( { i_name, (unsigned char *) i_ptr, i_size } );
+}
+
+bool edge::io::Checkpoint::store( std::size_t i_id,
+                                  double      i_time ) const {
+  std::string l_path = path( i_id );
+  std::string l_tmp  = l_path + ".tmp";
+
+  std::ofstream l_file( l_tmp, std::ios::binary | std::ios::trunc );
+  if( !l_file.is_open() ) return false;
+
+  uint32_t l_hd32[3] = { 1, uint32_t(parallel::g_nRanks), uint32_t(parallel::g_rank) };
+  uint64_t l_id = i_id;
+  uint64_t l_nRegs = m_regs.size();
+
+  l_file.write( "EDGECKPT", 8 );
+  l_file.write( (char const *) l_hd32,  sizeof(l_hd32) );
+  l_file.write( (char const *) &l_id,   sizeof(uint64_t) );
+  l_file.write( (char const *) &i_time, sizeof(double) );
+  l_file.write( (char const *) &l_nRegs, sizeof(uint64_t) );
+
+  for( std::size_t l_re = 0; l_re < m_regs.size(); l_re++ ) {
+    uint32_t l_nChars = m_regs[l_re].name.size();
+    uint64_t l_size   = m_regs[l_re].size;
+    l_file.write( (char const *) &l_nChars, sizeof(uint32_t) );
+    l_file.write( m_regs[l_re].name.data(), l_nChars );
+    l_file.write( (char const *) &l_size,   sizeof(uint64_t) );
+  }
+
+  l_file.write( (char const *) m_stage.data(), m_stage.size() );
+  l_file.close();
+  if( !l_file ) return false;
+
+  // only complete files carry the final name
+  return std::rename( l_tmp.c_str(), l_path.c_str() ) == 0;
+}
+
+void edge::io::Checkpoint::write( std::size_t i_id,
+                                  double      i_time ) {
+  EDGE_CHECK_NE( m_dir, "" );
+
+  // back-pressure: at most one checkpoint is in flight
+  wait();
+
+  // stage the regions, this is the only part on the critical path
+  std::size_t l_size = 0;
+  for( std::size_t l_re = 0; l_re < m_regs.size(); l_re++ ) l_size += m_regs[l_re].size;
+  m_stage.resize( l_size );
+
+  std::size_t l_off = 0;
+  for( std::size_t l_re = 0; l_re < m_regs.size(); l_re++ ) {
+    std::memcpy( m_stage.data()+l_off, m_regs[l_re].ptr, m_regs[l_re].size );
+    l_off += m_regs[l_re].size;
+  }
+
+  m_pendingId = i_id;
+  m_pending = std::async( std::launch::async,
+                          &Checkpoint::store,
+                          this,
+                          i_id,
+                          i_time );
+}
+
+void edge::io::Checkpoint::wait() {
+  if( !m_pending.valid() ) return;
+
+  int l_okLo = m_pending.get() ? 1 : 0;
+  int l_ok = l_okLo;
+#ifdef PP_USE_MPI
+  int l_err = MPI_Allreduce( &l_okLo, &l_ok, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD );
+  EDGE_CHECK_EQ( l_err, MPI_SUCCESS );
+#endif
+
+  if( l_ok == 0 ) {
+    EDGE_LOG_ERROR << "failed writing checkpoint #" << m_pendingId << ", keeping the previous one";
+    std::remove( path( m_pendingId ).c_str() );
+    return;
+  }
+
+  // commit
+  if( parallel::g_rank == 0 ) {
+    std::string l_latest = m_dir + "/latest";
+    std::ofstream l_file( l_latest + ".tmp", std::ios::trunc );
+    l_file << m_pendingId << "\n";
+    l_file.close();
+    if( !l_file || std::rename( (l_latest + ".tmp").c_str(), l_latest.c_str() ) != 0 )
+      EDGE_LOG_FATAL << "could not commit checkpoint #" << m_pendingId;
+  }
+#ifdef PP_USE_MPI
+  l_err = MPI_Barrier( MPI_COMM_WORLD );
+  EDGE_CHECK_EQ( l_err, MPI_SUCCESS );
+#endif
+
+  // the previous checkpoint is superseded
+  if( m_id != std::numeric_limits< std::size_t >::max() && m_id != m_pendingId ) {
+    std::remove( path( m_id ).c_str() );
+  }
+  m_id = m_pendingId;
+}
+
+bool edge::io::Checkpoint::latest( std::size_t & o_id,
+                                   double      & o_time ) const {
+  if( m_dir == "" ) return false;
+
+  std::ifstream l_latest( m_dir + "/latest" );
+  if( !l_latest.is_open() ) return false;
+  if( !(l_latest >> o_id) ) return false;
+
+  std::ifstream l_file;
+  std::vector< std::pair< std::string, uint64_t > > l_regs;
+  open( o_id, l_file, o_time, l_regs );
+
+  return true;
+}
+
+void edge::io::Checkpoint::open( std::size_t                                         i_id,
+                                 std::ifstream                                     & o_file,
+                                 double                                            & o_time,
+                                 std::vector< std::pair< std::string, uint64_t > > & o_regs ) const {
+  std::string l_path = path( i_id );
+  o_file.open( l_path, std::ios::binary );
+  if( !o_file.is_open() ) EDGE_LOG_FATAL << "could not open checkpoint: " << l_path;
+
+  char l_magic[8];
+  uint32_t l_hd32[3];
+  uint64_t l_id, l_nRegs;
+
+  o_file.read( l_magic, 8 );
+  o_file.read( (char *) l_hd32,  sizeof(l_hd32) );
+  o_file.read( (char *) &l_id,   sizeof(uint64_t) );
+  o_file.read( (char *) &o_time, sizeof(double) );
+  o_file.read( (char *) &l_nRegs, sizeof(uint64_t) );
+
+  if( !o_file || std::memcmp( l_magic, "EDGECKPT", 8 ) != 0 || l_hd32[0] != 1 )
+    EDGE_LOG_FATAL << "invalid checkpoint: " << l_path;
+  EDGE_CHECK_EQ( l_hd32[1], uint32_t(parallel::g_nRanks) ) << "checkpoint was written with a different number of ranks";
+  EDGE_CHECK_EQ( l_hd32[2], uint32_t(parallel::g_rank) );
+  EDGE_CHECK_EQ( l_id, i_id );
+
+  o_regs.resize( l_nRegs );
+  for( std::size_t l_re = 0; l_re < l_nRegs; l_re++ ) {
+    uint32_t l_nChars;
+    o_file.read( (char *) &l_nChars, sizeof(uint32_t) );
+    o_regs[l_re].first.resize( l_nChars );
+    o_file.read( &o_regs[l_re].first[0], l_nChars );
+    o_file.read( (char *) &o_regs[l_re].second, sizeof(uint64_t) );
+  }
+  if( !o_file ) EDGE_LOG_FATAL << "invalid checkpoint: " << l_path;
+}
+
+void edge::io::Checkpoint::read( std::size_t i_id ) {
+  std::ifstream l_file;
+  double l_time;
+  std::vector< std::pair< std::string, uint64_t > > l_regs;
+  open( i_id, l_file, l_time, l_regs );
+
+  EDGE_CHECK_EQ( l_regs.size(), m_regs.size() ) << "regions of the checkpoint don't match";
+  for( std::size_t l_re = 0; l_re < m_regs.size(); l_re++ ) {
+    EDGE_CHECK_EQ( l_regs[l_re].first,  m_regs[l_re].name );
+    EDGE_CHECK_EQ( l_regs[l_re].second, m_regs[l_re].size ) << "size of region " << m_regs[l_re].name << " doesn't match";
+
+    l_file.read( (char *) m_regs[l_re].ptr, m_regs[l_re].size );
+  }
+  if( !l_file ) EDGE_LOG_FATAL << "could not read checkpoint #" << i_id;
+
+  m_id = i_id;
+}
@@ -0,0 +1,175 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Asynchronous checkpoints of the solver state, which allow restarts at synchronization points.
+ **/
+#ifndef EDGE_IO_CHECKPOINT_H
+#define EDGE_IO_CHECKPOINT_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <future>
+#include <limits>
+
+namespace edge {
+  namespace io {
+    class Checkpoint;
+  }
+}
+
+/**
+ * Checkpoints raw memory regions, e.g., the DOFs or the time buffers, in one binary file per rank.
+ *
+ * The regions are copied to a staging buffer in the calling thread, the file is written by a background thread.
+ * A checkpoint is committed once all ranks finished their files: rank 0 writes the id to <dir>/latest.
+ *
+ * File <dir>/<rank>/ckpt_<id>.bin:
+ *   header: "EDGECKPT", uint32 version (1), uint32 #ranks, uint32 rank, uint64 id, double time, uint64 #regions,
+ *           per region: uint32 length and characters of the name, uint64 size in bytes.
+ *   data:   raw bytes of the regions in the order of registration.
+ **/
+class edge::io::Checkpoint {
+  private:
+    //! registered memory region
+    struct Region {
+      //! name of the region
+      std::string name;
+      //! start of the region
+      unsigned char * ptr;
+      //! size of the region in bytes
+      std::size_t size;
+    };
+
+    //! root directory of the checkpoints, empty if disabled
+    std::string m_dir;
+
+    //! directory of this rank
+    std::string m_dirRank;
+
+    //! registered regions
+    std::vector< Region > m_regs;
+
+    //! staging buffer, which holds the copied regions of the pending write
+    std::vector< unsigned char > m_stage;
+
+    //! pending background write, returns true on success
+    std::future< bool > m_pending;
+
+    //! id of the pending write
+    std::size_t m_pendingId = std::numeric_limits< std::size_t >::max();
+
+    //! id of the last committed checkpoint
+    std::size_t m_id = std::numeric_limits< std::size_t >::max();
+
+    /**
+     * Gets the path of the checkpoint file of this rank.
+     *
+     * @param i_id id of the checkpoint.
+     * @return path to the file.
+     **/
+    std::string path( std::size_t i_id ) const;
+
+    /**
+     * Writes the header and the staged regions to disk.
+     *
+     * @param i_id id of the checkpoint.
+     * @param i_time simulation time of the checkpoint.
+     * @return true if successful, false otherwise.
+     **/
+    bool store( std::size_t i_id,
+                double      i_time ) const;
+
+    /**
+     * Opens the checkpoint file of this rank and reads its header.
+     *
+     * @param i_id id of the checkpoint.
+     * @param o_file will be set to the opened file, positioned at the data.
+     * @param o_time will be set to the simulation time of the checkpoint.
+     * @param o_regs will be set to names and sizes of the regions in the file.
+     **/
+    void open( std::size_t                                        i_id,
+               std::ifstream                                    & o_file,
+               double                                           & o_time,
+               std::vector< std::pair< std::string, uint64_t > > & o_regs ) const;
+
+  public:
+    /**
+     * Constructor.
+     *
+     * @param i_dir root directory of the checkpoints, empty string disables checkpointing.
+     **/
+    Checkpoint( std::string const & i_dir );
+
+    /**
+     * Destructor, which waits for the pending write without committing it.
+     **/
+    ~Checkpoint();
+
+    /**
+     * Registers a memory region; has to be called in the same order for writing and reading.
+     *
+     * @param i_name name of the region.
+     * @param i_ptr start of the region.
+     * @param i_size size of the region in bytes.
+     **/
+    void add( std::string const & i_name,
+              void              * i_ptr,
+              std::size_t         i_size );
+
+    /**
+     * Writes a checkpoint of the registered regions.
+     * The regions are copied before the function returns, the file is written in the background.
+     * A pending write of the previous checkpoint is committed first.
+     * Has to be called collectively.
+     *
+     * @param i_id id of the checkpoint.
+     * @param i_time simulation time of the checkpoint.
+     **/
+    void write( std::size_t i_id,
+                double      i_time );
+
+    /**
+     * Waits for the pending write and commits the checkpoint if all ranks succeeded.
+     * The previous checkpoint of the rank is removed after the commit.
+     * Has to be called collectively.
+     **/
+    void wait();
+
+    /**
+     * Gets the last committed checkpoint.
+     *
+     * @param o_id will be set to the id of the checkpoint.
+     * @param o_time will be set to the simulation time of the checkpoint.
+     * @return true if a checkpoint exists, false otherwise.
+     **/
+    bool latest( std::size_t & o_id,
+                 double      & o_time ) const;
+
+    /**
+     * Restores the registered regions from the given checkpoint.
+     *
+     * @param i_id id of the checkpoint.
+     **/
+    void read( std::size_t i_id );
+};
+
+#endif
@@ -0,0 +1,85 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Unit tests for the checkpoints.
+ **/
+#include <catch.hpp>
+#include "Checkpoint.h"
+
+namespace edge {
+  namespace test {
+    extern std::string g_tmpDir;
+  }
+}
+
+TEST_CASE( "Checkpoint: Write and restart", "[checkpoint][io]" ) {
+  std::string l_dir = edge::test::g_tmpDir + "checkpoint";
+
+  double l_dofs[5] = { 1.0, 2.0, 3.0, 4.0, 5.0 };
+  unsigned int l_step = 7;
+
+  // disabled checkpoints don't have a restart
+  edge::io::Checkpoint l_none( "" );
+  std::size_t l_id = 0;
+  double l_time = 0;
+  REQUIRE( !l_none.latest( l_id, l_time ) );
+
+  {
+    edge::io::Checkpoint l_ckpt( l_dir );
+    l_ckpt.add( "dofs", l_dofs,  sizeof(l_dofs) );
+    l_ckpt.add( "step", &l_step, sizeof(l_step) );
+
+    // the regions are staged, changes after the call don't make it to disk
+    l_ckpt.write( 3, 0.5 );
+    l_dofs[1] = -1.0;
+    l_step = 8;
+    l_ckpt.wait();
+
+    REQUIRE( l_ckpt.latest( l_id, l_time ) );
+    REQUIRE( l_id == 3 );
+    REQUIRE( l_time == Approx(0.5) );
+
+    // next checkpoint supersedes the previous one
+    l_ckpt.write( 4, 0.75 );
+    l_ckpt.wait();
+    REQUIRE( l_ckpt.latest( l_id, l_time ) );
+    REQUIRE( l_id == 4 );
+    REQUIRE( l_time == Approx(0.75) );
+
+    std::ifstream l_prev( l_dir + "/0/ckpt_3.bin" );
+    REQUIRE( !l_prev.is_open() );
+  }
+
+  // restart
+  double l_dofsRe[5] = { 0 };
+  unsigned int l_stepRe = 0;
+
+  edge::io::Checkpoint l_re( l_dir );
+  l_re.add( "dofs", l_dofsRe,  sizeof(l_dofsRe) );
+  l_re.add( "step", &l_stepRe, sizeof(l_stepRe) );
+
+  REQUIRE( l_re.latest( l_id, l_time ) );
+  l_re.read( l_id );
+
+  REQUIRE( l_stepRe == 8 );
+  REQUIRE( l_dofsRe[0] == 1.0 );
+  REQUIRE( l_dofsRe[1] == -1.0 );
+  REQUIRE( l_dofsRe[4] == 5.0 );
+}
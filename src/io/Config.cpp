@@ -130,6 +130,15 @@ void edge::io::Config::printConfig() {
 
   EDGE_LOG_INFO << "  synchronization:";
   EDGE_LOG_INFO << "    max_int (possibly using default settings): " << m_syncMaxInt;
+  EDGE_LOG_INFO << "  shared_memory:";
+  EDGE_LOG_INFO << "    scheduler: " << m_sharedSched;
+  EDGE_LOG_INFO << "    chunk_size: " << m_sharedChunkSize;
+  EDGE_LOG_INFO << "  distributed_memory:";
+  EDGE_LOG_INFO << "    compression: " << m_distComp;
+  if( m_distComp == "lossy" ) {
+    EDGE_LOG_INFO << "    mantissa_bits: " << m_distCompBits;
+  }
+  EDGE_LOG_INFO << "    persistent_requests: " << m_distPersistent;
   EDGE_LOG_INFO << "  mesh:";
   EDGE_LOG_INFO << "    in: ";
   EDGE_LOG_INFO << "      base: " << m_meshInBase;
@@ -173,6 +182,16 @@ void edge::io::Config::printConfig() {
       EDGE_LOG_INFO << "    sparse_type: " << m_waveFieldSpType;
     EDGE_LOG_INFO << "    file: " << m_waveFieldFile;
     EDGE_LOG_INFO << "    int: "  << m_waveFieldInt;
+    EDGE_LOG_INFO << "    async: " << (m_waveFieldAsync ? "yes" : "no");
+    EDGE_LOG_INFO << "    modes: " << (m_waveFieldAllModes ? "all" : "average");
+    EDGE_LOG_INFO << "    compression: " << m_waveFieldComp;
+  }
+
+  if( m_ckptDir != "" ) {
+    EDGE_LOG_INFO << "  checkpoint:";
+    EDGE_LOG_INFO << "    path_to_dir: " << m_ckptDir;
+    EDGE_LOG_INFO << "    int: " << m_ckptInt;
+    EDGE_LOG_INFO << "    restart: " << (m_ckptRestart ? "yes" : "no");
   }
 
   if( m_iBndType != "" ) {
@@ -182,6 +201,11 @@ void edge::io::Config::printConfig() {
     EDGE_LOG_INFO << "    int: "  << m_iBndInt;
   }
 
+  if( m_profFile != "" ) {
+    EDGE_LOG_INFO << "  profile:";
+    EDGE_LOG_INFO << "    file: " << m_profFile;
+  }
+
   // iterate over receiver types. 0: element-modal, 1: face-quad
   for( unsigned short l_rt = 0; l_rt < 2; l_rt++ ) {
     std::string l_type;
@@ -192,6 +216,7 @@ void edge::io::Config::printConfig() {
       EDGE_LOG_INFO << "  found " << m_recvNames[l_rt].size() << " " << l_type << " receivers in the config: ";
       EDGE_LOG_INFO << "    sampling frequency: " << m_recvFreq[l_rt];
       EDGE_LOG_INFO << "    path to out-directory: "<< m_recvPath[l_rt];
+      EDGE_LOG_INFO << "    format: "<< m_recvFormat[l_rt];
     }
   }
 
@@ -326,9 +351,23 @@ edge::io::Config::Config( std::string i_xmlPath ):
 
     if( l_output.child("wave_field").find_child([]( pugi::xml_node i_node ){ return std::string(i_node.name()) == "sparse_type";}) )
       m_waveFieldSpType = l_output.child("wave_field").child("sparse_type").text().as_uint();
+
+    m_waveFieldAsync = l_output.child("wave_field").child("async").text().as_bool( true );
+
+    std::string l_modes = l_output.child("wave_field").child("modes").text().as_string();
+    EDGE_CHECK( l_modes == "" || l_modes == "all" || l_modes == "average" ) << "unknown wave field modes: " << l_modes;
+    m_waveFieldAllModes = (l_modes == "all");
+    m_waveFieldComp = l_output.child("wave_field").child("compression").text().as_uint( 0 );
   }
   EDGE_CHECK_GT( m_waveFieldInt, TOL.TIME );
 
+  m_ckptDir = l_output.child("checkpoint").child("path_to_dir").text().as_string();
+  if( m_ckptDir != "" ) {
+    m_ckptInt     = l_output.child("checkpoint").child("int").text().as_double( m_ckptInt );
+    m_ckptRestart = l_output.child("checkpoint").child("restart").text().as_bool( false );
+  }
+  EDGE_CHECK_GT( m_ckptInt, TOL.TIME );
+
   m_iBndType = l_output.child("internal_boundary").child("type").text().as_string();
   if( m_iBndType != "" ) {
     m_iBndFile = l_output.child("internal_boundary").child("file").text().as_string();
@@ -364,6 +403,7 @@ edge::io::Config::Config( std::string i_xmlPath ):
     }
     else m_recvFreq[l_rt] = -std::numeric_limits< double >::max();
     m_recvPath[l_rt] = l_output.child(l_type.c_str()).child("path_to_dir").text().as_string();
+    m_recvFormat[l_rt] = l_output.child(l_type.c_str()).child("format").text().as_string( "csv" );
     // clear invalid input
     if( m_recvFreq[l_rt] < TOL.TIME || m_recvPath[l_rt] == "" ) {
       m_recvCrds[l_rt].clear();
@@ -388,6 +428,8 @@ edge::io::Config::Config( std::string i_xmlPath ):
   m_errorNormsType = l_output.child("error_norms").child("type").text().as_string();
   m_errorNormsFile = l_output.child("error_norms").child("file").text().as_string();
 
+  m_profFile = l_output.child("profile").child("file").text().as_string();
+
   /*
    * read maximum sync interval
    */
@@ -400,6 +442,32 @@ edge::io::Config::Config( std::string i_xmlPath ):
   }
   EDGE_CHECK_GT( m_syncMaxInt, TOL.TIME );
 
+  /*
+   * read shared memory parameters
+   */
+  std::string l_sharedSched = m_doc.child("edge").child("shared_memory").child("scheduler").text().as_string();
+  if( l_sharedSched != "" ) m_sharedSched = l_sharedSched;
+  EDGE_CHECK( m_sharedSched == "polling" || m_sharedSched == "tasks" || m_sharedSched == "dag" )
+    << "unknown scheduler of the shared memory parallelization: " << m_sharedSched;
+
+  m_sharedChunkSize = m_doc.child("edge").child("shared_memory").child("chunk_size").text().as_uint();
+  EDGE_CHECK( m_sharedChunkSize == 0 || m_sharedSched != "polling" )
+    << "chunked work regions require the scheduler tasks or dag";
+
+  /*
+   * read distributed memory parameters
+   */
+  pugi::xml_node l_distComp = m_doc.child("edge").child("distributed_memory").child("compression");
+  std::string l_distCompMode = l_distComp.child("mode").text().as_string();
+  if( l_distCompMode != "" ) m_distComp = l_distCompMode;
+  EDGE_CHECK( m_distComp == "none" || m_distComp == "lossless" || m_distComp == "lossy" )
+    << "unknown compression of the messages: " << m_distComp;
+  m_distCompBits = l_distComp.child("mantissa_bits").text().as_uint( m_distCompBits );
+
+  m_distPersistent = m_doc.child("edge").child("distributed_memory").child("persistent_requests").text().as_bool( m_distPersistent );
+  EDGE_CHECK( !m_distPersistent || m_distComp == "none" )
+    << "persistent requests require uncompressed messages";
+
   // print config
   printConfig();
 }
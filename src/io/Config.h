@@ -173,6 +173,27 @@ class edge::io::Config {
     //! xml-document containing the config
     pugi::xml_document m_doc;
 
+    /*
+     * Shared memory parameters
+     */
+    //! scheduling of the work packages: polling (default), tasks or dag (tasks with a dependency graph of the control flow)
+    std::string m_sharedSched = "polling";
+
+    //! number of entities in the chunks of the work regions, 0 (default) for one package per worker
+    std::size_t m_sharedChunkSize = 0;
+
+    /*
+     * Distributed memory parameters
+     */
+    //! compression of the messages: none (default), lossless or lossy
+    std::string m_distComp = "none";
+
+    //! number of mantissa bits, which are kept in lossy compression of the messages
+    unsigned short m_distCompBits = 10;
+
+    //! true if persistent requests are used for the messages, false (default) otherwise
+    bool m_distPersistent = false;
+
     /*
      * Mesh parameters
      */
@@ -236,6 +257,24 @@ class edge::io::Config {
     //! interval of wave field output (max/2 to prevent inf when used in comparisons)
     double m_waveFieldInt =  std::numeric_limits< double >::max()/2;
 
+    //! true if the wave field is written by a background thread
+    bool m_waveFieldAsync = true;
+
+    //! true if all modes of the wave field are written (rather than cell averages)
+    bool m_waveFieldAllModes = false;
+
+    //! compression level of the wave field output (0: none)
+    unsigned short m_waveFieldComp = 0;
+
+    //! root directory of the checkpoints, empty if disabled
+    std::string m_ckptDir = "";
+
+    //! interval of the checkpoints (max/2 to prevent inf when used in comparisons)
+    double m_ckptInt = std::numeric_limits< double >::max()/2;
+
+    //! true if the simulation is restarted from the latest checkpoint (if available)
+    bool m_ckptRestart = false;
+
     //! maximum synchronization interval (if sync point is reached otherwise before, this is ignored)
     double m_syncMaxInt = std::numeric_limits< double >::max()/2;
 
@@ -254,6 +293,9 @@ class edge::io::Config {
     //! file for xml output of the norms
     std::string m_errorNormsFile;
 
+    //! file for the profile of the work regions (rank-suffixed, .csv for CSV, JSON Lines otherwise), empty if disabled
+    std::string m_profFile = "";
+
     //! receiver coordinates
     std::vector< std::array< real_mesh, 3 > > m_recvCrds[2];
 
@@ -266,6 +308,9 @@ class edge::io::Config {
     //! path to receiver directory
     std::string m_recvPath[2];
 
+    //! output format of the receivers (csv or bin)
+    std::string m_recvFormat[2] = { "csv", "csv" };
+
     //! domains for sparse entity types, [0]: vertices, [1]: faces, [2]: elements
     std::vector< linalg::Domain< real_mesh, N_DIM, edge::linalg::HalfSpace > > m_spTypesDoms[3];
 
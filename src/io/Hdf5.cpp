@@ -0,0 +1,348 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * HDF5/XDMF writer, which collects the data of all ranks in a single file per snapshot.
+ **/
+#ifdef PP_HAS_HDF5
+#include "Hdf5.h"
+#include "logging.h"
+#include "FileSystem.hpp"
+#include "monitor/instrument.hpp"
+#include "data/common.hpp"
+
+#include <fstream>
+#include <sstream>
+
+hid_t edge::io::Hdf5::create( std::string const & i_path ) {
+  herr_t l_h5Err;
+
+  hid_t l_fapl = H5Pcreate( H5P_FILE_ACCESS );
+#if defined(PP_USE_MPI) && defined(H5_HAVE_PARALLEL)
+  l_h5Err = H5Pset_fapl_mpio( l_fapl,
+                              MPI_COMM_WORLD,
+                              MPI_INFO_NULL );
+  EDGE_CHECK_GE( l_h5Err, 0 );
+#endif
+
+  hid_t l_file = H5Fcreate( i_path.c_str(),
+                            H5F_ACC_TRUNC,
+                            H5P_DEFAULT,
+                            l_fapl );
+  EDGE_CHECK_GE( l_file, 0 ) << "could not create " << i_path;
+
+  l_h5Err = H5Pclose( l_fapl );
+  EDGE_CHECK_GE( l_h5Err, 0 );
+
+  return l_file;
+}
+
+void edge::io::Hdf5::writeDset( hid_t               i_file,
+                                std::string const & i_name,
+                                hid_t               i_memType,
+                                hid_t               i_fileType,
+                                hsize_t     const   i_dimsGl[2],
+                                hsize_t     const   i_off[2],
+                                hsize_t     const   i_count[2],
+                                void        const * i_data,
+                                unsigned short      i_comp ) {
+  herr_t l_h5Err;
+
+  hid_t l_fileSp = H5Screate_simple( 2, i_dimsGl, NULL );
+  hid_t l_memSp  = H5Screate_simple( 2, i_count,  NULL );
+
+  // chunked layout with shuffle and deflate filters for compressed datasets
+  hid_t l_dcpl = H5Pcreate( H5P_DATASET_CREATE );
+  if( i_comp > 0 && i_dimsGl[0] * i_dimsGl[1] > 0 ) {
+    hsize_t l_chunk[2] = { 1, std::min( i_dimsGl[1], hsize_t(1) << 16 ) };
+    l_h5Err = H5Pset_chunk( l_dcpl, 2, l_chunk );
+    EDGE_CHECK_GE( l_h5Err, 0 );
+    l_h5Err = H5Pset_shuffle( l_dcpl );
+    EDGE_CHECK_GE( l_h5Err, 0 );
+    l_h5Err = H5Pset_deflate( l_dcpl, i_comp );
+    EDGE_CHECK_GE( l_h5Err, 0 );
+  }
+
+  hid_t l_dset = H5Dcreate( i_file,
+                            i_name.c_str(),
+                            i_fileType,
+                            l_fileSp,
+                            H5P_DEFAULT,
+                            l_dcpl,
+                            H5P_DEFAULT );
+  EDGE_CHECK_GE( l_dset, 0 );
+
+  // select the local block, empty blocks still participate in the collective write
+  if( i_count[0] * i_count[1] > 0 ) {
+    l_h5Err = H5Sselect_hyperslab( l_fileSp,
+                                   H5S_SELECT_SET,
+                                   i_off,
+                                   NULL,
+                                   i_count,
+                                   NULL );
+  }
+  else {
+    l_h5Err = H5Sselect_none( l_fileSp );
+    EDGE_CHECK_GE( l_h5Err, 0 );
+    l_h5Err = H5Sselect_none( l_memSp );
+  }
+  EDGE_CHECK_GE( l_h5Err, 0 );
+
+  l_h5Err = H5Dwrite( l_dset,
+                      i_memType,
+                      l_memSp,
+                      l_fileSp,
+                      m_dxpl,
+                      i_data );
+  EDGE_CHECK_GE( l_h5Err, 0 );
+
+  l_h5Err = H5Dclose( l_dset );
+  EDGE_CHECK_GE( l_h5Err, 0 );
+  l_h5Err = H5Pclose( l_dcpl );
+  EDGE_CHECK_GE( l_h5Err, 0 );
+  l_h5Err = H5Sclose( l_memSp );
+  EDGE_CHECK_GE( l_h5Err, 0 );
+  l_h5Err = H5Sclose( l_fileSp );
+  EDGE_CHECK_GE( l_h5Err, 0 );
+}
+
+void edge::io::Hdf5::writeAttr( hid_t               i_file,
+                                std::string const & i_name,
+                                int                 i_val ) {
+  herr_t l_h5Err;
+
+  hid_t l_sp = H5Screate( H5S_SCALAR );
+  hid_t l_attr = H5Acreate( i_file,
+                            i_name.c_str(),
+                            H5T_STD_I32LE,
+                            l_sp,
+                            H5P_DEFAULT,
+                            H5P_DEFAULT );
+  EDGE_CHECK_GE( l_attr, 0 );
+
+  l_h5Err = H5Awrite( l_attr, H5T_NATIVE_INT, &i_val );
+  EDGE_CHECK_GE( l_h5Err, 0 );
+
+  l_h5Err = H5Aclose( l_attr );
+  EDGE_CHECK_GE( l_h5Err, 0 );
+  l_h5Err = H5Sclose( l_sp );
+  EDGE_CHECK_GE( l_h5Err, 0 );
+}
+
+void edge::io::Hdf5::initXdmf() {
+  if( parallel::g_rank != 0 ) return;
+
+  std::ofstream l_xdmf( m_outFile + ".xdmf", std::ios::binary );
+  EDGE_CHECK( l_xdmf.good() ) << "could not open " << m_outFile << ".xdmf";
+
+  l_xdmf << "<?xml version=\"1.0\" ?>\n";
+  l_xdmf << "<Xdmf Version=\"3.0\">\n";
+  l_xdmf << " <Domain>\n";
+  l_xdmf << "  <Grid Name=\"wave_field\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+  l_xdmf << m_xdmfFtr;
+}
+
+void edge::io::Hdf5::appendXdmf( std::size_t i_step,
+                                 double      i_time ) {
+  if( parallel::g_rank != 0 ) return;
+
+  // HDF5 files are referenced relative to the descriptor
+  std::string l_dir, l_file;
+  FileSystem::splitPathLast( m_outFile, l_dir, l_file );
+
+  unsigned short l_nRows = N_CRUNS * N_QUANTITIES * m_nMds;
+  std::string l_snFile = l_file + "_" + std::to_string( i_step ) + ".h5";
+
+  std::ostringstream l_grid;
+  l_grid << "   <Grid Name=\"step_" << i_step << "\" GridType=\"Uniform\">\n";
+  l_grid << "    <Time Value=\"" << i_time << "\"/>\n";
+  l_grid << "    <Topology TopologyType=\"" << m_topoType << "\" NumberOfElements=\"" << m_nElsGl << "\">\n";
+  l_grid << "     <DataItem Dimensions=\"" << m_nElsGl << " " << C_ENT[T_SDISC.ELEMENT].N_VERTICES
+         << "\" NumberType=\"UInt\" Precision=\"8\" Format=\"HDF\">" << l_file << "_mesh.h5:/connect</DataItem>\n";
+  l_grid << "    </Topology>\n";
+  l_grid << "    <Geometry GeometryType=\"XYZ\">\n";
+  l_grid << "     <DataItem Dimensions=\"" << m_nVesGl
+         << " 3\" NumberType=\"Float\" Precision=\"8\" Format=\"HDF\">" << l_file << "_mesh.h5:/coords</DataItem>\n";
+  l_grid << "    </Geometry>\n";
+
+  for( int_cfr l_run = 0; l_run < N_CRUNS; l_run++ ) {
+    for( int_md l_qt = 0; l_qt < N_QUANTITIES; l_qt++ ) {
+      // cell averages are the first mode of every quantity
+      unsigned short l_row = (l_run*N_QUANTITIES + l_qt) * m_nMds;
+      l_grid << "    <Attribute Name=\"crun_" << l_run << "_var_" << l_qt << "\" AttributeType=\"Scalar\" Center=\"Cell\">\n";
+      l_grid << "     <DataItem ItemType=\"HyperSlab\" Dimensions=\"1 " << m_nElsGl << "\">\n";
+      l_grid << "      <DataItem Dimensions=\"3 2\" Format=\"XML\">" << l_row << " 0 1 1 1 " << m_nElsGl << "</DataItem>\n";
+      l_grid << "      <DataItem Dimensions=\"" << l_nRows << " " << m_nElsGl
+             << "\" NumberType=\"Float\" Precision=\"4\" Format=\"HDF\">" << l_snFile << ":/dofs</DataItem>\n";
+      l_grid << "     </DataItem>\n";
+      l_grid << "    </Attribute>\n";
+    }
+  }
+  l_grid << "   </Grid>\n";
+
+  // overwrite the closing tags, the grid is always longer than them
+  std::fstream l_xdmf( m_outFile + ".xdmf", std::ios::in | std::ios::out | std::ios::binary );
+  EDGE_CHECK( l_xdmf.good() ) << "could not open " << m_outFile << ".xdmf";
+
+  l_xdmf.seekp( -std::streamoff( m_xdmfFtr.size() ), std::ios::end );
+  l_xdmf << l_grid.str() << m_xdmfFtr;
+  EDGE_CHECK( l_xdmf.good() ) << "could not append to " << m_outFile << ".xdmf";
+}
+
+edge::io::Hdf5::Hdf5( std::string                const    & i_outFile,
+                      int_el                                i_nVes,
+                      std::vector< int_el >      const    & i_elPrint,
+                      t_vertexChars              const    * i_veChars,
+                      int_el                     const   (* i_elVe)[C_ENT[T_SDISC.ELEMENT].N_VERTICES],
+                      bool                                  i_allModes,
+                      unsigned short                        i_comp ):
+ m_outFile( i_outFile ),
+ m_nEls( i_elPrint.size() ),
+ m_nMds( i_allModes ? N_ELEMENT_MODES : 1 ),
+ m_comp( i_comp ) {
+  PP_INSTR_FUN("hdf5_mesh")
+
+  herr_t l_h5Err;
+
+  EDGE_CHECK_LE( m_comp, 9 ) << "deflate levels are 0-9";
+  if( m_comp > 0 ) {
+    EDGE_CHECK_GT( H5Zfilter_avail( H5Z_FILTER_DEFLATE ), 0 ) << "HDF5 build does not support deflate";
+  }
+
+#if defined(PP_USE_MPI) && !defined(H5_HAVE_PARALLEL)
+  EDGE_CHECK_EQ( parallel::g_nRanks, 1 ) << "HDF5 wave field output with multiple ranks requires a parallel HDF5 build";
+#endif
+
+  // set the XDMF element type
+  if(       T_SDISC.ELEMENT == LINE   ) m_topoType = "Polyline\" NodesPerElement=\"2";
+  else if ( T_SDISC.ELEMENT == TRIA3  ) m_topoType = "Triangle";
+  else if ( T_SDISC.ELEMENT == QUAD4R ) m_topoType = "Quadrilateral";
+  else if ( T_SDISC.ELEMENT == HEX8R  ) m_topoType = "Hexahedron";
+  else if ( T_SDISC.ELEMENT == TET4   ) m_topoType = "Tetrahedron";
+  else {
+   EDGE_LOG_FATAL << "missing element type " << T_SDISC.ELEMENT;
+  }
+
+  // derive the global offsets and sizes
+  unsigned long long l_lo[2] = { m_nEls, i_nVes };
+  unsigned long long l_off[2] = { 0, 0 };
+  unsigned long long l_gl[2] = { l_lo[0], l_lo[1] };
+#ifdef PP_USE_MPI
+  MPI_Exscan( l_lo, l_off, 2, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD );
+  if( parallel::g_rank == 0 ) l_off[0] = l_off[1] = 0;
+  MPI_Allreduce( l_lo, l_gl, 2, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD );
+#endif
+  m_elOff  = l_off[0];
+  m_nElsGl = l_gl[0];
+  m_nVesGl = l_gl[1];
+
+  // collective data transfers if available
+  m_dxpl = H5Pcreate( H5P_DATASET_XFER );
+#if defined(PP_USE_MPI) && defined(H5_HAVE_PARALLEL)
+  l_h5Err = H5Pset_dxpl_mpio( m_dxpl, H5FD_MPIO_COLLECTIVE );
+  EDGE_CHECK_GE( l_h5Err, 0 );
+#endif
+
+  // allocate the staging buffer
+  m_dofs = (float*) data::common::allocate( sizeof(float) * std::max( m_nEls, std::size_t(1) ) * N_QUANTITIES * N_CRUNS * m_nMds );
+
+  // assemble the local mesh
+  double (*l_coords)[3] = new double[i_nVes][3];
+  for( int_el l_ve = 0; l_ve < i_nVes; l_ve++ )
+    for( unsigned short l_di = 0; l_di < 3; l_di++ )
+      l_coords[l_ve][l_di] = i_veChars[l_ve].coords[l_di];
+
+  unsigned short l_nElVes = C_ENT[T_SDISC.ELEMENT].N_VERTICES;
+  unsigned long long *l_connect = new unsigned long long[ m_nEls * l_nElVes ];
+  for( std::size_t l_el = 0; l_el < m_nEls; l_el++ )
+    for( unsigned short l_ve = 0; l_ve < l_nElVes; l_ve++ )
+      l_connect[l_el*l_nElVes + l_ve] = l_off[1] + i_elVe[ i_elPrint[l_el] ][l_ve];
+
+  // write the mesh
+  hid_t l_file = create( m_outFile + "_mesh.h5" );
+
+  hsize_t l_dimsGl[2] = { m_nVesGl, 3 };
+  hsize_t l_offs[2]   = { l_off[1], 0 };
+  hsize_t l_count[2]  = { i_nVes,   3 };
+  writeDset( l_file, "coords", H5T_NATIVE_DOUBLE, H5T_IEEE_F64LE, l_dimsGl, l_offs, l_count, l_coords );
+
+  l_dimsGl[0] = m_nElsGl;  l_dimsGl[1] = l_nElVes;
+  l_offs[0]   = m_elOff;   l_offs[1]   = 0;
+  l_count[0]  = m_nEls;    l_count[1]  = l_nElVes;
+  writeDset( l_file, "connect", H5T_NATIVE_ULLONG, H5T_STD_U64LE, l_dimsGl, l_offs, l_count, l_connect );
+
+  l_h5Err = H5Fclose( l_file );
+  EDGE_CHECK_GE( l_h5Err, 0 );
+
+  delete[] l_coords;
+  delete[] l_connect;
+
+  initXdmf();
+}
+
+edge::io::Hdf5::~Hdf5() {
+  H5Pclose( m_dxpl );
+  data::common::release( m_dofs );
+}
+
+void edge::io::Hdf5::write( std::size_t                           i_step,
+                            double                                i_time,
+                            std::vector< int_el >       const   & i_elPrint,
+                            real_base                   const  (* i_dofs)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS] ) {
+  PP_INSTR_FUN("hdf5_write")
+
+  EDGE_CHECK_EQ( i_elPrint.size(), m_nEls );
+
+  // reorder the DOFs and fill the buffer
+#ifdef PP_USE_OMP
+#pragma omp parallel for
+#endif
+  for( std::size_t l_el = 0; l_el < m_nEls; l_el++ ) {
+    int_el l_elId = i_elPrint[l_el];
+    for( int_md l_qt = 0; l_qt < N_QUANTITIES; l_qt++ ) {
+      for( unsigned short l_md = 0; l_md < m_nMds; l_md++ ) {
+        for( int_cfr l_run = 0; l_run < N_CRUNS; l_run++ ) {
+          std::size_t l_row = (N_QUANTITIES*l_run + l_qt) * m_nMds + l_md;
+          m_dofs[m_nEls*l_row + l_el] = i_dofs[l_elId][l_qt][l_md][l_run];
+        }
+      }
+    }
+  }
+
+  // write the snapshot, the local elements are a column block of the rows
+  hid_t l_file = create( m_outFile + "_" + std::to_string( i_step ) + ".h5" );
+
+  hsize_t l_nRows = N_CRUNS*N_QUANTITIES*m_nMds;
+  hsize_t l_dimsGl[2] = { l_nRows, m_nElsGl };
+  hsize_t l_offs[2]   = { 0,       m_elOff  };
+  hsize_t l_count[2]  = { l_nRows, m_nEls   };
+  writeDset( l_file, "dofs", H5T_NATIVE_FLOAT, H5T_IEEE_F32LE, l_dimsGl, l_offs, l_count, m_dofs, m_comp );
+
+  // describe the basis
+  writeAttr( l_file, "order",        ORDER             );
+  writeAttr( l_file, "n_modes",      m_nMds            );
+  writeAttr( l_file, "element_type", T_SDISC.ELEMENT   );
+
+  herr_t l_h5Err = H5Fclose( l_file );
+  EDGE_CHECK_GE( l_h5Err, 0 );
+
+  // update the descriptor
+  appendXdmf( i_step, i_time );
+}
+#endif
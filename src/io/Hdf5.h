@@ -0,0 +1,184 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * HDF5/XDMF writer, which collects the data of all ranks in a single file per snapshot.
+ **/
+#ifndef EDGE_IO_HDF5_H
+#define EDGE_IO_HDF5_H
+
+#ifdef PP_HAS_HDF5
+#include "constants.hpp"
+#include <hdf5.h>
+#include <string>
+#include <vector>
+
+namespace edge {
+  namespace io {
+    class Hdf5;
+  }
+}
+
+/**
+ * The mesh is written once to <file>_mesh.h5:
+ *   /coords:  #vertices x 3 coordinates of the vertices (double),
+ *   /connect: #elements x #vertices_per_element global vertex ids (uint64).
+ * Every snapshot is written to <file>_<step>.h5:
+ *   /dofs: (#cruns*#quantities*#modes) x #elements modal DOFs (float), rows are ordered by crun, quantity and mode (fastest).
+ *          #modes is either 1 (cell averages) or N_ELEMENT_MODES (full high-order solution).
+ *          The root attributes order, n_modes and element_type allow the evaluation of the DG basis (dg::Basis) in post-processing.
+ * Elements and vertices are ordered by rank; vertices shared by ranks are stored once per rank.
+ * Rank 0 maintains the XDMF descriptor <file>.xdmf which references all written snapshots; every snapshot appends a grid to it.
+ **/
+class edge::io::Hdf5 {
+  private:
+    //! output path without extensions
+    std::string m_outFile;
+
+    //! number of local print elements
+    std::size_t m_nEls;
+
+    //! offset of the local elements in the global numbering
+    std::size_t m_elOff;
+
+    //! global number of print elements
+    std::size_t m_nElsGl;
+
+    //! global number of vertices
+    std::size_t m_nVesGl;
+
+    //! number of written modes per quantity and element
+    unsigned short m_nMds;
+
+    //! deflate level of the DOF datasets, 0 disables compression
+    unsigned short m_comp;
+
+    //! staged dofs in single precision, storage is element as ld, then modes, then quantities, then cruns (slowest dim).
+    float *m_dofs;
+
+    //! closing tags of the XDMF descriptor, which are overwritten by every appended snapshot
+    std::string const m_xdmfFtr = "  </Grid>\n </Domain>\n</Xdmf>\n";
+
+    //! XDMF topology type of the elements
+    std::string m_topoType;
+
+    //! data transfer property list (collective if available)
+    hid_t m_dxpl;
+
+    /**
+     * Creates (overwrites) an HDF5 file, which is accessed by all ranks.
+     *
+     * @param i_path path to the file.
+     * @return file id.
+     **/
+    static hid_t create( std::string const & i_path );
+
+    /**
+     * Writes the local block of a two-dimensional dataset.
+     * All ranks have to call the function, ranks without data pass empty blocks.
+     *
+     * @param i_file file in which the dataset is created.
+     * @param i_name name of the dataset.
+     * @param i_memType HDF5 type of the buffer.
+     * @param i_fileType HDF5 type of the data in the file.
+     * @param i_dimsGl global dimensions of the dataset.
+     * @param i_off offset of the local block.
+     * @param i_count size of the local block.
+     * @param i_data local data.
+     * @param i_comp deflate level (0: no compression), compressed datasets are chunked.
+     **/
+    void  writeDset( hid_t               i_file,
+                     std::string const & i_name,
+                     hid_t               i_memType,
+                     hid_t               i_fileType,
+                     hsize_t     const   i_dimsGl[2],
+                     hsize_t     const   i_off[2],
+                     hsize_t     const   i_count[2],
+                     void        const * i_data,
+                     unsigned short      i_comp = 0 );
+
+    /**
+     * Writes a scalar integer attribute to the root group of a file.
+     *
+     * @param i_file file to which the attribute is written.
+     * @param i_name name of the attribute.
+     * @param i_val value of the attribute.
+     **/
+    static void writeAttr( hid_t               i_file,
+                           std::string const & i_name,
+                           int                 i_val );
+
+    /**
+     * Writes the XDMF descriptor without snapshots.
+     **/
+    void initXdmf();
+
+    /**
+     * Appends a snapshot to the XDMF descriptor.
+     * Only the closing tags at the end of the file are rewritten.
+     *
+     * @param i_step id of the snapshot.
+     * @param i_time simulation time of the snapshot.
+     **/
+    void appendXdmf( std::size_t i_step,
+                     double      i_time );
+
+  public:
+    /**
+     * Constructor, which writes the mesh.
+     * All ranks have to call the constructor.
+     *
+     * @param i_outFile output path without extensions.
+     * @param i_nVes number of local vertices.
+     * @param i_elPrint local elements, which are written.
+     * @param i_veChars vertex characteristics.
+     * @param i_elVe vertices adjacent to the elements.
+     * @param i_allModes if true, all modes are written rather than the cell averages only.
+     * @param i_comp deflate level of the DOF datasets (0-9), 0 disables compression.
+     **/
+    Hdf5( std::string                const    & i_outFile,
+          int_el                                i_nVes,
+          std::vector< int_el >      const    & i_elPrint,
+          t_vertexChars              const    * i_veChars,
+          int_el                     const   (* i_elVe)[C_ENT[T_SDISC.ELEMENT].N_VERTICES],
+          bool                                  i_allModes = false,
+          unsigned short                        i_comp = 0 );
+
+    /**
+     * Destructor.
+     **/
+    ~Hdf5();
+
+    /**
+     * Writes a snapshot of the DOFs.
+     * All ranks have to call the function, it uses collective I/O if supported by the HDF5 build.
+     *
+     * @param i_step id of the snapshot.
+     * @param i_time simulation time of the snapshot.
+     * @param i_elPrint local elements, which are written.
+     * @param i_dofs DOFs.
+     **/
+    void write( std::size_t                           i_step,
+                double                                i_time,
+                std::vector< int_el >       const   & i_elPrint,
+                real_base                   const  (* i_dofs)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS] );
+};
+
+#endif
+#endif
@@ -29,6 +29,21 @@
 #include <set>
 #include <fstream>
 #include <sstream>
+#include <cstdint>
+
+void edge::io::Receivers::setFormat( std::string const & i_format ) {
+  EDGE_CHECK( m_recvs.size() == 0 ) << "the format has to be set before the initialization";
+
+  if(      i_format == "csv" ) m_bin = false;
+  else if( i_format == "bin" ) m_bin = true;
+  else EDGE_LOG_FATAL << "unknown receiver format: " << i_format;
+}
+
+void edge::io::Receivers::setAppend( bool i_append ) {
+  EDGE_CHECK( m_recvs.size() == 0 ) << "appending has to be set before the initialization";
+
+  m_append = i_append;
+}
 
 void edge::io::Receivers::init( t_entityType             i_enType,
                                 unsigned short           i_nTgs,
@@ -195,12 +210,68 @@ void edge::io::Receivers::touchOutput( std::string const (*i_recvNames),
   }
   l_colNames += '\n';
 
+  // write header of the binary file
+  if( m_bin ) {
+    if( m_recvs.size() == 0 ) return;
+
+    std::string l_dir, l_file;
+    FileSystem::splitPathLast( m_recvs[0].path, l_dir, l_file );
+
+    m_binFile.open( l_dir + "/receivers.bin", std::ios::binary | (m_append ? std::ios::app | std::ios::ate : std::ios::trunc) );
+    if( !m_binFile.is_open() ) EDGE_LOG_FATAL << "could not open the binary recv-file in: " << l_dir;
+    if( m_append && m_binFile.tellp() > 0 ) return;
+
+    auto l_writeU32 = [this]( std::size_t i_val ) {
+      uint32_t l_val = i_val;
+      m_binFile.write( (char const *) &l_val, sizeof(uint32_t) );
+    };
+    auto l_writeStr = [this, l_writeU32]( std::string const & i_str ) {
+      l_writeU32( i_str.size() );
+      m_binFile.write( i_str.data(), i_str.size() );
+    };
+
+    m_binFile.write( "EDGERECV", 8 );
+    l_writeU32( 1 );
+    l_writeU32( sizeof(real_base) );
+    l_writeU32( m_nQts );
+    l_writeU32( N_CRUNS );
+    l_writeU32( m_recvs.size() );
+    l_writeStr( PP_EDGE_VERSION );
+
+    for( std::size_t l_re = 0; l_re < m_recvs.size(); l_re++ ) {
+      unsigned int l_id = m_recvs[l_re].id;
+
+      // name and specified coordinates, fall back to the file name and projected coordinates
+      std::string l_name;
+      double l_crdsSp[3];
+      if( i_recvNames != nullptr && i_recvCrds != nullptr ) {
+        l_name = i_recvNames[l_id];
+        for( unsigned short l_di = 0; l_di < 3; l_di++ ) l_crdsSp[l_di] = i_recvCrds[l_id][l_di];
+      }
+      else {
+        FileSystem::splitPathLast( m_recvs[l_re].path, l_dir, l_name );
+        l_name = l_name.substr( 0, l_name.size()-4 );
+        for( unsigned short l_di = 0; l_di < 3; l_di++ ) l_crdsSp[l_di] = m_recvs[l_re].coords[l_di];
+      }
+
+      l_writeStr( l_name );
+      m_binFile.write( (char const *) l_crdsSp,               3*sizeof(double) );
+      m_binFile.write( (char const *) m_recvs[l_re].coords, 3*sizeof(double) );
+    }
+    if( !m_binFile.good() ) EDGE_LOG_FATAL << "failed writing the header of the binary recv-file";
+
+    return;
+  }
+
   // write header
   for( std::size_t l_re = 0; l_re < m_recvs.size(); l_re++ ) {
     std::ofstream l_file;
-    l_file.open( m_recvs[l_re].path );
+    if( m_append ) l_file.open( m_recvs[l_re].path, std::ios_base::app | std::ios_base::ate );
+    else           l_file.open( m_recvs[l_re].path );
 
     if( l_file.is_open() ) {
+      if( m_append && l_file.tellp() > 0 ) continue;
+
       unsigned int l_id = m_recvs[l_re].id;
 
       l_file << l_headerSh;
@@ -289,37 +360,130 @@ void edge::io::Receivers::writeRecvAll(       int_el    i_spEn,
   }
 }
 
-void edge::io::Receivers::flush( unsigned int i_re ) {
-  std::ofstream l_file;
-  if( m_recvs[i_re].nBuff > 0 ) {
-    l_file.open( m_recvs[i_re].path, std::ios_base::app );
+void edge::io::Receivers::write( Drain const & i_drain ) {
+  unsigned int l_nVas = m_nQts*N_CRUNS;
 
-    if( l_file.is_open() ) {
-      // stream buffer
-      std::ostringstream l_stream;
-
-      // assemble output stream
-      for( unsigned int l_bu = 0; l_bu < m_recvs[i_re].nBuff; l_bu++ ) {
-        // write time info
-        l_stream << std::to_string( m_recvs[i_re].buffTime[l_bu] );
-        // write recv values
-        for( unsigned int l_va = 0; l_va < m_nQts*N_CRUNS; l_va++ ) {
-          l_stream << "," << std::scientific << m_recvs[i_re].buffer[ l_bu*m_nQts*N_CRUNS+l_va ];
-        }
-        l_stream << "\n";
+  // single block of the receiver in the binary file
+  if( m_bin ) {
+    uint32_t l_hd[2] = { uint32_t(i_drain.re), uint32_t(i_drain.nBuff) };
+    m_binFile.write( (char const *) l_hd, sizeof(l_hd) );
+    m_binFile.write( (char const *) i_drain.buffTime.data(), sizeof(real_base) * i_drain.nBuff );
+    m_binFile.write( (char const *) i_drain.buffer.data(),   sizeof(real_base) * i_drain.nBuff * l_nVas );
+
+    if( !m_binFile.good() ) EDGE_LOG_FATAL << "could not write to the binary recv-file";
+    return;
+  }
+
+  std::string const & l_path = m_recvs[i_drain.re].path;
+  std::ofstream l_file;
+  l_file.open( l_path, std::ios_base::app );
+
+  if( l_file.is_open() ) {
+    // stream buffer
+    std::ostringstream l_stream;
+
+    // assemble output stream
+    for( unsigned int l_bu = 0; l_bu < i_drain.nBuff; l_bu++ ) {
+      // write time info
+      l_stream << std::to_string( i_drain.buffTime[l_bu] );
+      // write recv values
+      for( unsigned int l_va = 0; l_va < l_nVas; l_va++ ) {
+        l_stream << "," << std::scientific << i_drain.buffer[ l_bu*l_nVas+l_va ];
       }
+      l_stream << "\n";
+    }
+
+    // write stream to file
+    l_file << l_stream.str();
+  }
+  else EDGE_LOG_FATAL << "could not open the recv-file: " << l_path;
+}
+
+void edge::io::Receivers::ioLoop() {
+  std::unique_lock< std::mutex > l_lock( m_mtx );
+
+  while( true ) {
+    m_cv.wait( l_lock, [this]{ return m_stop || !m_queue.empty(); } );
+
+    // shutdown once everything is drained
+    if( m_queue.empty() ) break;
 
-      // write stream to file
-      l_file << l_stream.str();
+    Drain l_drain = std::move( m_queue.front() );
+    m_queue.pop_front();
+    m_writing = true;
+
+    // write without holding the lock
+    l_lock.unlock();
+    write( l_drain );
+    l_lock.lock();
+
+    // return the buffers for reuse
+    m_pool.push_back( std::move( l_drain ) );
+
+    // push the binary data to the OS once idle
+    if( m_bin && m_queue.empty() ) {
+      l_lock.unlock();
+      m_binFile.flush();
+      l_lock.lock();
     }
-    else EDGE_LOG_FATAL << "could not open the recv-file: " << m_recvs[i_re].path;
+
+    m_writing = false;
+    if( m_queue.empty() ) m_cvIdle.notify_all();
   }
+}
+
+void edge::io::Receivers::flush( unsigned int i_re ) {
+  if( m_recvs[i_re].nBuff == 0 ) return;
+
+  // get recycled buffers if available
+  Drain l_drain;
+  {
+    std::lock_guard< std::mutex > l_lock( m_mtx );
+    if( m_pool.size() > 0 ) {
+      l_drain = std::move( m_pool.back() );
+      m_pool.pop_back();
+    }
+  }
+  l_drain.buffer.resize(   m_recvs[i_re].buffer.size()   );
+  l_drain.buffTime.resize( m_recvs[i_re].buffTime.size() );
+
+  // swap the buffers, the receiver continues with empty ones
+  l_drain.re    = i_re;
+  l_drain.nBuff = m_recvs[i_re].nBuff;
+  std::swap( l_drain.buffer,   m_recvs[i_re].buffer   );
+  std::swap( l_drain.buffTime, m_recvs[i_re].buffTime );
   m_recvs[i_re].nBuff = 0;
+
+  // queue the buffers for the I/O thread
+  {
+    std::lock_guard< std::mutex > l_lock( m_mtx );
+    if( !m_io.joinable() ) m_io = std::thread( &Receivers::ioLoop, this );
+    m_queue.push_back( std::move( l_drain ) );
+  }
+  m_cv.notify_one();
 }
 
 void edge::io::Receivers::flushAll() {
   // iterate over all receivers
   for( std::size_t l_re = 0; l_re < m_recvs.size(); l_re++ ) flush( l_re );
+
+  // wait for the I/O thread
+  {
+    std::lock_guard< std::mutex > l_lock( m_mtx );
+    m_stop = true;
+  }
+  m_cv.notify_one();
+  if( m_io.joinable() ) m_io.join();
+  m_stop = false;
+
+  if( m_binFile.is_open() ) m_binFile.flush();
+}
+
+void edge::io::Receivers::sync() {
+  for( std::size_t l_re = 0; l_re < m_recvs.size(); l_re++ ) flush( l_re );
+
+  std::unique_lock< std::mutex > l_lock( m_mtx );
+  m_cvIdle.wait( l_lock, [this]{ return m_queue.empty() && !m_writing; } );
 }
 
 void edge::io::Receivers::flushIf( unsigned int i_tresh ) {
@@ -27,6 +27,12 @@
 #include "constants.hpp"
 #include "data/EntityLayout.type"
 #include <string>
+#include <vector>
+#include <deque>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 namespace edge {
   namespace io {
@@ -63,6 +69,51 @@ class edge::io::Receivers {
     // receiver under control; entity ids are ascending
     std::vector< Recv > m_recvs;
 
+    //! swapped out buffers of a receiver, which wait for the I/O thread
+    struct Drain {
+      //! local id of the receiver
+      unsigned int re;
+      //! number of buffered values
+      unsigned int nBuff;
+      //! buffer
+      std::vector< real_base > buffer;
+      //! buffered times
+      std::vector< real_base > buffTime;
+    };
+
+    //! true if the output is written to a single binary file per rank rather than one csv-file per receiver
+    bool m_bin = false;
+
+    //! true if existing output files are continued rather than overwritten
+    bool m_append = false;
+
+    //! binary output file of this rank
+    std::ofstream m_binFile;
+
+    //! buffers waiting for the I/O thread
+    std::deque< Drain > m_queue;
+
+    //! drained buffers, which are reused in subsequent swaps
+    std::vector< Drain > m_pool;
+
+    //! lock of the queue and the pool
+    std::mutex m_mtx;
+
+    //! signals new buffers in the queue or the shutdown to the I/O thread
+    std::condition_variable m_cv;
+
+    //! signals the I/O thread becoming idle to waiting callers
+    std::condition_variable m_cvIdle;
+
+    //! true if the I/O thread is asked to finish
+    bool m_stop = false;
+
+    //! true while the I/O thread writes a dequeued buffer
+    bool m_writing = false;
+
+    //! background thread, which writes the buffers to disk
+    std::thread m_io;
+
     //! mapping from sparse entities to the (first) receiver
     std::vector< std::size_t > m_spEnToRecv;
 
@@ -85,14 +136,26 @@ class edge::io::Receivers {
                       real_mesh   const (*i_recvCrds)[3] = nullptr );
 
     /**
-     * Flushes a receiver to disk.
+     * Writes the buffered values of a receiver to disk.
+     *
+     * @param i_drain swapped out buffers of the receiver.
+     **/
+    void write( Drain const & i_drain );
+
+    /**
+     * Loop of the I/O thread, which writes the queued buffers until shutdown.
+     **/
+    void ioLoop();
+
+    /**
+     * Hands the receiver's buffers to the I/O thread and continues with empty ones.
      *
      * @param i_recv receiver which gets flushed.
      **/
     void flush( unsigned int i_recv );
 
     /**
-     * Flushes all receivers to disk.
+     * Flushes all receivers to disk and shuts down the I/O thread.
      **/
     void flushAll();
   public:
@@ -101,6 +164,30 @@ class edge::io::Receivers {
      **/
     ~Receivers() { flushAll(); };
 
+    /**
+     * Sets the output format; has to be called before the initialization.
+     *
+     * csv: one text file per receiver: <out_dir>/<rank>/<name>.csv
+     * bin: one append-only binary file per rank: <out_dir>/<rank>/receivers.bin
+     *      header: "EDGERECV", uint32 version (1), uint32 sizeof(real), uint32 #quantities, uint32 #cruns, uint32 #receivers,
+     *              uint32 length and characters of the code version,
+     *              per receiver: uint32 length and characters of the name, double specified coords[3], double projected coords[3].
+     *      blocks: uint32 receiver (local id), uint32 #samples, real times[#samples], real values[#samples][#quantities][#cruns].
+     *      tools/processing/recvs_bin_to_csv.py converts the binary files to csv-files.
+     *
+     * @param i_format format of the output (csv or bin).
+     **/
+    void setFormat( std::string const & i_format );
+
+    /**
+     * Continues existing output files rather than overwriting them, e.g., when restarting from a checkpoint;
+     * has to be called before the initialization.
+     * Headers are only written to empty files.
+     *
+     * @param i_append true if the output is appended.
+     **/
+    void setAppend( bool i_append );
+
     /**
      * Initialzes the receiver output.
      *   TODO: The current implementation is limited to elements.
@@ -167,10 +254,17 @@ class edge::io::Receivers {
 
     /**
      * Flushes receiver's buffers to disk if the remaining size in the buffer if below the treshold.
+     * The buffers are swapped and written by a background thread.
      *
      * @param i_treshold, which triggers writers if the buffers remaining entries is below. 
      **/
     virtual void flushIf( unsigned int i_tresh=50 );
+
+    /**
+     * Flushes all receivers and blocks until the I/O thread has written everything to disk.
+     * In contrast to the destructor, the I/O thread stays alive and the receivers remain usable, e.g., before checkpoints.
+     **/
+    void sync();
 };
 
 #endif
@@ -22,6 +22,7 @@
  **/
 #include <catch.hpp>
 #include "Receivers.h"
+#include <fstream>
 
 namespace edge {
   namespace test {
@@ -92,3 +93,193 @@ TEST_CASE( "Receivers: Initialization", "[receivers][init]" ) {
   REQUIRE( l_enRecv[0]     == 4 );
 #endif
 }
+
+TEST_CASE( "Receivers: Binary output", "[receivers][bin]" ) {
+#ifdef PP_T_ELEMENTS_TET4
+  std::string l_oDir = edge::test::g_tmpDir+"receivers_bin";
+
+  {
+    edge::io::Receivers l_recv;
+    l_recv.setFormat( "bin" );
+
+    // two receivers in the reference tet
+    real_mesh l_recvCrds[2][3] = { { 0.15, 0.15, 0.15 },
+                                   { 0.20, 0.10, 0.05 } };
+    t_vertexChars l_veChars[4] = { {{0.0, 0.0, 0.0}, 0},
+                                   {{1.0, 0.0, 0.0}, 0},
+                                   {{0.0, 1.0, 0.0}, 0},
+                                   {{0.0, 0.0, 1.0}, 0} };
+    int_el l_enVe[1][4] = { {0, 1, 2, 3} };
+    std::string l_recvNames[2] = { "r0", "r1" };
+    std::size_t l_nTgElsIn[1] = {1};
+    std::size_t l_nTgElsSe[1] = {0};
+
+    l_recv.init( TET4,
+                 1,
+                 l_nTgElsIn,
+                 l_nTgElsSe,
+                 2,
+                 l_oDir,
+                 l_recvNames,
+                 l_recvCrds,
+                 0.5,
+                 l_enVe[0],
+                 l_veChars,
+                 4 );
+
+    // constant DOFs: only the first mode is set
+    real_base l_dofs[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS] = {};
+    for( unsigned short l_sa = 0; l_sa < 3; l_sa++ ) {
+      for( unsigned short l_qt = 0; l_qt < N_QUANTITIES; l_qt++ )
+        for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ )
+          l_dofs[l_qt][0][l_cr] = l_sa*100 + l_qt*N_CRUNS + l_cr;
+
+      l_recv.writeRecvAll( 0, l_dofs );
+      // swap the buffers of the first two samples
+      if( l_sa == 1 ) l_recv.flushIf( 4 );
+    }
+  }
+
+  // read the file
+  std::ifstream l_file( l_oDir+"/0/receivers.bin", std::ios::binary );
+  REQUIRE( l_file.is_open() );
+
+  auto l_readU32 = [&l_file]() {
+    uint32_t l_val;
+    l_file.read( (char *) &l_val, sizeof(uint32_t) );
+    return l_val;
+  };
+
+  char l_magic[8];
+  l_file.read( l_magic, 8 );
+  REQUIRE( std::string( l_magic, 8 ) == "EDGERECV" );
+  REQUIRE( l_readU32() == 1 );
+  REQUIRE( l_readU32() == sizeof(real_base) );
+  REQUIRE( l_readU32() == N_QUANTITIES );
+  REQUIRE( l_readU32() == N_CRUNS );
+  REQUIRE( l_readU32() == 2 );
+
+  // skip code version
+  l_file.seekg( l_readU32(), std::ios::cur );
+
+  for( unsigned short l_re = 0; l_re < 2; l_re++ ) {
+    REQUIRE( l_readU32() == 2 );
+    char l_name[2];
+    l_file.read( l_name, 2 );
+    REQUIRE( std::string( l_name, 2 ) == "r" + std::to_string(l_re) );
+    double l_crds[6];
+    l_file.read( (char *) l_crds, 6*sizeof(double) );
+  }
+
+  // first two samples of both receivers, then the last sample of both
+  unsigned short l_nVas = N_QUANTITIES*N_CRUNS;
+  unsigned int l_nSas[4] = { 2, 2, 1, 1 };
+  unsigned int l_sa0[4]  = { 0, 0, 2, 2 };
+  for( unsigned short l_bl = 0; l_bl < 4; l_bl++ ) {
+    REQUIRE( l_readU32() == l_bl%2 );
+    REQUIRE( l_readU32() == l_nSas[l_bl] );
+
+    std::vector< real_base > l_times( l_nSas[l_bl] );
+    std::vector< real_base > l_vals( l_nSas[l_bl]*l_nVas );
+    l_file.read( (char *) l_times.data(), sizeof(real_base)*l_times.size() );
+    l_file.read( (char *) l_vals.data(),  sizeof(real_base)*l_vals.size()  );
+
+    for( unsigned int l_sa = 0; l_sa < l_nSas[l_bl]; l_sa++ ) {
+      REQUIRE( l_times[l_sa] == Approx( (l_sa0[l_bl]+l_sa)*0.5 ) );
+      // the first basis function is constant one
+      for( unsigned short l_va = 0; l_va < l_nVas; l_va++ )
+        REQUIRE( l_vals[l_sa*l_nVas+l_va] == Approx( (l_sa0[l_bl]+l_sa)*100 + l_va ) );
+    }
+  }
+
+  l_file.peek();
+  REQUIRE( l_file.eof() );
+#endif
+}
+
+TEST_CASE( "Receivers: Sync", "[receivers][sync]" ) {
+#ifdef PP_T_ELEMENTS_TET4
+  std::string l_oDir = edge::test::g_tmpDir+"receivers_sync";
+
+  edge::io::Receivers l_recv;
+  l_recv.setFormat( "bin" );
+
+  // two receivers in the reference tet
+  real_mesh l_recvCrds[2][3] = { { 0.15, 0.15, 0.15 },
+                                 { 0.20, 0.10, 0.05 } };
+  t_vertexChars l_veChars[4] = { {{0.0, 0.0, 0.0}, 0},
+                                 {{1.0, 0.0, 0.0}, 0},
+                                 {{0.0, 1.0, 0.0}, 0},
+                                 {{0.0, 0.0, 1.0}, 0} };
+  int_el l_enVe[1][4] = { {0, 1, 2, 3} };
+  std::string l_recvNames[2] = { "r0", "r1" };
+  std::size_t l_nTgElsIn[1] = {1};
+  std::size_t l_nTgElsSe[1] = {0};
+
+  l_recv.init( TET4,
+               1,
+               l_nTgElsIn,
+               l_nTgElsSe,
+               2,
+               l_oDir,
+               l_recvNames,
+               l_recvCrds,
+               0.5,
+               l_enVe[0],
+               l_veChars,
+               4 );
+
+  real_base l_dofs[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS] = {};
+  for( unsigned short l_sa = 0; l_sa < 3; l_sa++ ) {
+    for( unsigned short l_qt = 0; l_qt < N_QUANTITIES; l_qt++ )
+      for( unsigned short l_cr = 0; l_cr < N_CRUNS; l_cr++ )
+        l_dofs[l_qt][0][l_cr] = l_sa*100 + l_qt*N_CRUNS + l_cr;
+
+    l_recv.writeRecvAll( 0, l_dofs );
+  }
+
+  // all samples are on disk while the receivers are still alive, as required before a checkpoint
+  l_recv.sync();
+
+  std::ifstream l_file( l_oDir+"/0/receivers.bin", std::ios::binary );
+  REQUIRE( l_file.is_open() );
+
+  auto l_readU32 = [&l_file]() {
+    uint32_t l_val;
+    l_file.read( (char *) &l_val, sizeof(uint32_t) );
+    return l_val;
+  };
+
+  // skip the header
+  l_file.seekg( 8 + 5*sizeof(uint32_t) );
+  l_file.seekg( l_readU32(), std::ios::cur );
+  for( unsigned short l_re = 0; l_re < 2; l_re++ ) {
+    l_file.seekg( l_readU32() + 6*sizeof(double), std::ios::cur );
+  }
+
+  unsigned short l_nVas = N_QUANTITIES*N_CRUNS;
+  for( unsigned short l_re = 0; l_re < 2; l_re++ ) {
+    REQUIRE( l_readU32() == l_re );
+    REQUIRE( l_readU32() == 3 );
+
+    std::vector< real_base > l_times( 3 );
+    std::vector< real_base > l_vals( 3*l_nVas );
+    l_file.read( (char *) l_times.data(), sizeof(real_base)*l_times.size() );
+    l_file.read( (char *) l_vals.data(),  sizeof(real_base)*l_vals.size()  );
+    REQUIRE( l_file.good() );
+
+    for( unsigned int l_sa = 0; l_sa < 3; l_sa++ ) {
+      REQUIRE( l_times[l_sa] == Approx( l_sa*0.5 ) );
+      for( unsigned short l_va = 0; l_va < l_nVas; l_va++ )
+        REQUIRE( l_vals[l_sa*l_nVas+l_va] == Approx( l_sa*100 + l_va ) );
+    }
+  }
+
+  l_file.peek();
+  REQUIRE( l_file.eof() );
+
+  // the receivers remain usable after the sync
+  l_recv.writeRecvAll( 0, l_dofs );
+  l_recv.sync();
+#endif
+}
@@ -23,6 +23,7 @@
 
 #include "data/common.hpp"
 #include "Vtk.h"
+#include "logging.h"
 #include "submodules/visit_writer/visit_writer.h"
 
 void edge::io::Vtk::init(       int_el                 i_nVe,
@@ -32,8 +33,12 @@ void edge::io::Vtk::init(       int_el                 i_nVe,
   // allocate buffers for output matching the format of the visit_writer
   m_coordsVe       = (float*)  data::common::allocate( sizeof(float)  * i_nVe * 3                                            );
   m_connElVe       = (int*)    data::common::allocate( sizeof(int)    * i_elPrint.size() * C_ENT[T_SDISC.ELEMENT].N_VERTICES );
-  m_dofs           = (float*)  data::common::allocate( sizeof(float)  * i_elPrint.size() * N_QUANTITIES * N_CRUNS        );
-  m_ptrs           = (float**) data::common::allocate( sizeof(float*)                    * N_QUANTITIES * N_CRUNS        );
+  for( unsigned short l_bu = 0; l_bu < 2; l_bu++ ) {
+    m_dofs[l_bu]   = (float*)  data::common::allocate( sizeof(float)  * i_elPrint.size() * N_QUANTITIES * N_CRUNS        );
+    m_ptrs[l_bu]   = (float**) data::common::allocate( sizeof(float*)                    * N_QUANTITIES * N_CRUNS        );
+  }
+  m_nVes      = i_nVe;
+  m_nElsPrint = i_elPrint.size();
 
   // set the visit element type dependent on our build config
   if(       T_SDISC.ELEMENT == LINE   ) m_visitElType = VISIT_LINE;
@@ -51,7 +56,8 @@ void edge::io::Vtk::init(       int_el                 i_nVe,
       m_varNames[   l_run*N_QUANTITIES+l_q] =   "crun_" + std::to_string( (unsigned long long) l_run)
                                               + "_var_" + std::to_string( (unsigned long long) l_q);
       m_varNamesC[  l_run*N_QUANTITIES+l_q] = m_varNames[l_run*N_QUANTITIES+l_q].c_str();
-      m_ptrs[l_run*N_QUANTITIES+l_q]    = m_dofs+(i_elPrint.size()*(N_QUANTITIES*l_run + l_q));
+      for( unsigned short l_bu = 0; l_bu < 2; l_bu++ )
+        m_ptrs[l_bu][l_run*N_QUANTITIES+l_q] = m_dofs[l_bu]+(i_elPrint.size()*(N_QUANTITIES*l_run + l_q));
     }
   }
 
@@ -75,13 +81,14 @@ edge::io::Vtk::~Vtk() {
   if( m_initialized ) {
      data::common::release( m_coordsVe );
      data::common::release( m_connElVe );
-     data::common::release( m_dofs     );
-     data::common::release( m_ptrs     );
+     for( unsigned short l_bu = 0; l_bu < 2; l_bu++ ) {
+       data::common::release( m_dofs[l_bu] );
+       data::common::release( m_ptrs[l_bu] );
+     }
   }
 }
 
-void edge::io::Vtk::write( const std::string           &i_outFile,
-                                 bool                   i_binary,
+void edge::io::Vtk::stage(       unsigned short         i_buf,
                                  int_el                 i_nVe,
                            const std::vector< int_el > &i_elPrint,
                            const t_vertexChars         *i_veChars,
@@ -98,24 +105,52 @@ void edge::io::Vtk::write( const std::string           &i_outFile,
   }
 
   // reorder the DOFs and fill the buffer
+  float *l_dofs = m_dofs[i_buf];
+#ifdef PP_USE_OMP
+#pragma omp parallel for
+#endif
   for( int_el l_el = 0; l_el < (int_el) i_elPrint.size(); l_el++ ) {
     int_el l_elId = i_elPrint[l_el];
     for( int_md l_q = 0; l_q < N_QUANTITIES; l_q++ ) {
       for( int_cfr l_crun = 0; l_crun < N_CRUNS; l_crun++ ) {
-        m_dofs[i_elPrint.size()*(N_QUANTITIES*l_crun + l_q) + l_el] = i_dofs[l_elId][l_q][0][l_crun];
+        l_dofs[i_elPrint.size()*(N_QUANTITIES*l_crun + l_q) + l_el] = i_dofs[l_elId][l_q][0][l_crun];
       }
     }
   }
+}
+
+void edge::io::Vtk::flush( unsigned short     i_buf,
+                           std::string const &i_outFile,
+                           bool               i_binary ) {
+  EDGE_CHECK( m_initialized );
 
-  // write the data, now..
   edge_write_unstructured_mesh( i_outFile.c_str(),
                                 i_binary,
-                                i_nVe,
+                                m_nVes,
                                 m_coordsVe,
                                 N_CRUNS*N_QUANTITIES,
-                                i_elPrint.size(),
+                                m_nElsPrint,
                                 m_visitElType,
                                 m_connElVe,
                                 m_varNamesC,
-                                m_ptrs );
+                                m_ptrs[i_buf] );
+}
+
+void edge::io::Vtk::write( const std::string           &i_outFile,
+                                 bool                   i_binary,
+                                 int_el                 i_nVe,
+                           const std::vector< int_el > &i_elPrint,
+                           const t_vertexChars         *i_veChars,
+                           const int_el               (*i_elVe)[C_ENT[T_SDISC.ELEMENT].N_VERTICES],
+                           const real_base            (*i_dofs)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS]) {
+  stage( 0,
+         i_nVe,
+         i_elPrint,
+         i_veChars,
+         i_elVe,
+         i_dofs );
+
+  flush( 0,
+         i_outFile,
+         i_binary );
 }
@@ -46,11 +46,17 @@ class edge::io::Vtk {
     //! connectivity information of elements to vertices.
     int *m_connElVe;
 
-    //! 1st order dofs in single precision, storage is element as ld, then quantities, then cruns (slowest dim).
-    float *m_dofs;
+    //! number of print elements
+    int_el m_nElsPrint;
 
-    //! pointers to the stride-1 element regions.
-    float **m_ptrs;
+    //! number of vertices
+    int_el m_nVes;
+
+    //! double-buffered 1st order dofs in single precision, storage is element as ld, then quantities, then cruns (slowest dim).
+    float *m_dofs[2];
+
+    //! pointers to the stride-1 element regions of both buffers.
+    float **m_ptrs[2];
 
     //! element type used in visit_writer lib.
     int m_visitElType;
@@ -80,7 +86,7 @@ class edge::io::Vtk {
      * Vtk uses a slightly modifided version of the visit_writer library.
      * Vtk usage internal storage matching the internal of visit_writer: Even though it is single precision,
      * the overhead >50% of the 1st order DOFs requirements. Future implementations might work with a buffer to reduce this.
-     * Remark: The respective data structures are initialized in the first call of write([...]).
+     * Remark: The respective data structures are initialized in the first call of write([...]) or stage([...]).
      *         -> Constructing a Vtk writer has almost no overhead.
      **/
     Vtk(): m_initialized(false){};
@@ -90,6 +96,36 @@ class edge::io::Vtk {
      **/
     ~Vtk();
 
+    /**
+     * Stages the 1st order DOFs in one of the two output buffers.
+     * If this function is called for the first time, the data structures of Vtk are allocated and initialized.
+     *
+     * @param i_buf buffer (0 or 1) which is filled.
+     * @param i_nVe number of vertices.
+     * @param i_elPrint print elements.
+     * @param i_veChars vertex characteristics.
+     * @param i_elVe ids of the elements' adjacent vertices.
+     * @param i_dofs DOFs.
+     **/
+    void stage(       unsigned short         i_buf,
+                      int_el                 i_nVe,
+                const std::vector< int_el > &i_elPrint,
+                const t_vertexChars         *i_veChars,
+                const int_el               (*i_elVe)[C_ENT[T_SDISC.ELEMENT].N_VERTICES],
+                const real_base            (*i_dofs)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS] );
+
+    /**
+     * Writes a previously staged buffer through visit_writer.
+     * The call only accesses Vtk's internal data and is safe to run concurrently to stage([...]) of the other buffer.
+     *
+     * @param i_buf buffer (0 or 1) which is written.
+     * @param i_outFile file to which the output is written.
+     * @param i_binary true for binary output.
+     **/
+    void flush( unsigned short     i_buf,
+                std::string const &i_outFile,
+                bool               i_binary );
+
     /**
      * Interface to visit_writer output.
      * If this function is called for the first time, the data structures of Vtk are allocated and initialized.
@@ -39,11 +39,15 @@ edge::io::WaveField::WaveField( std::string             i_type,
                                 t_elementChars const  * i_elChars,
                                 std::size_t    const (* i_elVe)[C_ENT[T_SDISC.ELEMENT].N_VERTICES],
                                 real_base      const (* i_dofs)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS],
-                                int_spType              i_spType ):
+                                int_spType              i_spType,
+                                bool                    i_async,
+                                bool                    i_allModes,
+                                unsigned short          i_comp ):
  m_veChars(i_veChars),
  m_elVe(i_elVe),
  m_dofs(i_dofs),
- m_nVes(i_nVes) {
+ m_nVes(i_nVes),
+ m_async(i_async) {
   for( std::size_t l_el = 0; l_el < i_nEls; l_el++ ) {
     // only add if element has the desired sparse type
     if(     i_spType == std::numeric_limits< int_spType >::max()
@@ -73,10 +77,19 @@ edge::io::WaveField::WaveField( std::string             i_type,
 
   if(      i_type == "vtk_ascii"  ) m_type = vtkAscii;
   else if( i_type == "vtk_binary" ) m_type = vtkBinary;
+  else if( i_type == "hdf5"       ) m_type = hdf5;
   else                              m_type = none;
 
+  if( m_type != hdf5 && (i_allModes || i_comp > 0) ) {
+    EDGE_LOG_FATAL << "high-order and compressed wave field output require the type hdf5";
+  }
+
+#ifndef PP_HAS_HDF5
+  if( m_type == hdf5 ) EDGE_LOG_FATAL << "HDF5 is required for the wave field output of type hdf5 and not supported by your build.";
+#endif
+
   // create new directory
-  if( m_type != none ) {
+  if( m_type == vtkAscii || m_type == vtkBinary ) {
     EDGE_LOG_INFO << "setting up wave field output";
     std::string l_dir, l_file;
     FileSystem::splitPathLast( i_outFile, l_dir, l_file );
@@ -90,25 +103,94 @@ edge::io::WaveField::WaveField( std::string             i_type,
     }
   }
 
+#ifdef PP_HAS_HDF5
+  // single set of files shared by all ranks
+  if( m_type == hdf5 ) {
+    EDGE_LOG_INFO << "setting up wave field output (HDF5/XDMF)";
+    std::string l_dir, l_file;
+    FileSystem::splitPathLast( i_outFile, l_dir, l_file );
+    if( parallel::g_rank == 0 ) FileSystem::createDir( l_dir );
+#ifdef PP_USE_MPI
+    MPI_Barrier( MPI_COMM_WORLD );
+#endif
+    m_outFile = i_outFile;
+
+    m_hdf5 = new Hdf5( m_outFile,
+                       m_nVes,
+                       m_elPrint,
+                       m_veChars,
+                       m_elVe,
+                       i_allModes,
+                       i_comp );
+  }
+#endif
+
   m_writeStep = 0;
 }
 
+edge::io::WaveField::~WaveField() {
+  wait();
+#ifdef PP_HAS_HDF5
+  if( m_hdf5 != nullptr ) delete m_hdf5;
+#endif
+}
+
+void edge::io::WaveField::wait() {
+  PP_INSTR_FUN("wait_wf")
+
+  // get() rethrows exceptions of the background thread
+  if( m_pending.valid() ) m_pending.get();
+}
+
 void edge::io::WaveField::write( double i_time ) {
   PP_INSTR_FUN("write_wf")
 
+#ifdef PP_HAS_HDF5
+  // collective output, all ranks participate
+  if( m_type == hdf5 ) {
+    m_hdf5->write( m_writeStep,
+                   i_time,
+                   m_elPrint,
+                   m_dofs );
+    m_writeStep++;
+    return;
+  }
+#endif
+
   // create file name
   std::string l_outFile = m_outFile;
   l_outFile += "_" + parallel::g_rankStr + "_" + std::to_string((unsigned long long) m_writeStep) + ".vtk";
 
   // write output
-  if( m_elPrint.size() > 0 )
-    m_vtk.write( l_outFile,
-                  m_type==vtkBinary,
-                  m_nVes,
-                  m_elPrint,
-                  m_veChars,
-                  m_elVe,
-                  m_dofs );
+  if( m_elPrint.size() > 0 ) {
+    // alternate the buffers, the previous write might still read the other one
+    unsigned short l_buf = m_writeStep % 2;
+
+    m_vtk.stage( l_buf,
+                 m_nVes,
+                 m_elPrint,
+                 m_veChars,
+                 m_elVe,
+                 m_dofs );
+
+    // back-pressure: at most one write is in flight
+    wait();
+
+    bool l_binary = (m_type == vtkBinary);
+    if( m_async ) {
+      m_pending = std::async( std::launch::async,
+                              [this, l_buf, l_outFile, l_binary]() {
+                                m_vtk.flush( l_buf,
+                                             l_outFile,
+                                             l_binary );
+                              } );
+    }
+    else {
+      m_vtk.flush( l_buf,
+                   l_outFile,
+                   l_binary );
+    }
+  }
 
   m_writeStep++;
 }
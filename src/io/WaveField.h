@@ -26,9 +26,11 @@
 #define EDGE_IO_WAVE_FIELD_H
 
 #include "Vtk.h"
+#include "Hdf5.h"
 
 #include <string>
 #include <limits>
+#include <future>
 #include "constants.hpp"
 #include "data/EntityLayout.type"
 
@@ -42,11 +44,17 @@ class edge::io::WaveField {
   private:
     enum Type{ none,
                vtkAscii,
-               vtkBinary };
+               vtkBinary,
+               hdf5 };
 
     //! vtk interfaces
     Vtk m_vtk;
 
+#ifdef PP_HAS_HDF5
+    //! hdf5 interface
+    Hdf5 *m_hdf5 = nullptr;
+#endif
+
     //! type of the output
     Type m_type;
 
@@ -71,6 +79,12 @@ class edge::io::WaveField {
     //! print elements (unqiue owned elements)
     std::vector< std::size_t > m_elPrint;
 
+    //! true if the files are written by a background thread
+    bool m_async;
+
+    //! pending background write of the previous snapshot
+    std::future< void > m_pending;
+
   public:
     /**
      * Constructor of the DoF writer.
@@ -83,6 +97,9 @@ class edge::io::WaveField {
      * @param i_elVe vertices adjacent to the elements.
      * @param i_dofs location of degrees of freedom, which will get written in corresponding calls.
      * @param i_spType sparse type for elements, which are printed. If numeric_limits<>::max(), all elements are printed.
+     * @param i_async if true, the files are written by a background thread while the solver continues (ignored by the collective HDF5 output).
+     * @param i_allModes if true, all modes are written rather than the cell averages (HDF5 output only).
+     * @param i_comp deflate level of the DOFs, 0 disables compression (HDF5 output only).
      **/
     WaveField( std::string             i_type,
                std::string             i_outFile,
@@ -92,14 +109,36 @@ class edge::io::WaveField {
                t_elementChars const  * i_elChars,
                std::size_t    const (* i_elVe)[C_ENT[T_SDISC.ELEMENT].N_VERTICES],
                real_base      const (* i_dofs)[N_QUANTITIES][N_ELEMENT_MODES][N_CRUNS],
-               int_spType              i_spType = std::numeric_limits< int_spType >::max() );
+               int_spType              i_spType = std::numeric_limits< int_spType >::max(),
+               bool                    i_async = true,
+               bool                    i_allModes = false,
+               unsigned short          i_comp = 0 );
+
+    /**
+     * Destructor, which waits for pending writes.
+     **/
+    ~WaveField();
 
     /**
      * Writes the given dofs.
+     * The DOFs are staged in one of two buffers before the function returns.
+     * In asynchronous mode, the file is written in the background and a call blocks only if the previous write is still in progress.
      *
      * @param i_time time of this snapshot
      **/
     void write( double i_time );
+
+    /**
+     * Sets the id of the next snapshot, e.g., when continuing from a checkpoint.
+     *
+     * @param i_step id of the next snapshot.
+     **/
+    void setWriteStep( std::size_t i_step ) { m_writeStep = i_step; };
+
+    /**
+     * Waits for the completion of a pending background write.
+     **/
+    void wait();
 };
 
 #endif
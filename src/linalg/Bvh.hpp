@@ -0,0 +1,298 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Bounding volume hierarchy for point location.
+ **/
+#ifndef EDGE_LINALG_BVH_HPP
+#define EDGE_LINALG_BVH_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+#include "io/logging.h"
+
+namespace edge {
+  namespace linalg {
+    template< typename TL_T_REAL >
+    class Bvh;
+  }
+}
+
+/**
+ * Bounding volume hierarchy of axis-aligned bounding boxes.
+ *
+ * The hierarchy is built top-down by splitting the entities at the median of their centroids along the longest axis.
+ * Queries for the nearest and containing entities descend into the boxes, which might hold a result.
+ * The geometry of the entities is only accessed through user-provided functions, the hierarchy stores boxes and ids.
+ *
+ * @paramt TL_T_REAL floating point type.
+ **/
+template< typename TL_T_REAL >
+class edge::linalg::Bvh {
+  private:
+    //! maximum number of entities in a leaf
+    static unsigned short const N_LEAF = 4;
+
+    //! maximum depth of the hierarchy, limited by the median splits
+    static unsigned short const N_DEPTH = 128;
+
+    //! node of the hierarchy
+    typedef struct {
+      //! bounding box [0][*]: minimum, [1][*]: maximum coordinates
+      TL_T_REAL bb[2][3];
+      //! first entity in m_ids for leafs, id of the left child (right child follows) for inner nodes
+      std::size_t first;
+      //! number of entities for leafs, 0 for inner nodes
+      std::size_t size;
+    } t_node;
+
+    //! number of dimensions
+    unsigned short m_nDis = 3;
+
+    //! nodes of the hierarchy, root at position 0
+    std::vector< t_node > m_nodes;
+
+    //! ids of the entities, sorted by the leafs
+    std::vector< std::size_t > m_ids;
+
+    /**
+     * Gets the distance of a point to a bounding box.
+     *
+     * @param i_bb bounding box.
+     * @param i_pt coordinates of the point.
+     * @return distance, 0 if inside.
+     **/
+    TL_T_REAL dist( TL_T_REAL const i_bb[2][3],
+                    TL_T_REAL const i_pt[3] ) const {
+      TL_T_REAL l_dist = 0;
+      for( unsigned short l_di = 0; l_di < m_nDis; l_di++ ) {
+        TL_T_REAL l_diff = std::max( i_bb[0][l_di] - i_pt[l_di], TL_T_REAL(0) );
+                  l_diff = std::max( i_pt[l_di] - i_bb[1][l_di], l_diff );
+        l_dist += l_diff * l_diff;
+      }
+      return std::sqrt( l_dist );
+    }
+
+  public:
+    /**
+     * Builds the hierarchy.
+     *
+     * @param i_nDis number of dimensions.
+     * @param i_nEns number of entities.
+     * @param i_bbFun function which sets the bounding box of an entity: void( std::size_t i_en, TL_T_REAL o_bb[2][3] ).
+     *
+     * @paramt TL_T_BB_FUN type of the bounding box function.
+     **/
+    template< typename TL_T_BB_FUN >
+    void build( unsigned short i_nDis,
+                std::size_t    i_nEns,
+                TL_T_BB_FUN    i_bbFun ) {
+      EDGE_CHECK( i_nDis >= 1 && i_nDis <= 3 );
+      m_nDis = i_nDis;
+
+      m_nodes.clear();
+      m_ids.resize( i_nEns );
+      if( i_nEns == 0 ) return;
+
+      // derive the boxes' centroids
+      std::vector< TL_T_REAL > l_cens( i_nEns * 3 );
+      for( std::size_t l_en = 0; l_en < i_nEns; l_en++ ) {
+        TL_T_REAL l_bb[2][3];
+        i_bbFun( l_en, l_bb );
+        for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+          l_cens[l_en*3 + l_di] = TL_T_REAL(0.5) * ( l_bb[0][l_di] + l_bb[1][l_di] );
+        }
+        m_ids[l_en] = l_en;
+      }
+
+      // split the nodes top-down, children are always stored after their parents
+      m_nodes.reserve( 2 * (i_nEns / N_LEAF + 1) );
+      m_nodes.push_back( t_node{ {{0}}, 0, i_nEns } );
+
+      for( std::size_t l_no = 0; l_no < m_nodes.size(); l_no++ ) {
+        std::size_t l_first = m_nodes[l_no].first;
+        std::size_t l_size  = m_nodes[l_no].size;
+        if( l_size <= N_LEAF ) continue;
+
+        // longest axis of the centroids
+        TL_T_REAL l_cb[2][3];
+        for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+          l_cb[0][l_di] = std::numeric_limits< TL_T_REAL >::max();
+          l_cb[1][l_di] = std::numeric_limits< TL_T_REAL >::lowest();
+        }
+        for( std::size_t l_id = l_first; l_id < l_first+l_size; l_id++ ) {
+          for( unsigned short l_di = 0; l_di < m_nDis; l_di++ ) {
+            l_cb[0][l_di] = std::min( l_cb[0][l_di], l_cens[m_ids[l_id]*3 + l_di] );
+            l_cb[1][l_di] = std::max( l_cb[1][l_di], l_cens[m_ids[l_id]*3 + l_di] );
+          }
+        }
+        unsigned short l_ax = 0;
+        for( unsigned short l_di = 1; l_di < m_nDis; l_di++ ) {
+          if( l_cb[1][l_di] - l_cb[0][l_di] > l_cb[1][l_ax] - l_cb[0][l_ax] ) l_ax = l_di;
+        }
+
+        // split at the median
+        std::size_t l_half = l_size / 2;
+        std::nth_element( m_ids.begin() + l_first,
+                          m_ids.begin() + l_first + l_half,
+                          m_ids.begin() + l_first + l_size,
+                          [&]( std::size_t i_a, std::size_t i_b ) {
+                            return l_cens[i_a*3 + l_ax] < l_cens[i_b*3 + l_ax];
+                          } );
+
+        m_nodes[l_no].first = m_nodes.size();
+        m_nodes[l_no].size  = 0;
+        m_nodes.push_back( t_node{ {{0}}, l_first,          l_half          } );
+        m_nodes.push_back( t_node{ {{0}}, l_first + l_half, l_size - l_half } );
+      }
+
+      // derive the bounding boxes bottom-up
+      for( std::size_t l_no = m_nodes.size(); l_no > 0; l_no-- ) {
+        t_node & l_node = m_nodes[l_no-1];
+
+        for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+          l_node.bb[0][l_di] = std::numeric_limits< TL_T_REAL >::max();
+          l_node.bb[1][l_di] = std::numeric_limits< TL_T_REAL >::lowest();
+        }
+
+        // leaf: boxes of the entities; inner node: boxes of the children
+        std::size_t l_nBbs = (l_node.size > 0) ? l_node.size : 2;
+        for( std::size_t l_bi = 0; l_bi < l_nBbs; l_bi++ ) {
+          TL_T_REAL l_bb[2][3];
+          if( l_node.size > 0 ) i_bbFun( m_ids[l_node.first + l_bi], l_bb );
+          else {
+            for( unsigned short l_sd = 0; l_sd < 2; l_sd++ )
+              for( unsigned short l_di = 0; l_di < 3; l_di++ )
+                l_bb[l_sd][l_di] = m_nodes[l_node.first + l_bi].bb[l_sd][l_di];
+          }
+
+          for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+            l_node.bb[0][l_di] = std::min( l_node.bb[0][l_di], l_bb[0][l_di] );
+            l_node.bb[1][l_di] = std::max( l_node.bb[1][l_di], l_bb[1][l_di] );
+          }
+        }
+      }
+    }
+
+    /**
+     * Gets the number of nodes.
+     *
+     * @return number of nodes.
+     **/
+    std::size_t nNodes() const { return m_nodes.size(); }
+
+    /**
+     * Gets the entity, which is closest to the given point.
+     * Ties are resolved towards the smallest id.
+     *
+     * @param i_pt coordinates of the point.
+     * @param i_distFun function which returns the distance of the point to an entity: TL_T_REAL( std::size_t i_en ).
+     * @param o_dist will be set to the distance of the nearest entity.
+     * @return id of the nearest entity, std::numeric_limits< std::size_t >::max() if the hierarchy is empty.
+     *
+     * @paramt TL_T_DIST_FUN type of the distance function.
+     **/
+    template< typename TL_T_DIST_FUN >
+    std::size_t nearest( TL_T_REAL     const   i_pt[3],
+                         TL_T_DIST_FUN         i_distFun,
+                         TL_T_REAL           & o_dist ) const {
+      std::size_t l_nearest = std::numeric_limits< std::size_t >::max();
+      o_dist = std::numeric_limits< TL_T_REAL >::max();
+      if( m_nodes.size() == 0 ) return l_nearest;
+
+      std::size_t l_stack[N_DEPTH];
+      unsigned short l_nSt = 0;
+      l_stack[l_nSt++] = 0;
+
+      while( l_nSt > 0 ) {
+        t_node const & l_node = m_nodes[ l_stack[--l_nSt] ];
+        if( dist( l_node.bb, i_pt ) > o_dist ) continue;
+
+        if( l_node.size > 0 ) {
+          for( std::size_t l_id = l_node.first; l_id < l_node.first+l_node.size; l_id++ ) {
+            std::size_t l_en = m_ids[l_id];
+            TL_T_REAL l_dist = i_distFun( l_en );
+
+            if( l_dist < o_dist || ( l_dist == o_dist && l_en < l_nearest ) ) {
+              o_dist = l_dist;
+              l_nearest = l_en;
+            }
+          }
+        }
+        else {
+          // descend into the closer child first
+          TL_T_REAL l_dists[2] = { dist( m_nodes[l_node.first  ].bb, i_pt ),
+                                   dist( m_nodes[l_node.first+1].bb, i_pt ) };
+          unsigned short l_cl = (l_dists[1] < l_dists[0]) ? 1 : 0;
+
+          EDGE_CHECK_LE( l_nSt+2, N_DEPTH );
+          if( l_dists[1-l_cl] <= o_dist ) l_stack[l_nSt++] = l_node.first + 1 - l_cl;
+          if( l_dists[  l_cl] <= o_dist ) l_stack[l_nSt++] = l_node.first + l_cl;
+        }
+      }
+
+      return l_nearest;
+    }
+
+    /**
+     * Gets the entity with the smallest id, which contains the given point.
+     *
+     * @param i_pt coordinates of the point.
+     * @param i_insideFun function which returns true if an entity contains the point: bool( std::size_t i_en ).
+     * @param i_tol tolerance of the bounding boxes.
+     * @return id of the containing entity, std::numeric_limits< std::size_t >::max() if none.
+     *
+     * @paramt TL_T_INSIDE_FUN type of the inside function.
+     **/
+    template< typename TL_T_INSIDE_FUN >
+    std::size_t containing( TL_T_REAL       const i_pt[3],
+                            TL_T_INSIDE_FUN       i_insideFun,
+                            TL_T_REAL             i_tol = 0 ) const {
+      std::size_t l_cont = std::numeric_limits< std::size_t >::max();
+      if( m_nodes.size() == 0 ) return l_cont;
+
+      std::size_t l_stack[N_DEPTH];
+      unsigned short l_nSt = 0;
+      l_stack[l_nSt++] = 0;
+
+      while( l_nSt > 0 ) {
+        t_node const & l_node = m_nodes[ l_stack[--l_nSt] ];
+        if( dist( l_node.bb, i_pt ) > i_tol ) continue;
+
+        if( l_node.size > 0 ) {
+          for( std::size_t l_id = l_node.first; l_id < l_node.first+l_node.size; l_id++ ) {
+            std::size_t l_en = m_ids[l_id];
+            if( l_en < l_cont && i_insideFun( l_en ) ) l_cont = l_en;
+          }
+        }
+        else {
+          EDGE_CHECK_LE( l_nSt+2, N_DEPTH );
+          l_stack[l_nSt++] = l_node.first;
+          l_stack[l_nSt++] = l_node.first + 1;
+        }
+      }
+
+      return l_cont;
+    }
+};
+
+#endif
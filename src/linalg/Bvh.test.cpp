@@ -0,0 +1,221 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Unit tests of the bounding volume hierarchy.
+ **/
+#include <catch.hpp>
+#include <cstdlib>
+#include <utility>
+#include <limits>
+#include <vector>
+#include "constants.hpp"
+
+#define private public
+#include "Bvh.hpp"
+#undef private
+#include "Geom.hpp"
+
+/**
+ * Generates a structured tetrahedral mesh of the unit cube, every cube of the grid is split into six tets.
+ *
+ * @param i_nCubes number of cubes per dimension.
+ * @param o_veCrds will be set to the vertex coordinates.
+ * @param o_elVe will be set to the vertices of the tets.
+ **/
+static void bvhTestMesh( unsigned int            i_nCubes,
+                         std::vector< double > & o_veCrds,
+                         std::vector< int >    & o_elVe ) {
+  unsigned int l_nVes = i_nCubes+1;
+  double l_h = 1.0 / i_nCubes;
+
+  o_veCrds.resize( l_nVes*l_nVes*l_nVes*3 );
+  for( unsigned int l_z = 0; l_z < l_nVes; l_z++ )
+    for( unsigned int l_y = 0; l_y < l_nVes; l_y++ )
+      for( unsigned int l_x = 0; l_x < l_nVes; l_x++ ) {
+        unsigned int l_ve = (l_z*l_nVes + l_y)*l_nVes + l_x;
+        o_veCrds[l_ve*3+0] = l_x*l_h;
+        o_veCrds[l_ve*3+1] = l_y*l_h;
+        o_veCrds[l_ve*3+2] = l_z*l_h;
+      }
+
+  // Kuhn-triangulation: paths from corner 0 to corner 7 along the permuted axes
+  unsigned short const l_perms[6][3] = { {0,1,2}, {0,2,1}, {1,0,2}, {1,2,0}, {2,0,1}, {2,1,0} };
+
+  o_elVe.clear();
+  for( unsigned int l_z = 0; l_z < i_nCubes; l_z++ )
+    for( unsigned int l_y = 0; l_y < i_nCubes; l_y++ )
+      for( unsigned int l_x = 0; l_x < i_nCubes; l_x++ )
+        for( unsigned short l_pe = 0; l_pe < 6; l_pe++ ) {
+          unsigned int l_crd[3] = { l_x, l_y, l_z };
+          int l_ves[4];
+          for( unsigned short l_ve = 0; l_ve < 4; l_ve++ ) {
+            if( l_ve > 0 ) l_crd[ l_perms[l_pe][l_ve-1] ]++;
+            l_ves[l_ve] = (l_crd[2]*l_nVes + l_crd[1])*l_nVes + l_crd[0];
+          }
+
+          // odd permutations of the axes invert the orientation
+          if( l_pe == 1 || l_pe == 2 || l_pe == 5 ) std::swap( l_ves[2], l_ves[3] );
+          o_elVe.insert( o_elVe.end(), l_ves, l_ves+4 );
+        }
+}
+
+TEST_CASE( "Bounding volume hierarchy: nearest and containing entities of tets.", "[bvh][linalg]" ) {
+  std::vector< double > l_veCrds;
+  std::vector< int > l_elVe;
+  bvhTestMesh( 6, l_veCrds, l_elVe );
+  std::size_t l_nEls = l_elVe.size() / 4;
+  REQUIRE( l_nEls == 6*6*6*6 );
+
+  // vertex coordinates of a tet, [*][]: dimension, [][*]: vertex
+  auto l_tetVes = [&]( std::size_t i_el, double o_ves[3*4] ) {
+    for( unsigned short l_ve = 0; l_ve < 4; l_ve++ )
+      for( unsigned short l_di = 0; l_di < 3; l_di++ )
+        o_ves[l_di*4 + l_ve] = l_veCrds[ l_elVe[i_el*4 + l_ve]*3 + l_di ];
+  };
+
+  edge::linalg::Bvh< double > l_bvh;
+  l_bvh.build( 3,
+               l_nEls,
+               [&]( std::size_t i_el, double o_bb[2][3] ) {
+                 double l_ves[3*4];
+                 l_tetVes( i_el, l_ves );
+                 for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+                   o_bb[0][l_di] = std::min( std::min( l_ves[l_di*4+0], l_ves[l_di*4+1] ), std::min( l_ves[l_di*4+2], l_ves[l_di*4+3] ) );
+                   o_bb[1][l_di] = std::max( std::max( l_ves[l_di*4+0], l_ves[l_di*4+1] ), std::max( l_ves[l_di*4+2], l_ves[l_di*4+3] ) );
+                 }
+               } );
+
+  // every entity is in exactly one leaf
+  std::vector< unsigned short > l_found( l_nEls, 0 );
+  std::size_t l_nLeafs = 0;
+  std::size_t l_maxLeaf = edge::linalg::Bvh< double >::N_LEAF;
+  for( std::size_t l_no = 0; l_no < l_bvh.m_nodes.size(); l_no++ ) {
+    if( l_bvh.m_nodes[l_no].size > 0 ) {
+      l_nLeafs++;
+      REQUIRE( l_bvh.m_nodes[l_no].size <= l_maxLeaf );
+      for( std::size_t l_id = 0; l_id < l_bvh.m_nodes[l_no].size; l_id++ ) {
+        l_found[ l_bvh.m_ids[ l_bvh.m_nodes[l_no].first + l_id ] ]++;
+      }
+    }
+    else {
+      // children are within the parent's box
+      for( unsigned short l_ch = 0; l_ch < 2; l_ch++ ) {
+        for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+          REQUIRE( l_bvh.m_nodes[ l_bvh.m_nodes[l_no].first + l_ch ].bb[0][l_di] >= l_bvh.m_nodes[l_no].bb[0][l_di] );
+          REQUIRE( l_bvh.m_nodes[ l_bvh.m_nodes[l_no].first + l_ch ].bb[1][l_di] <= l_bvh.m_nodes[l_no].bb[1][l_di] );
+        }
+      }
+    }
+  }
+  REQUIRE( l_nLeafs > 1 );
+  for( std::size_t l_el = 0; l_el < l_nEls; l_el++ ) REQUIRE( l_found[l_el] == 1 );
+  REQUIRE( l_bvh.m_nodes[0].bb[0][0] == Approx( 0.0 ) );
+  REQUIRE( l_bvh.m_nodes[0].bb[1][2] == Approx( 1.0 ) );
+
+  // compare to brute force for points inside and outside of the mesh
+  std::srand( 1234 );
+  for( unsigned int l_pt = 0; l_pt < 200; l_pt++ ) {
+    double l_crds[3];
+    for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+      l_crds[l_di] = -0.5 + 2.0 * std::rand() / RAND_MAX;
+    }
+
+    auto l_distFun = [&]( std::size_t i_el ) {
+      double l_ves[3*4];
+      l_tetVes( i_el, l_ves );
+      double l_tmp[3] = { l_crds[0], l_crds[1], l_crds[2] };
+      edge::linalg::Geom::closestPoint( TET4, l_ves, l_tmp );
+      return edge::linalg::GeomT< 3 >::norm( l_tmp, l_crds );
+    };
+    auto l_insideFun = [&]( std::size_t i_el ) {
+      double l_ves[3*4];
+      l_tetVes( i_el, l_ves );
+      return edge::linalg::Geom::inside( TET4, l_ves, l_crds ) != 0;
+    };
+
+    std::size_t l_refNear = std::numeric_limits< std::size_t >::max();
+    std::size_t l_refCont = std::numeric_limits< std::size_t >::max();
+    double l_refDist = std::numeric_limits< double >::max();
+    for( std::size_t l_el = 0; l_el < l_nEls; l_el++ ) {
+      double l_dist = l_distFun( l_el );
+      if( l_dist < l_refDist ) {
+        l_refDist = l_dist;
+        l_refNear = l_el;
+      }
+      if( l_refCont == std::numeric_limits< std::size_t >::max() && l_insideFun( l_el ) ) l_refCont = l_el;
+    }
+
+    double l_dist;
+    std::size_t l_near = l_bvh.nearest( l_crds, l_distFun, l_dist );
+    REQUIRE( l_dist == Approx( l_refDist ) );
+    REQUIRE( l_near == l_refNear );
+
+    std::size_t l_cont = l_bvh.containing( l_crds, l_insideFun, 1E-10 );
+    REQUIRE( l_cont == l_refCont );
+
+    // points inside the unit cube are always contained
+    if(    l_crds[0] > 0 && l_crds[0] < 1
+        && l_crds[1] > 0 && l_crds[1] < 1
+        && l_crds[2] > 0 && l_crds[2] < 1 ) {
+      REQUIRE( l_cont != std::numeric_limits< std::size_t >::max() );
+      REQUIRE( l_dist == Approx( 0.0 ) );
+    }
+  }
+}
+
+TEST_CASE( "Bounding volume hierarchy: empty and tiny hierarchies.", "[bvh][linalg]" ) {
+  edge::linalg::Bvh< float > l_bvh;
+  float l_pt[3] = { 0, 0, 0 };
+  float l_dist;
+
+  // empty
+  l_bvh.build( 2, 0, []( std::size_t, float[2][3] ) {} );
+  REQUIRE( l_bvh.nNodes() == 0 );
+  REQUIRE( l_bvh.nearest( l_pt, []( std::size_t ) { return 0.0f; }, l_dist ) == std::numeric_limits< std::size_t >::max() );
+  REQUIRE( l_bvh.containing( l_pt, []( std::size_t ) { return true; } ) == std::numeric_limits< std::size_t >::max() );
+
+  // points on a line in 2D, boxes degenerate to the points
+  std::vector< float > l_xs = { 5, 3, 9, 1, 7, 3, 2 };
+  l_bvh.build( 2,
+               l_xs.size(),
+               [&]( std::size_t i_en, float o_bb[2][3] ) {
+                 o_bb[0][0] = o_bb[1][0] = l_xs[i_en];
+                 o_bb[0][1] = o_bb[1][1] = 0;
+                 // the third dimension is ignored in 2D
+                 o_bb[0][2] = o_bb[1][2] = 100;
+               } );
+  REQUIRE( l_bvh.nNodes() == 3 );
+
+  auto l_distFun = [&]( std::size_t i_en ) { return std::abs( l_xs[i_en] - l_pt[0] ); };
+
+  l_pt[0] = 6.9f;
+  REQUIRE( l_bvh.nearest( l_pt, l_distFun, l_dist ) == 4 );
+  REQUIRE( l_dist == Approx( 0.1 ) );
+
+  // tie: smallest id
+  l_pt[0] = 3;
+  REQUIRE( l_bvh.nearest( l_pt, l_distFun, l_dist ) == 1 );
+  REQUIRE( l_dist == 0 );
+  REQUIRE( l_bvh.containing( l_pt, [&]( std::size_t i_en ) { return l_xs[i_en] == 3; } ) == 1 );
+
+  l_pt[0] = -10;
+  REQUIRE( l_bvh.nearest( l_pt, l_distFun, l_dist ) == 3 );
+  REQUIRE( l_bvh.containing( l_pt, []( std::size_t ) { return true; } ) == std::numeric_limits< std::size_t >::max() );
+}
@@ -0,0 +1,123 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Portable SIMD abstraction.
+ **/
+#ifndef EDGE_LINALG_SIMD_HPP
+#define EDGE_LINALG_SIMD_HPP
+
+#include <cstring>
+
+//! width of the vector registers in bytes
+#if defined(__AVX512F__)
+#define EDGE_SIMD_N_BYTES 64
+#elif defined(__AVX__)
+#define EDGE_SIMD_N_BYTES 32
+#else
+#define EDGE_SIMD_N_BYTES 16
+#endif
+
+namespace edge {
+  namespace linalg {
+    template< typename       TL_T_REAL,
+              unsigned short TL_N_LANES >
+    class Simd;
+  }
+}
+
+/**
+ * Portable SIMD abstraction.
+ * Uses the generic vector extensions of GNU-compatible compilers (GCC, Clang, Intel) and falls back to plain arrays otherwise.
+ * Vectors with more lanes than supported by the hardware are split into multiple registers by the compiler.
+ *
+ * @paramt TL_T_REAL floating point precision.
+ * @paramt TL_N_LANES number of lanes, needs to be a power of two.
+ **/
+template< typename       TL_T_REAL,
+          unsigned short TL_N_LANES >
+class edge::linalg::Simd {
+  static_assert( TL_N_LANES > 0 && (TL_N_LANES & (TL_N_LANES-1)) == 0, "number of lanes has to be a power of two" );
+
+  public:
+#if defined(__GNUC__)
+    //! vector type
+    typedef TL_T_REAL t_vec __attribute__(( vector_size( sizeof(TL_T_REAL) * TL_N_LANES ) ));
+#else
+    //! vector type
+    typedef struct { TL_T_REAL m_la[TL_N_LANES]; } t_vec;
+#endif
+
+    /**
+     * Loads a vector from unaligned memory.
+     * Vectors are passed by reference to avoid ABI-dependencies for widths which exceed the hardware's vector registers.
+     *
+     * @param i_ptr memory location.
+     * @param o_vec will be set to the vector.
+     **/
+    static void load( TL_T_REAL const * i_ptr,
+                      t_vec           & o_vec ) {
+      std::memcpy( &o_vec, i_ptr, sizeof(t_vec) );
+    }
+
+    /**
+     * Stores a vector to unaligned memory.
+     *
+     * @param i_vec vector.
+     * @param o_ptr memory location.
+     **/
+    static void store( t_vec     const & i_vec,
+                       TL_T_REAL       * o_ptr ) {
+      std::memcpy( o_ptr, &i_vec, sizeof(t_vec) );
+    }
+
+    /**
+     * Multiplies all lanes of the vector with a scalar.
+     *
+     * @param i_sca scalar.
+     * @param io_vec vector which is scaled.
+     **/
+    static void scale( TL_T_REAL   i_sca,
+                       t_vec     & io_vec ) {
+#if defined(__GNUC__)
+      io_vec *= i_sca;
+#else
+      for( unsigned short l_la = 0; l_la < TL_N_LANES; l_la++ ) io_vec.m_la[l_la] *= i_sca;
+#endif
+    }
+
+    /**
+     * Performs a multiply-add: io_acc += i_sca * i_vec.
+     *
+     * @param i_sca scalar, which is broadcasted to all lanes.
+     * @param i_vec vector.
+     * @param io_acc accumulator.
+     **/
+    static void madd( TL_T_REAL         i_sca,
+                      t_vec     const & i_vec,
+                      t_vec           & io_acc ) {
+#if defined(__GNUC__)
+      io_acc += i_sca * i_vec;
+#else
+      for( unsigned short l_la = 0; l_la < TL_N_LANES; l_la++ ) io_acc.m_la[l_la] += i_sca * i_vec.m_la[l_la];
+#endif
+    }
+};
+
+#endif
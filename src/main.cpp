@@ -37,8 +37,11 @@
 INITIALIZE_EASYLOGGINGPP
 #endif
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <string>
+#include <vector>
 #include "io/OptionParser.h"
 #include "io/Config.h"
 #include "dg/Basis.h"
@@ -46,6 +49,7 @@ INITIALIZE_EASYLOGGINGPP
 #include "setups/Cpu.h"
 #include "io/Receivers.h"
 #include "io/WaveField.h"
+#include "io/Checkpoint.h"
 #include "data/Dynamic.h"
 #include "data/DataLayout.hpp"
 #include "data/SparseEntities.hpp"
@@ -56,6 +60,7 @@ INITIALIZE_EASYLOGGINGPP
 #include "mesh/EdgeV.h"
 
 #include "monitor/Timer.hpp"
+#include "monitor/Profiler.h"
 #include "monitor/instrument.hpp"
 
 // include dependencies of the setups
@@ -145,6 +150,12 @@ int main( int i_argc, char *i_argv[] ) {
   EDGE_LOG_INFO << "parsing xml config";
   edge::io::Config l_config( l_options.getXmlPath() );
 
+  // switch to task-based scheduling (with chunked work regions) if requested
+  if( l_config.m_sharedSched == "tasks" || l_config.m_sharedSched == "dag" ) {
+    if( l_config.m_sharedChunkSize > 0 ) l_shared.enableChunks( l_config.m_sharedChunkSize );
+    else                                 l_shared.enableTasks();
+  }
+
   // parse mesh and mesh supplement
   EDGE_LOG_INFO << "parsing mesh and supplement";
   std::string l_meshPath = l_config.m_meshInBase;
@@ -250,12 +261,33 @@ l_edgeV.setSpTypes( l_internal.m_vertexChars,
                                                           l_internal.m_connect.vIdElFaEl[0] );
   }
 
+  // checkpoints of the solver state, restarts continue at the latest one
+  edge::io::Checkpoint l_ckpt( l_config.m_ckptDir );
+  std::size_t l_ckptId = 0;
+  double l_ckptTime = 0;
+  bool l_restart = l_config.m_ckptRestart && l_ckpt.latest( l_ckptId, l_ckptTime );
+  if( l_restart ) EDGE_LOG_INFO << "restarting from checkpoint #" << l_ckptId << " at time " << l_ckptTime;
+
   // setup receivers
 #include "io/inc/setup_recv.inc"
 
   // time step statistics
   double l_dT[3];
 
+  // profiler of the work regions, writing one file per rank
+  std::string l_profPath = l_config.m_profFile;
+  if( l_profPath != "" ) {
+    std::size_t l_ext = l_profPath.find_last_of( '.' );
+    if( l_ext == std::string::npos ) l_ext = l_profPath.size();
+    l_profPath.insert( l_ext, "_" + edge::parallel::g_rankStr );
+  }
+
+  edge::monitor::Profiler l_prof;
+  l_prof.init( edge::parallel::g_nThreads,
+               l_edgeV.nTgs(),
+               N_ENTRIES_CONTROL_FLOW,
+               l_profPath );
+
   EDGE_LOG_INFO << "performing equation-specific setup";
   PP_INSTR_REG_DEF(equSpe)
   PP_INSTR_REG_BEG(equSpe,"eq_spec_setup")
@@ -268,6 +300,23 @@ l_edgeV.setSpTypes( l_internal.m_vertexChars,
 #endif
   PP_INSTR_REG_END(equSpe)
 
+  // register the element-local state for checkpoints
+#ifdef PP_N_ELEMENT_MODE_PRIVATE_1
+  l_ckpt.add( "element_mode_private_1",
+              l_internal.m_elementModePrivate1,
+              std::size_t(l_edgeV.nEls()) * sizeof(l_internal.m_elementModePrivate1[0]) );
+#endif
+#ifdef PP_N_ELEMENT_MODE_PRIVATE_2
+  l_ckpt.add( "element_mode_private_2",
+              l_internal.m_elementModePrivate2,
+              std::size_t(l_edgeV.nEls()) * sizeof(l_internal.m_elementModePrivate2[0]) );
+#endif
+#ifdef PP_N_ELEMENT_MODE_PRIVATE_3
+  l_ckpt.add( "element_mode_private_3",
+              l_internal.m_elementModePrivate3,
+              std::size_t(l_edgeV.nEls()) * sizeof(l_internal.m_elementModePrivate3[0]) );
+#endif
+
   // determine global time step stats
   double l_dtG[3];
 #ifdef PP_USE_MPI
@@ -286,6 +335,7 @@ l_edgeV.setSpTypes( l_internal.m_vertexChars,
 
   for( unsigned short l_tg = 0; l_tg < l_edgeV.nTgs(); l_tg++ ) {
     l_tgs.push_back( edge::time::TimeGroupStatic( l_edgeV.nTgs(),
+                                                  l_edgeV.getRates(),
                                                   l_tg,
                                                   l_internal,
                                                   l_distributed.nCommBuffers(),
@@ -307,6 +357,12 @@ l_edgeV.setSpTypes( l_internal.m_vertexChars,
                               l_tgs,
                               l_receivers );
 
+  // drive the control flow by a dependency graph if requested
+  if( l_config.m_sharedSched == "dag" ) l_time.enableDag();
+
+  // profile the work regions if requested
+  if( l_config.m_profFile != "" ) l_time.enableProfiling( l_prof );
+
   // set up simulation times and synchronization intervals
   double l_simTime = 0;
   double l_endTime = l_config.m_endTime;
@@ -315,6 +371,20 @@ l_edgeV.setSpTypes( l_internal.m_vertexChars,
 
   if( std::abs(l_syncInt) < TOL.TIME ) l_syncInt = l_endTime;
 
+  // iteration counters of the sync points, wave field output and checkpoints
+  unsigned int l_step    = 0;
+  unsigned int l_stepWf  = 0;
+  unsigned int l_stepCp  = 0;
+
+  // register the counters of the simulation for checkpoints
+  std::vector< std::size_t > l_tgsTs(  l_tgs.size() );
+  std::vector< double >      l_tgsCov( l_tgs.size() );
+  l_ckpt.add( "step",    &l_step,   sizeof(l_step) );
+  l_ckpt.add( "step_wf", &l_stepWf, sizeof(l_stepWf) );
+  l_ckpt.add( "step_cp", &l_stepCp, sizeof(l_stepCp) );
+  l_ckpt.add( "tgs_ts",  l_tgsTs.data(),  l_tgsTs.size()  * sizeof(std::size_t) );
+  l_ckpt.add( "tgs_cov", l_tgsCov.data(), l_tgsCov.size() * sizeof(double) );
+
   // create a wave field writer
   edge::io::WaveField l_writer( l_config.m_waveFieldType,
                                 l_config.m_waveFieldFile,
@@ -324,12 +394,32 @@ l_edgeV.setSpTypes( l_internal.m_vertexChars,
                                 l_internal.m_elementChars,
                                 l_internal.m_connect.elVe,
                                 l_internal.m_elementModePrivate1,
-                                l_config.m_waveFieldSpType );
+                                l_config.m_waveFieldSpType,
+                                l_config.m_waveFieldAsync,
+                                l_config.m_waveFieldAllModes,
+                                l_config.m_waveFieldComp );
+
+  // restore the state of the checkpoint
+  if( l_restart ) {
+    EDGE_LOG_INFO << "reading checkpoint #" << l_ckptId;
+    l_ckpt.read( l_ckptId );
+
+    l_simTime = l_ckptTime;
+    for( std::size_t l_tg = 0; l_tg < l_tgs.size(); l_tg++ ) {
+      l_tgs[l_tg].restore( l_tgsTs[l_tg], l_tgsCov[l_tg] );
+    }
+    l_writer.setWriteStep( l_stepWf+1 );
+
+    l_syncInt = (l_stepWf +1)*l_config.m_waveFieldInt - l_simTime;
+    l_syncInt = std::min( l_syncInt, l_config.m_syncMaxInt );
+    l_syncInt = std::min( l_syncInt, l_endTime-l_simTime );
+    if( l_syncInt < TOL.TIME ) l_syncInt = l_endTime;
+  }
 
   // write setup
-  EDGE_LOG_INFO << "reached synchronization point #0";
+  EDGE_LOG_INFO << "reached synchronization point #" << l_step;
   EDGE_LOG_INFO << "  simulation time: " << l_simTime;
-  if( l_config.m_waveFieldInt < l_config.m_endTime ) {
+  if( !l_restart && l_config.m_waveFieldInt < l_config.m_endTime ) {
     EDGE_LOG_INFO << "  writing wave field #0";
     l_writer.write( 0 );
   }
@@ -350,10 +440,9 @@ l_edgeV.setSpTypes( l_internal.m_vertexChars,
 #endif
   PP_INSTR_REG_BEG(comp,"comp")
   l_timer.start();
+  l_prof.reset();
 
   // iterate over sync points
-  unsigned int l_step    = 0;
-  unsigned int l_stepWf  = 0;
   while( l_endTime - l_simTime > TOL.TIME ) {
     // derive time to advance in this step
     double l_stepTime = std::max( 0.0, l_endTime - l_simTime );
@@ -374,6 +463,9 @@ l_edgeV.setSpTypes( l_internal.m_vertexChars,
     // update simulation time
     l_simTime += l_stepTime;
 
+    // summarize the profile of this interval
+    if( l_config.m_profFile != "" ) l_prof.dump( l_step+1, l_simTime );
+
     EDGE_LOG_INFO << "reached synchronization point #" << l_step+1;
     EDGE_LOG_INFO << "  simulation time: " << l_simTime;
     l_timer.end();
@@ -383,7 +475,7 @@ l_edgeV.setSpTypes( l_internal.m_vertexChars,
     // write this sync step
     if( l_simTime + TOL.TIME > (l_stepWf+1)*l_config.m_waveFieldInt ) {
       EDGE_LOG_INFO << "  writing wave field #" << l_stepWf+1;
-      l_writer.write( l_stepTime );
+      l_writer.write( l_simTime );
       l_stepWf++;
     }
 
@@ -395,14 +487,39 @@ l_edgeV.setSpTypes( l_internal.m_vertexChars,
     l_syncInt = std::min( l_syncInt, l_endTime-l_simTime );
 
     if( l_syncInt < TOL.TIME ) l_syncInt = l_endTime;
+
+    // checkpoint the state, only the copy to the staging buffer is on the critical path
+    if(    l_config.m_ckptDir != ""
+        && l_simTime + TOL.TIME > (l_stepCp+1)*l_config.m_ckptInt
+        && l_endTime - l_simTime > TOL.TIME ) {
+      l_stepCp = (l_simTime + TOL.TIME) / l_config.m_ckptInt;
+      EDGE_LOG_INFO << "  writing checkpoint #" << l_stepCp;
+
+      // samples up to the checkpoint are on disk before the checkpoint is committed, a restart appends to them
+      l_receivers.sync();
+
+      for( std::size_t l_tg = 0; l_tg < l_tgs.size(); l_tg++ ) {
+        l_tgsTs[l_tg]  = l_tgs[l_tg].getUpdatesPer();
+        l_tgsCov[l_tg] = l_tgs[l_tg].getCovSimTime();
+      }
+      l_ckpt.write( l_stepCp, l_simTime );
+    }
   }
 
+  // finish pending wave field output and checkpoints
+  l_writer.wait();
+  l_ckpt.wait();
+
   // print time info for compute
   l_timer.end();
   PP_INSTR_REG_END(comp)
   EDGE_LOG_INFO << "that's the duration of the computations ("
                 << l_tgs[0].getUpdatesPer() << " fundamental time steps): "
                 << l_timer.elapsed() << " seconds";
+  if( l_config.m_profFile != "" ) {
+    l_prof.print();
+    l_prof.fin();
+  }
   l_timer.reset();
   PP_INSTR_REG_DEF(fin)
   PP_INSTR_REG_BEG(fin,"fin")
@@ -26,6 +26,7 @@
 
 #include "EdgeV.h"
 #include "../data/EntityLayout.h"
+#include <cmath>
 
 
 void edge::mesh::EdgeV::setElLayout( unsigned short         i_nTgs,
@@ -181,11 +182,19 @@ void edge::mesh::EdgeV::setLtsTypes( std::size_t            i_nEls,
 edge::mesh::EdgeV::EdgeV( std::string const & i_pathToMesh,
                           std::string const & i_pathToSupplement,
                           int                 i_periodic ) {
-  m_gmsh = new edge_v::io::Gmsh();
-  m_gmsh->open( i_pathToMesh );
-  m_gmsh->readMesh();
-  m_mesh = new edge_v::mesh::Mesh( *m_gmsh,
-                                   i_periodic );
+  // binary partitions are mapped, Gmsh partitions are parsed and the derived data is computed
+  std::string l_extBin = ".bin";
+  if(    i_pathToMesh.size() > l_extBin.size()
+      && i_pathToMesh.compare( i_pathToMesh.size() - l_extBin.size(), l_extBin.size(), l_extBin ) == 0 ) {
+    m_mesh = new edge_v::mesh::Mesh( i_pathToMesh );
+  }
+  else {
+    m_gmsh = new edge_v::io::Gmsh();
+    m_gmsh->open( i_pathToMesh );
+    m_gmsh->readMesh();
+    m_mesh = new edge_v::mesh::Mesh( *m_gmsh,
+                                     i_periodic );
+  }
   m_hdf = new edge_v::io::Hdf5( i_pathToSupplement );
 
   // check if the mesh is EDGE-V annotated for LTS
@@ -221,19 +230,23 @@ edge::mesh::EdgeV::EdgeV( std::string const & i_pathToMesh,
     m_nElsSe += m_nTgElsSe[l_tg];
   }
 
-  // allocate memory for relative time steps and init with GTS
+  // allocate memory for relative time steps and rates, init with GTS
   m_relDt = new double[m_nTgs+1];
   m_relDt[0] = 1;
   m_relDt[1] = std::numeric_limits< double >::max();
+  m_rates = new unsigned short[m_nTgs];
+  m_rates[m_nTgs-1] = 1;
 
   if( m_nTgs > 1 ) {
-    // get relative time steps and check for rate-2
+    // get relative time steps and derive the integer rates
     m_hdf->get( "/edge_v/relative_time_steps",
                 m_relDt );
 
     for( unsigned short l_tg = 0; l_tg < m_nTgs-1; l_tg++ ) {
       double l_rate = m_relDt[l_tg+1] / m_relDt[l_tg];
-      EDGE_CHECK_LT( std::abs(l_rate-2.0), 1E-5 );
+      m_rates[l_tg] = (unsigned short) std::lround( l_rate );
+      EDGE_CHECK_GE( m_rates[l_tg], 2 );
+      EDGE_CHECK_LT( std::abs(l_rate-m_rates[l_tg]), 1E-5 );
     }
   }
 
@@ -321,6 +334,7 @@ edge::mesh::EdgeV::~EdgeV() {
   if( m_nTgElsIn    != nullptr ) delete[] m_nTgElsIn;
   if( m_nTgElsSe    != nullptr ) delete[] m_nTgElsSe;
   if( m_relDt       != nullptr ) delete[] m_relDt;
+  if( m_rates       != nullptr ) delete[] m_rates;
   if( m_commStruct  != nullptr ) delete[] m_commStruct;
   if( m_sendFa      != nullptr ) delete[] m_sendFa;
   if( m_sendEl      != nullptr ) delete[] m_sendEl;
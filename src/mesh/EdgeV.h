@@ -50,6 +50,9 @@ class edge::mesh::EdgeV {
     //! relative time steps, first is fundamental
     double *m_relDt = nullptr;
 
+    //! integer LTS rates of the time groups w.r.t. the next larger ones, 1 for the largest group
+    unsigned short *m_rates = nullptr;
+
     //! number of time groups
     unsigned short m_nTgs = 1;
 
@@ -144,6 +147,8 @@ class edge::mesh::EdgeV {
                              long long            * o_spTys );
     /**
      * Constructor.
+     * Meshes with the extension .bin are binary partitions of EDGE-V, which are memory-mapped.
+     * Their periodic boundaries were inserted by EDGE-V, i_periodic is ignored.
      *
      * @param i_pathToMesh path to the mesh file.
      * @param i_pathToSupplement path to the mesh supplement file.
@@ -165,6 +170,14 @@ class edge::mesh::EdgeV {
      **/
     double const * getRelDt() const { return m_relDt; }
 
+    /**
+     * Gets the integer LTS rates, i.e., the ratios of the time groups' time steps to the ones of the next smaller groups.
+     * Entry tg holds the rate of time group tg+1 w.r.t. time group tg, the entry of the largest time group is 1.
+     *
+     * @return rates, one per time group.
+     **/
+    unsigned short const * getRates() const { return m_rates; }
+
     /**
      * Gets the number of time groups.
      *
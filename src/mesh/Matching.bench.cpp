@@ -0,0 +1,197 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Scaling benchmark of the sparse-type tagging and periodic face matching in EDGE-V.
+ **/
+#include "monitor/Bench.hpp"
+#include <edge_v/edge_v.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace edge {
+  namespace mesh {
+    namespace bench {
+      //! synthetic mesh of quads in two rows, periodic in y
+      struct Strip {
+        //! vertex coordinates
+        std::vector< double > veCrds;
+        //! vertices of the faces, sorted lexicographically
+        std::vector< edge_v::t_idx > faVe;
+        //! elements adjacent to the faces
+        std::vector< edge_v::t_idx > faEl;
+        //! boundary types of the faces
+        std::vector< int > faBndTys;
+        //! faces adjacent to the elements
+        std::vector< edge_v::t_idx > elFa;
+        //! elements adjacent to the elements (faces as bridge)
+        std::vector< edge_v::t_idx > elFaEl;
+      };
+
+      /**
+       * Generates a strip of nx*2 quads.
+       * Vertex (ix,iy) has id ix*3+iy, element (ix,iy) has id ix*2+iy.
+       * The local faces of the elements are: 0 bottom, 1 right, 2 top, 3 left.
+       * Bottom and top faces of the strip have the periodic boundary type 5.
+       *
+       * @param i_nx number of quads in x-direction.
+       * @param o_strip will be set to the strip.
+       **/
+      void strip( edge_v::t_idx   i_nx,
+                  Strip         & o_strip );
+
+      /**
+       * Measures the sparse-type tagging and the periodic face matching for strips of 10^6 up to 10^8 faces.
+       * The environment variable EDGE_BENCH_MAX_FACES limits the number of faces (default: 10^7).
+       *
+       * @param io_recs records of the results will be appended.
+       **/
+      void matching( std::vector< monitor::Bench::Record > & io_recs );
+    }
+  }
+}
+
+void edge::mesh::bench::strip( edge_v::t_idx   i_nx,
+                               Strip         & o_strip ) {
+  edge_v::t_idx l_no = std::numeric_limits< edge_v::t_idx >::max();
+  edge_v::t_idx l_nFas = i_nx*5 + 2;
+
+  o_strip.veCrds.assign( (i_nx+1)*3*3, 0 );
+  o_strip.faVe.resize( 0 );
+  o_strip.faVe.reserve( l_nFas*2 );
+  o_strip.faEl.resize( 0 );
+  o_strip.faEl.reserve( l_nFas*2 );
+  o_strip.faBndTys.resize( 0 );
+  o_strip.faBndTys.reserve( l_nFas );
+  o_strip.elFa.assign( i_nx*2*4, l_no );
+  o_strip.elFaEl.assign( i_nx*2*4, l_no );
+
+  for( edge_v::t_idx l_ix = 0; l_ix < i_nx+1; l_ix++ ) {
+    for( edge_v::t_idx l_iy = 0; l_iy < 3; l_iy++ ) {
+      o_strip.veCrds[ (l_ix*3 + l_iy)*3 + 0 ] = l_ix;
+      o_strip.veCrds[ (l_ix*3 + l_iy)*3 + 1 ] = l_iy;
+
+      // vertical face
+      if( l_iy < 2 ) {
+        edge_v::t_idx l_elL = (l_ix > 0)    ? (l_ix-1)*2 + l_iy : l_no;
+        edge_v::t_idx l_elR = (l_ix < i_nx) ?  l_ix   *2 + l_iy : l_no;
+        if( l_elL != l_no ) o_strip.elFa[l_elL*4 + 1] = o_strip.faBndTys.size();
+        if( l_elR != l_no ) o_strip.elFa[l_elR*4 + 3] = o_strip.faBndTys.size();
+        if( l_elL != l_no && l_elR != l_no ) {
+          o_strip.elFaEl[l_elL*4 + 1] = l_elR;
+          o_strip.elFaEl[l_elR*4 + 3] = l_elL;
+        }
+
+        o_strip.faVe.push_back( l_ix*3 + l_iy   );
+        o_strip.faVe.push_back( l_ix*3 + l_iy+1 );
+        o_strip.faEl.push_back( (l_elL != l_no) ? l_elL : l_elR );
+        o_strip.faEl.push_back( (l_elL != l_no) ? l_elR : l_no  );
+        o_strip.faBndTys.push_back( 0 );
+      }
+
+      // horizontal face
+      if( l_ix < i_nx ) {
+        edge_v::t_idx l_elB = (l_iy > 0) ? l_ix*2 + l_iy-1 : l_no;
+        edge_v::t_idx l_elT = (l_iy < 2) ? l_ix*2 + l_iy   : l_no;
+        if( l_elB != l_no ) o_strip.elFa[l_elB*4 + 2] = o_strip.faBndTys.size();
+        if( l_elT != l_no ) o_strip.elFa[l_elT*4 + 0] = o_strip.faBndTys.size();
+        if( l_elB != l_no && l_elT != l_no ) {
+          o_strip.elFaEl[l_elB*4 + 2] = l_elT;
+          o_strip.elFaEl[l_elT*4 + 0] = l_elB;
+        }
+
+        o_strip.faVe.push_back(  l_ix   *3 + l_iy );
+        o_strip.faVe.push_back( (l_ix+1)*3 + l_iy );
+        o_strip.faEl.push_back( (l_elB != l_no) ? l_elB : l_elT );
+        o_strip.faEl.push_back( (l_elB != l_no) ? l_elT : l_no  );
+        o_strip.faBndTys.push_back( (l_iy == 1) ? 0 : 5 );
+      }
+    }
+  }
+}
+
+void edge::mesh::bench::matching( std::vector< monitor::Bench::Record > & io_recs ) {
+  double l_maxFas = 1E7;
+  char const * l_env = std::getenv( "EDGE_BENCH_MAX_FACES" );
+  if( l_env != nullptr ) l_maxFas = std::atof( l_env );
+
+  for( double l_nFasTarget = 1E6; l_nFasTarget <= l_maxFas*1.001; l_nFasTarget *= 10 ) {
+    Strip l_strip;
+    strip( edge_v::t_idx(l_nFasTarget / 5),
+           l_strip );
+    edge_v::t_idx l_nFas = l_strip.faBndTys.size();
+
+    // periodic faces in shuffled order, as obtained for the physical groups of the mesh generator
+    std::vector< edge_v::t_idx > l_bndFas;
+    for( edge_v::t_idx l_fa = 0; l_fa < l_nFas; l_fa++ ) {
+      if( l_strip.faBndTys[l_fa] == 5 ) l_bndFas.push_back( l_fa );
+    }
+    std::mt19937_64 l_gen( 42 );
+    std::shuffle( l_bndFas.begin(), l_bndFas.end(), l_gen );
+
+    std::vector< edge_v::t_idx > l_faVeSp( l_bndFas.size()*2 );
+    for( std::size_t l_bf = 0; l_bf < l_bndFas.size(); l_bf++ ) {
+      l_faVeSp[l_bf*2 + 0] = l_strip.faVe[ l_bndFas[l_bf]*2 + 0 ];
+      l_faVeSp[l_bf*2 + 1] = l_strip.faVe[ l_bndFas[l_bf]*2 + 1 ];
+    }
+
+    // sparse-type tagging
+    std::vector< edge_v::t_sparseType > l_spTypes( l_nFas, 0 );
+    std::chrono::steady_clock::time_point l_start = std::chrono::steady_clock::now();
+    edge_v::mesh::Mesh::addSparseTypeEn( edge_v::LINE,
+                                         l_nFas,
+                                         l_bndFas.size(),
+                                         l_strip.faVe.data(),
+                                         l_faVeSp.data(),
+                                         5,
+                                         l_spTypes.data() );
+    std::chrono::duration< double > l_durTag = std::chrono::steady_clock::now() - l_start;
+
+    // periodic face matching
+    std::vector< edge_v::t_idx > l_pFasGt;
+    l_start = std::chrono::steady_clock::now();
+    edge_v::mesh::Mesh::setPeriodicBnds( edge_v::QUAD4R,
+                                         l_nFas,
+                                         5,
+                                         l_strip.faBndTys.data(),
+                                         l_strip.faVe.data(),
+                                         (double (*)[3]) l_strip.veCrds.data(),
+                                         l_strip.faEl.data(),
+                                         l_strip.elFa.data(),
+                                         l_strip.elFaEl.data(),
+                                         l_pFasGt );
+    std::chrono::duration< double > l_durPer = std::chrono::steady_clock::now() - l_start;
+
+    monitor::Bench::Record l_rec;
+    l_rec.add( "n_faces", (double) l_nFas )
+         .add( "n_periodic_faces", (double) l_bndFas.size() )
+         .add( "tagging_time", l_durTag.count() )
+         .add( "tagging_faces_per_second", l_bndFas.size() / l_durTag.count() )
+         .add( "periodic_time", l_durPer.count() )
+         .add( "periodic_faces_per_second", l_bndFas.size() / l_durPer.count() )
+         .add( "periodic_pairs_gt", (double) l_pFasGt.size() );
+    io_recs.push_back( l_rec );
+  }
+}
+
+EDGE_BENCH( "mesh/matching", edge::mesh::bench::matching )
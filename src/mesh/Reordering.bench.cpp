@@ -0,0 +1,225 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Benchmark of the cache behavior for different element orders.
+ **/
+#include "monitor/Bench.hpp"
+#include <edge_v/edge_v.h>
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <list>
+#include <random>
+#include <vector>
+
+namespace edge {
+  namespace mesh {
+    namespace bench {
+      /**
+       * Counts the misses of a fully associative LRU-cache for the element-wise access pattern of the neighboring updates.
+       * Every element accesses its own data and the data of its face-neighbors.
+       *
+       * @param i_nEls number of elements.
+       * @param i_elFaEl elements adjacent to the elements (faces as bridge).
+       * @param i_nCacheEls capacity of the cache in elements.
+       * @return number of misses.
+       **/
+      std::size_t lruMisses( std::size_t                           i_nEls,
+                             std::vector< std::size_t >    const & i_elFaEl,
+                             std::size_t                           i_nCacheEls );
+
+      /**
+       * Measures the time of a gather kernel, which accumulates the data of the face-neighbors.
+       *
+       * @param i_nEls number of elements.
+       * @param i_elFaEl elements adjacent to the elements (faces as bridge).
+       * @param i_nReps number of repetitions.
+       * @return minimum time of a repetition.
+       **/
+      double gather( std::size_t                        i_nEls,
+                     std::vector< std::size_t > const & i_elFaEl,
+                     unsigned int                       i_nReps );
+
+      /**
+       * Compares a shuffled element order to the Morton and reverse Cuthill-McKee orders of a structured hexahedral mesh.
+       *
+       * @param io_recs records of the results will be appended.
+       **/
+      void orders( std::vector< monitor::Bench::Record > & io_recs );
+    }
+  }
+}
+
+std::size_t edge::mesh::bench::lruMisses( std::size_t                        i_nEls,
+                                          std::vector< std::size_t > const & i_elFaEl,
+                                          std::size_t                        i_nCacheEls ) {
+  std::list< std::size_t > l_lru;
+  std::vector< std::list< std::size_t >::iterator > l_pos( i_nEls, l_lru.end() );
+  std::size_t l_misses = 0;
+
+  for( std::size_t l_el = 0; l_el < i_nEls; l_el++ ) {
+    for( unsigned short l_ac = 0; l_ac < 7; l_ac++ ) {
+      std::size_t l_en = (l_ac == 0) ? l_el : i_elFaEl[l_el*6 + l_ac-1];
+      if( l_en == std::numeric_limits< std::size_t >::max() ) continue;
+
+      if( l_pos[l_en] != l_lru.end() ) {
+        l_lru.splice( l_lru.begin(), l_lru, l_pos[l_en] );
+      }
+      else {
+        l_misses++;
+        if( l_lru.size() == i_nCacheEls ) {
+          l_pos[ l_lru.back() ] = l_lru.end();
+          l_lru.pop_back();
+        }
+        l_lru.push_front( l_en );
+      }
+      l_pos[l_en] = l_lru.begin();
+    }
+  }
+
+  return l_misses;
+}
+
+double edge::mesh::bench::gather( std::size_t                        i_nEls,
+                                  std::vector< std::size_t > const & i_elFaEl,
+                                  unsigned int                       i_nReps ) {
+  // size of the time-integrated DOFs for fifth order and elastics
+  std::size_t l_nVals = 9 * 35;
+  std::vector< double > l_in( i_nEls * l_nVals, 1.0 );
+  std::vector< double > l_out( i_nEls * l_nVals, 0.0 );
+
+  double l_min = std::numeric_limits< double >::max();
+  for( unsigned int l_re = 0; l_re < i_nReps; l_re++ ) {
+    std::chrono::steady_clock::time_point l_start = std::chrono::steady_clock::now();
+
+    for( std::size_t l_el = 0; l_el < i_nEls; l_el++ ) {
+      double *l_outEl = l_out.data() + l_el * l_nVals;
+      for( unsigned short l_fa = 0; l_fa < 6; l_fa++ ) {
+        std::size_t l_ne = i_elFaEl[l_el*6 + l_fa];
+        if( l_ne == std::numeric_limits< std::size_t >::max() ) l_ne = l_el;
+
+        double const *l_inNe = l_in.data() + l_ne * l_nVals;
+        for( std::size_t l_va = 0; l_va < l_nVals; l_va++ ) l_outEl[l_va] += l_inNe[l_va];
+      }
+    }
+
+    std::chrono::duration< double > l_dur = std::chrono::steady_clock::now() - l_start;
+    l_min = std::min( l_min, l_dur.count() );
+  }
+
+  // prevent the compiler from removing the work
+  if( l_out[0] < 0 ) l_min = -l_min;
+
+  return l_min;
+}
+
+void edge::mesh::bench::orders( std::vector< monitor::Bench::Record > & io_recs ) {
+  std::size_t l_n = 40;
+  std::size_t l_nEls = l_n * l_n * l_n;
+  std::size_t l_no = std::numeric_limits< std::size_t >::max();
+
+  // shuffled numbering of the structured mesh, as obtained, e.g., from an unstructured mesh generator
+  std::vector< std::size_t > l_perm( l_nEls );
+  for( std::size_t l_el = 0; l_el < l_nEls; l_el++ ) l_perm[l_el] = l_el;
+  std::mt19937_64 l_gen( 42 );
+  std::shuffle( l_perm.begin(), l_perm.end(), l_gen );
+
+  std::vector< std::size_t > l_elFaEl( l_nEls*6, l_no );
+  std::vector< double > l_crds( l_nEls*3 );
+  for( std::size_t l_z = 0; l_z < l_n; l_z++ ) {
+    for( std::size_t l_y = 0; l_y < l_n; l_y++ ) {
+      for( std::size_t l_x = 0; l_x < l_n; l_x++ ) {
+        std::size_t l_el = l_perm[ (l_z * l_n + l_y) * l_n + l_x ];
+        std::size_t l_ijk[3] = { l_x, l_y, l_z };
+
+        for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+          l_crds[l_el*3 + l_di] = l_ijk[l_di] + 0.5;
+
+          for( unsigned short l_si = 0; l_si < 2; l_si++ ) {
+            if( (l_si == 0 && l_ijk[l_di] == 0) || (l_si == 1 && l_ijk[l_di] == l_n-1) ) continue;
+
+            std::size_t l_ne[3] = { l_x, l_y, l_z };
+            l_ne[l_di] = (l_si == 0) ? l_ne[l_di]-1 : l_ne[l_di]+1;
+            l_elFaEl[l_el*6 + l_di*2 + l_si] = l_perm[ (l_ne[2] * l_n + l_ne[1]) * l_n + l_ne[0] ];
+          }
+        }
+      }
+    }
+  }
+
+  std::string l_orders[3] = { "shuffled", "morton", "rcm" };
+  std::vector< edge_v::t_idx > l_keys( l_nEls );
+
+  for( unsigned short l_or = 0; l_or < 3; l_or++ ) {
+    if( l_orders[l_or] == "shuffled" ) {
+      for( std::size_t l_el = 0; l_el < l_nEls; l_el++ ) l_keys[l_el] = l_el;
+    }
+    else if( l_orders[l_or] == "morton" ) {
+      edge_v::mesh::Reordering::morton( l_nEls,
+                                        (double (*)[3]) l_crds.data(),
+                                        l_keys.data() );
+    }
+    else {
+      std::vector< edge_v::t_idx > l_elFaElV( l_elFaEl.begin(), l_elFaEl.end() );
+      for( std::size_t l_id = 0; l_id < l_elFaElV.size(); l_id++ ) {
+        if( l_elFaEl[l_id] == l_no ) l_elFaElV[l_id] = std::numeric_limits< edge_v::t_idx >::max();
+      }
+      edge_v::mesh::Reordering::rcm( 6,
+                                     l_nEls,
+                                     l_elFaElV.data(),
+                                     nullptr,
+                                     l_keys.data() );
+    }
+
+    // derive the new numbering and renumber the adjacency information
+    std::vector< std::size_t > l_old( l_nEls );
+    for( std::size_t l_el = 0; l_el < l_nEls; l_el++ ) l_old[l_el] = l_el;
+    std::sort( l_old.begin(), l_old.end(),
+               [&]( std::size_t i_el0, std::size_t i_el1 ) {
+                 return l_keys[i_el0] < l_keys[i_el1] || ( l_keys[i_el0] == l_keys[i_el1] && i_el0 < i_el1 );
+               } );
+    std::vector< std::size_t > l_new( l_nEls );
+    for( std::size_t l_el = 0; l_el < l_nEls; l_el++ ) l_new[ l_old[l_el] ] = l_el;
+
+    std::vector< std::size_t > l_elFaElRe( l_nEls*6 );
+    for( std::size_t l_el = 0; l_el < l_nEls; l_el++ ) {
+      for( unsigned short l_fa = 0; l_fa < 6; l_fa++ ) {
+        std::size_t l_ne = l_elFaEl[ l_old[l_el]*6 + l_fa ];
+        l_elFaElRe[l_el*6 + l_fa] = (l_ne != l_no) ? l_new[l_ne] : l_no;
+      }
+    }
+
+    // cache of 1024 elements: roughly 2.5MiB for the time-integrated DOFs of the gather kernel
+    std::size_t l_nCacheEls = 1024;
+    std::size_t l_misses = lruMisses( l_nEls, l_elFaElRe, l_nCacheEls );
+    double l_time = gather( l_nEls, l_elFaElRe, 5 );
+
+    monitor::Bench::Record l_rec;
+    l_rec.add( "order", l_orders[l_or] )
+         .add( "n_elements", (double) l_nEls )
+         .add( "cache_elements", (double) l_nCacheEls )
+         .add( "misses", (double) l_misses )
+         .add( "misses_per_element", l_misses / (double) l_nEls )
+         .add( "gather_time", l_time );
+    io_recs.push_back( l_rec );
+  }
+}
+
+EDGE_BENCH( "mesh/reordering", edge::mesh::bench::orders )
@@ -0,0 +1,212 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Registry and JSON-reporting of benchmarks.
+ **/
+#ifndef EDGE_MONITOR_BENCH_HPP
+#define EDGE_MONITOR_BENCH_HPP
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace edge {
+  namespace monitor {
+    class Bench;
+  }
+}
+
+/**
+ * Registers a benchmark at static initialization time.
+ *
+ * @param i_name name of the benchmark, e.g., "parallel/shared/makespan".
+ * @param i_fun benchmark function, taking a reference to a vector of records as argument.
+ **/
+#define EDGE_BENCH( i_name, i_fun ) \
+  static bool const EDGE_BENCH_ID( g_bench_, __LINE__ ) = edge::monitor::Bench::add( i_name, i_fun );
+#define EDGE_BENCH_ID( i_prefix, i_line ) EDGE_BENCH_CAT( i_prefix, i_line )
+#define EDGE_BENCH_CAT( i_prefix, i_line ) i_prefix##i_line
+
+/**
+ * Registry of the benchmarks.
+ * Every benchmark appends a record of named values per measured configuration.
+ * The results of all executed benchmarks are written as a single JSON-document.
+ **/
+class edge::monitor::Bench {
+  public:
+    //! record of a benchmark, holding named values of a single configuration
+    class Record {
+      private:
+        //! names and JSON-formatted values
+        std::vector< std::pair< std::string, std::string > > m_vals;
+
+      public:
+        /**
+         * Adds a string.
+         *
+         * @param i_key name of the value.
+         * @param i_val value.
+         * @return this record.
+         **/
+        Record & add( std::string const & i_key,
+                      std::string const & i_val ) {
+          m_vals.push_back( std::make_pair( i_key, "\"" + i_val + "\"" ) );
+          return *this;
+        }
+
+        /**
+         * Adds a number.
+         *
+         * @param i_key name of the value.
+         * @param i_val value.
+         * @return this record.
+         **/
+        Record & add( std::string const & i_key,
+                      double              i_val ) {
+          std::ostringstream l_str;
+          l_str.precision( 10 );
+          l_str << i_val;
+          m_vals.push_back( std::make_pair( i_key, l_str.str() ) );
+          return *this;
+        }
+
+        /**
+         * Gets the record as JSON-object.
+         *
+         * @return JSON-object.
+         **/
+        std::string json() const {
+          std::string l_str = "{";
+          for( std::size_t l_va = 0; l_va < m_vals.size(); l_va++ ) {
+            if( l_va > 0 ) l_str += ", ";
+            l_str += "\"" + m_vals[l_va].first + "\": " + m_vals[l_va].second;
+          }
+          return l_str + "}";
+        }
+    };
+
+    //! benchmark function
+    typedef void (*t_fun)( std::vector< Record > & io_recs );
+
+  private:
+    /**
+     * Gets the registered benchmarks.
+     *
+     * @return names and functions of the benchmarks.
+     **/
+    static std::vector< std::pair< std::string, t_fun > > & benchs() {
+      static std::vector< std::pair< std::string, t_fun > > l_benchs;
+      return l_benchs;
+    }
+
+  public:
+    /**
+     * Registers a benchmark.
+     *
+     * @param i_name name of the benchmark.
+     * @param i_fun benchmark function.
+     * @return true.
+     **/
+    static bool add( std::string const & i_name,
+                     t_fun               i_fun ) {
+      benchs().push_back( std::make_pair( i_name, i_fun ) );
+      return true;
+    }
+
+    /**
+     * Gets the names of the registered benchmarks.
+     *
+     * @return names.
+     **/
+    static std::vector< std::string > names() {
+      std::vector< std::string > l_names;
+      for( std::size_t l_be = 0; l_be < benchs().size(); l_be++ ) l_names.push_back( benchs()[l_be].first );
+      return l_names;
+    }
+
+    /**
+     * Measures the duration of a function.
+     * The function is executed once for warm-up, afterwards the number of repetitions is doubled until the minimum time is exceeded.
+     *
+     * @param i_fun function which is measured.
+     * @param i_minTime minimum time of all repetitions in seconds.
+     * @param o_nReps will be set to the number of repetitions of the final measurement.
+     * @return average time of a single execution in seconds.
+     *
+     * @paramt TL_T_FUN type of the function.
+     **/
+    template< typename TL_T_FUN >
+    static double time( TL_T_FUN      i_fun,
+                        double        i_minTime,
+                        std::size_t & o_nReps ) {
+      i_fun();
+
+      o_nReps = 1;
+      while( true ) {
+        std::chrono::steady_clock::time_point l_start = std::chrono::steady_clock::now();
+        for( std::size_t l_re = 0; l_re < o_nReps; l_re++ ) i_fun();
+        std::chrono::duration< double > l_dur = std::chrono::steady_clock::now() - l_start;
+
+        if( l_dur.count() >= i_minTime ) return l_dur.count() / o_nReps;
+        o_nReps *= 2;
+      }
+    }
+
+    /**
+     * Runs the benchmarks whose names contain the filter and writes the results as JSON.
+     *
+     * @param i_filter filter of the names, empty for all benchmarks.
+     * @param io_out stream to which the results are written.
+     * @param i_build optional record of the build configuration, which is written in front of the results.
+     * @return number of executed benchmarks.
+     **/
+    static std::size_t run( std::string const & i_filter,
+                            std::ostream      & io_out,
+                            Record      const * i_build = nullptr ) {
+      std::size_t l_nRun = 0;
+
+      io_out << "{";
+      if( i_build != nullptr ) io_out << "\"build\": " << i_build->json() << ",\n ";
+      io_out << "\"benchmarks\": [";
+      for( std::size_t l_be = 0; l_be < benchs().size(); l_be++ ) {
+        if( benchs()[l_be].first.find( i_filter ) == std::string::npos ) continue;
+
+        std::vector< Record > l_recs;
+        benchs()[l_be].second( l_recs );
+
+        io_out << ( l_nRun > 0 ? ",\n" : "\n" );
+        io_out << "  {\"name\": \"" << benchs()[l_be].first << "\", \"results\": [";
+        for( std::size_t l_re = 0; l_re < l_recs.size(); l_re++ ) {
+          io_out << ( l_re > 0 ? ",\n" : "\n" ) << "    " << l_recs[l_re].json();
+        }
+        io_out << "\n  ]}";
+        io_out.flush();
+
+        l_nRun++;
+      }
+      io_out << "\n]}" << std::endl;
+
+      return l_nRun;
+    }
+};
+
+#endif
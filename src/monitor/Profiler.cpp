@@ -0,0 +1,287 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Lightweight profiling of the work regions.
+ **/
+#include "Profiler.h"
+#include "io/logging.h"
+
+#include <algorithm>
+#include <fstream>
+
+edge::monitor::Profiler::~Profiler() {
+  fin();
+  delete[] m_rgns;
+  delete[] m_idle;
+}
+
+void edge::monitor::Profiler::init( unsigned int         i_nTds,
+                                    unsigned short       i_nTgs,
+                                    unsigned short       i_nEntries,
+                                    std::string  const & i_path ) {
+  EDGE_CHECK_GT( i_nTds, 0 );
+  EDGE_CHECK_GT( i_nEntries, 0 );
+
+  m_path = i_path;
+  m_csv = m_path.size() >= 4 && m_path.compare( m_path.size()-4, 4, ".csv" ) == 0;
+
+  m_nTds = i_nTds;
+  m_nEntries = i_nEntries;
+  m_nRgns = (unsigned int) i_nTgs * i_nEntries;
+
+  // pad the records of every thread to full cache lines
+  m_nRgnsPad = m_nRgns;
+  while( (m_nRgnsPad * sizeof(t_rgn)) % (N_PAD * sizeof(double)) != 0 ) m_nRgnsPad++;
+
+  delete[] m_rgns;
+  delete[] m_idle;
+  m_rgns = new t_rgn[ std::max( m_nTds * m_nRgnsPad, 1u ) ];
+  m_idle = new double[m_nTds][N_PAD];
+
+  // running total
+  m_total.sync = 0;
+  m_total.simTime = 0;
+  m_total.wallTime = 0;
+  m_total.rgns.assign( m_nTds, std::vector< t_rgn >( m_nRgns, t_rgn{ 0, 0, 0, 0 } ) );
+  m_total.idle.assign( m_nTds, 0 );
+
+  // start the output
+  if( m_out.is_open() ) m_out.close();
+  if( m_path != "" ) {
+    m_out.open( m_path );
+    EDGE_CHECK( m_out.good() ) << "failed to open profiler output: " << m_path;
+    writeHeader( m_out );
+    m_out << std::flush;
+  }
+
+  reset();
+}
+
+void edge::monitor::Profiler::setFlops( unsigned short i_st,
+                                        double         i_flops ) {
+  if( m_flops.size() <= i_st ) m_flops.resize( i_st+1, 0 );
+  m_flops[i_st] = i_flops;
+}
+
+double edge::monitor::Profiler::flops( t_rgn const & i_rgn ) const {
+  if( i_rgn.st >= m_flops.size() ) return 0;
+  return m_flops[i_rgn.st] * i_rgn.ens;
+}
+
+void edge::monitor::Profiler::reset() {
+  for( unsigned int l_ri = 0; l_ri < m_nTds * m_nRgnsPad; l_ri++ ) {
+    m_rgns[l_ri].time = 0;
+    m_rgns[l_ri].calls = 0;
+    m_rgns[l_ri].ens = 0;
+    m_rgns[l_ri].st = 0;
+  }
+  for( unsigned int l_td = 0; l_td < m_nTds; l_td++ ) m_idle[l_td][0] = 0;
+
+  m_start = now();
+}
+
+void edge::monitor::Profiler::dump( std::size_t i_sync,
+                                    double      i_simTime ) {
+  // summarize the interval
+  t_interval l_in;
+  l_in.sync = i_sync;
+  l_in.simTime = i_simTime;
+  l_in.wallTime = now() - m_start;
+  l_in.rgns.resize( m_nTds );
+  l_in.idle.resize( m_nTds );
+
+  for( unsigned int l_td = 0; l_td < m_nTds; l_td++ ) {
+    l_in.rgns[l_td].assign( m_rgns + l_td*m_nRgnsPad,
+                            m_rgns + l_td*m_nRgnsPad + m_nRgns );
+    l_in.idle[l_td] = m_idle[l_td][0];
+  }
+
+  // add to the running total
+  m_total.sync++;
+  m_total.simTime = l_in.simTime;
+  m_total.wallTime += l_in.wallTime;
+  for( unsigned int l_td = 0; l_td < m_nTds; l_td++ ) {
+    m_total.idle[l_td] += l_in.idle[l_td];
+
+    for( unsigned int l_rg = 0; l_rg < m_nRgns; l_rg++ ) {
+      t_rgn const & l_src = l_in.rgns[l_td][l_rg];
+      t_rgn       & l_dst = m_total.rgns[l_td][l_rg];
+      l_dst.time  += l_src.time;
+      l_dst.calls += l_src.calls;
+      l_dst.ens   += l_src.ens;
+      if( l_src.calls > 0 ) l_dst.st = l_src.st;
+    }
+  }
+
+  // append the record of the interval
+  if( m_out.is_open() ) {
+    writeRecord( l_in, false, m_out );
+    m_out << std::flush;
+  }
+
+  reset();
+}
+
+void edge::monitor::Profiler::fin() {
+  if( !m_out.is_open() ) return;
+
+  writeRecord( m_total, true, m_out );
+  m_out.close();
+}
+
+void edge::monitor::Profiler::writeJson( t_interval const & i_in,
+                                         std::ostream     & io_stream ) const {
+  io_stream << "{\"sync\": " << i_in.sync
+            << ", \"sim_time\": " << i_in.simTime
+            << ", \"wall_time\": " << i_in.wallTime
+            << ", \"regions\": [";
+
+  bool l_first = true;
+  for( unsigned int l_rg = 0; l_rg < m_nRgns; l_rg++ ) {
+    // accumulate the workers' counters
+    t_rgn l_sum = { 0, 0, 0, 0 };
+    double l_max = 0;
+    for( unsigned int l_td = 0; l_td < m_nTds; l_td++ ) {
+      t_rgn const & l_rgn = i_in.rgns[l_td][l_rg];
+      l_sum.time  += l_rgn.time;
+      l_sum.calls += l_rgn.calls;
+      l_sum.ens   += l_rgn.ens;
+      if( l_rgn.calls > 0 ) l_sum.st = l_rgn.st;
+      l_max = std::max( l_max, l_rgn.time );
+    }
+    if( l_sum.calls == 0 ) continue;
+
+    double l_flops = flops( l_sum );
+
+    io_stream << ( l_first ? "" : ", " )
+              << "{\"id\": " << l_rg
+              << ", \"time_group\": " << l_rg / m_nEntries
+              << ", \"entry\": " << l_rg % m_nEntries
+              << ", \"step\": " << l_sum.st
+              << ", \"calls\": " << l_sum.calls
+              << ", \"entities\": " << l_sum.ens
+              << ", \"time\": " << l_sum.time
+              << ", \"time_max\": " << l_max
+              << ", \"flops\": " << l_flops
+              << ", \"gflops\": " << ( l_sum.time > 0 ? l_flops / l_sum.time * 1.0E-9 : 0 )
+              << ", \"time_threads\": [";
+    for( unsigned int l_td = 0; l_td < m_nTds; l_td++ ) {
+      io_stream << ( l_td == 0 ? "" : ", " ) << i_in.rgns[l_td][l_rg].time;
+    }
+    io_stream << "]}";
+    l_first = false;
+  }
+
+  io_stream << "], \"threads\": [";
+  for( unsigned int l_td = 0; l_td < m_nTds; l_td++ ) {
+    double l_busy = 0;
+    for( unsigned int l_rg = 0; l_rg < m_nRgns; l_rg++ ) l_busy += i_in.rgns[l_td][l_rg].time;
+
+    io_stream << ( l_td == 0 ? "" : ", " )
+              << "{\"thread\": " << l_td
+              << ", \"busy\": " << l_busy
+              << ", \"idle\": " << i_in.idle[l_td] << "}";
+  }
+  io_stream << "]}";
+}
+
+void edge::monitor::Profiler::writeCsv( std::string const & i_sync,
+                                        t_interval  const & i_in,
+                                        std::ostream      & io_stream ) const {
+  for( unsigned int l_td = 0; l_td < m_nTds; l_td++ ) {
+    for( unsigned int l_rg = 0; l_rg < m_nRgns; l_rg++ ) {
+      t_rgn const & l_rgn = i_in.rgns[l_td][l_rg];
+      if( l_rgn.calls == 0 ) continue;
+
+      io_stream << i_sync << "," << i_in.simTime << "," << i_in.wallTime << ","
+                << l_td << "," << l_rg << ","
+                << l_rg / m_nEntries << "," << l_rg % m_nEntries << "," << l_rgn.st << ","
+                << l_rgn.calls << "," << l_rgn.ens << "," << l_rgn.time << ","
+                << flops( l_rgn ) << "\n";
+    }
+
+    // idle time
+    io_stream << i_sync << "," << i_in.simTime << "," << i_in.wallTime << ","
+              << l_td << ",idle,,,,,," << i_in.idle[l_td] << ",\n";
+  }
+}
+
+void edge::monitor::Profiler::writeHeader( std::ostream & io_stream ) const {
+  if( m_csv ) {
+    io_stream << "sync,sim_time,wall_time,thread,region,time_group,entry,step,calls,entities,time,flops\n";
+  }
+  else {
+    io_stream << "{\"threads\": " << m_nTds
+              << ", \"time_groups\": " << m_nRgns / m_nEntries << "}\n";
+  }
+}
+
+void edge::monitor::Profiler::writeRecord( t_interval const & i_in,
+                                           bool               i_total,
+                                           std::ostream     & io_stream ) const {
+  if( m_csv ) {
+    writeCsv( i_total ? "total" : std::to_string( i_in.sync ),
+              i_in,
+              io_stream );
+  }
+  else {
+    if( i_total ) io_stream << "{\"total\": ";
+    writeJson( i_in,
+               io_stream );
+    if( i_total ) io_stream << "}";
+    io_stream << "\n";
+  }
+}
+
+void edge::monitor::Profiler::print() const {
+  t_interval const & l_tot = total();
+
+  // accumulate per step
+  std::vector< t_rgn > l_steps;
+  double l_idle = 0;
+  for( unsigned int l_td = 0; l_td < m_nTds; l_td++ ) {
+    l_idle += l_tot.idle[l_td];
+
+    for( unsigned int l_rg = 0; l_rg < m_nRgns; l_rg++ ) {
+      t_rgn const & l_rgn = l_tot.rgns[l_td][l_rg];
+      if( l_rgn.calls == 0 ) continue;
+
+      if( l_steps.size() <= l_rgn.st ) l_steps.resize( l_rgn.st+1, { 0, 0, 0, 0 } );
+      l_steps[l_rgn.st].time  += l_rgn.time;
+      l_steps[l_rgn.st].calls += l_rgn.calls;
+      l_steps[l_rgn.st].ens   += l_rgn.ens;
+      l_steps[l_rgn.st].st     = l_rgn.st;
+    }
+  }
+
+  EDGE_LOG_INFO << "profile of the work regions (" << l_tot.sync << " intervals, "
+                << l_tot.wallTime << " seconds):";
+  for( unsigned short l_st = 0; l_st < l_steps.size(); l_st++ ) {
+    if( l_steps[l_st].calls == 0 ) continue;
+
+    double l_flops = flops( l_steps[l_st] );
+    EDGE_LOG_INFO << "  step #" << l_st << ": "
+                  << l_steps[l_st].time << " thread-seconds, "
+                  << l_steps[l_st].calls << " calls, "
+                  << l_steps[l_st].ens << " entities, "
+                  << ( l_steps[l_st].time > 0 ? l_flops / l_steps[l_st].time * 1.0E-9 : 0 ) << " GFLOPS per thread";
+  }
+  EDGE_LOG_INFO << "  idle: " << l_idle << " thread-seconds";
+}
@@ -0,0 +1,290 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Lightweight profiling of the work regions.
+ **/
+#ifndef EDGE_MONITOR_PROFILER_H
+#define EDGE_MONITOR_PROFILER_H
+
+#include <cstddef>
+#include <ctime>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace edge {
+  namespace monitor {
+    class Profiler;
+  }
+}
+
+/**
+ * Lightweight, always-available profiler of the time stepping.
+ *
+ * Every worker accumulates wall-clock time, number of calls and number of processed entities per work region in its own, cache line-padded records.
+ * Time spent without work (idle workers spinning for new work) is accumulated separately per worker.
+ * FLOP estimates are derived from the entities processed per step and per-entity estimates, which are given by the equations (if available).
+ *
+ * The counters of a synchronization interval are summarized through dump() and reset afterwards.
+ * Every summary is appended to the output file as a single record (CSV rows or a JSON Lines object) and flushed;
+ * only the running total is kept in memory and appended by fin().
+ **/
+class edge::monitor::Profiler {
+  public:
+    //! counters of a work region
+    typedef struct {
+      //! accumulated wall-clock time (seconds)
+      double time;
+      //! number of calls
+      std::size_t calls;
+      //! number of processed entities
+      std::size_t ens;
+      //! step of the work region
+      unsigned short st;
+    } t_rgn;
+
+  private:
+    //! number of doubles per cache line, used to separate the records of the workers
+    static unsigned short const N_PAD = 64 / sizeof(double);
+
+    //! summary of a single synchronization interval
+    typedef struct {
+      //! id of the synchronization point, ending the interval
+      std::size_t sync;
+      //! simulation time at the synchronization point
+      double simTime;
+      //! wall-clock time of the interval
+      double wallTime;
+      //! counters of the work regions, accumulated over the workers [*][]: thread, [][*]: region
+      std::vector< std::vector< t_rgn > > rgns;
+      //! idle time of the workers
+      std::vector< double > idle;
+    } t_interval;
+
+    //! path to the output file, empty if disabled
+    std::string m_path = "";
+
+    //! true if CSV output is used, JSON Lines otherwise
+    bool m_csv = false;
+
+    //! output stream, open if the output is enabled and not finished
+    std::ofstream m_out;
+
+    //! number of threads
+    unsigned int m_nTds = 0;
+
+    //! number of entries per time group
+    unsigned short m_nEntries = 0;
+
+    //! number of work regions
+    unsigned int m_nRgns = 0;
+
+    //! number of records per thread, padded to cache lines
+    unsigned int m_nRgnsPad = 0;
+
+    //! records of the work regions [*][]: thread, [][*]: region
+    t_rgn * m_rgns = nullptr;
+
+    //! idle time of the workers, padded to cache lines
+    double (* m_idle)[N_PAD] = nullptr;
+
+    //! FLOP estimates per entity and step
+    std::vector< double > m_flops;
+
+    //! start of the current interval
+    double m_start = 0;
+
+    //! running total of the finished intervals, sync is the number of intervals
+    t_interval m_total;
+
+    /**
+     * Writes the summary of an interval as single-line JSON object.
+     *
+     * @param i_in summary of the interval.
+     * @param io_stream stream which is written to.
+     **/
+    void writeJson( t_interval const & i_in,
+                    std::ostream     & io_stream ) const;
+
+    /**
+     * Writes the summary of an interval as CSV rows.
+     *
+     * @param i_sync value of the sync-column.
+     * @param i_in summary of the interval.
+     * @param io_stream stream which is written to.
+     **/
+    void writeCsv( std::string const & i_sync,
+                   t_interval  const & i_in,
+                   std::ostream      & io_stream ) const;
+
+    /**
+     * Writes the header of the output: the CSV columns or a JSON Lines object with the setup.
+     *
+     * @param io_stream stream which is written to.
+     **/
+    void writeHeader( std::ostream & io_stream ) const;
+
+    /**
+     * Writes the record of an interval or of the total.
+     *
+     * @param i_in summary of the interval or total.
+     * @param i_total true if the total is written.
+     * @param io_stream stream which is written to.
+     **/
+    void writeRecord( t_interval const & i_in,
+                      bool               i_total,
+                      std::ostream     & io_stream ) const;
+
+    /**
+     * Gets the running total of the finished intervals.
+     *
+     * @return summary, sync is set to the number of intervals.
+     **/
+    t_interval const & total() const { return m_total; }
+
+    /**
+     * Gets the FLOP estimate of a region's counters.
+     *
+     * @param i_rgn counters of the region.
+     * @return estimated number of floating point operations.
+     **/
+    double flops( t_rgn const & i_rgn ) const;
+
+  public:
+    /**
+     * Destructor.
+     **/
+    ~Profiler();
+
+    /**
+     * Gets the current wall-clock time.
+     *
+     * @return monotonic wall-clock time in seconds.
+     **/
+    static double now() {
+      struct timespec l_time;
+      clock_gettime( CLOCK_MONOTONIC, &l_time );
+      return (double) l_time.tv_sec + (double) l_time.tv_nsec * 1.0E-9;
+    }
+
+    /**
+     * Initializes the profiler.
+     *
+     * @param i_nTds number of threads.
+     * @param i_nTgs number of time groups.
+     * @param i_nEntries number of entries (work regions) per time group.
+     * @param i_path path to the output file, the extension .csv selects CSV-output, JSON Lines otherwise.
+     **/
+    void init( unsigned int         i_nTds,
+               unsigned short       i_nTgs,
+               unsigned short       i_nEntries,
+               std::string  const & i_path );
+
+    /**
+     * Sets the FLOP estimate per entity of a step.
+     *
+     * @param i_st step.
+     * @param i_flops number of floating point operations per entity.
+     **/
+    void setFlops( unsigned short i_st,
+                   double         i_flops );
+
+    /**
+     * Adds the counters of a processed work package.
+     *
+     * @param i_td thread which processed the package.
+     * @param i_id id of the work region.
+     * @param i_st step of the work region.
+     * @param i_nEns number of processed entities.
+     * @param i_time wall-clock time (seconds).
+     **/
+    void addRgn( unsigned int   i_td,
+                 unsigned int   i_id,
+                 unsigned short i_st,
+                 std::size_t    i_nEns,
+                 double         i_time ) {
+      t_rgn & l_rgn = m_rgns[ i_td*m_nRgnsPad + i_id ];
+      l_rgn.time += i_time;
+      l_rgn.calls++;
+      l_rgn.ens += i_nEns;
+      l_rgn.st = i_st;
+    }
+
+    /**
+     * Adds idle time of a worker.
+     *
+     * @param i_td thread.
+     * @param i_time wall-clock time (seconds).
+     **/
+    void addIdle( unsigned int i_td,
+                  double       i_time ) {
+      m_idle[i_td][0] += i_time;
+    }
+
+    /**
+     * Gets the counters of a work region.
+     *
+     * @param i_td thread.
+     * @param i_id id of the work region.
+     * @return counters.
+     **/
+    t_rgn const & getRgn( unsigned int i_td,
+                          unsigned int i_id ) const {
+      return m_rgns[ i_td*m_nRgnsPad + i_id ];
+    }
+
+    /**
+     * Gets the idle time of a worker.
+     *
+     * @param i_td thread.
+     * @return idle time (seconds).
+     **/
+    double getIdle( unsigned int i_td ) const {
+      return m_idle[i_td][0];
+    }
+
+    /**
+     * Resets the counters and starts a new interval.
+     **/
+    void reset();
+
+    /**
+     * Summarizes the counters of the current interval, appends the summary to the output file and starts a new interval.
+     * Has to be called outside of parallel regions.
+     *
+     * @param i_sync id of the synchronization point.
+     * @param i_simTime simulation time at the synchronization point.
+     **/
+    void dump( std::size_t i_sync,
+               double      i_simTime );
+
+    /**
+     * Appends the total of all intervals to the output file and closes it.
+     **/
+    void fin();
+
+    /**
+     * Prints the total of all intervals through the logging interface.
+     **/
+    void print() const;
+};
+
+#endif
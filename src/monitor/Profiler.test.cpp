@@ -0,0 +1,190 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Tests the profiler.
+ **/
+#include <catch.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#define private public
+#include "Profiler.h"
+#undef private
+
+TEST_CASE( "Monitor: Profiler.", "[profiler][monitor]" ) {
+  edge::monitor::Profiler l_prof;
+
+  // monotonic wall-clock time
+  double l_t0 = edge::monitor::Profiler::now();
+  double l_t1 = edge::monitor::Profiler::now();
+  REQUIRE( l_t0 > 0 );
+  REQUIRE( l_t1 >= l_t0 );
+
+  // 3 threads, 2 time groups with 4 entries each
+  l_prof.init( 3, 2, 4, "" );
+  REQUIRE( l_prof.m_nRgns == 8 );
+  REQUIRE( l_prof.m_nRgnsPad >= 8 );
+  REQUIRE( (l_prof.m_nRgnsPad * sizeof(edge::monitor::Profiler::t_rgn)) % 64 == 0 );
+  REQUIRE( l_prof.m_csv == false );
+
+  // counters are zero after initialization
+  for( unsigned int l_td = 0; l_td < 3; l_td++ ) {
+    REQUIRE( l_prof.getIdle( l_td ) == 0 );
+    for( unsigned int l_rg = 0; l_rg < 8; l_rg++ ) {
+      REQUIRE( l_prof.getRgn( l_td, l_rg ).calls == 0 );
+      REQUIRE( l_prof.getRgn( l_td, l_rg ).ens   == 0 );
+      REQUIRE( l_prof.getRgn( l_td, l_rg ).time  == 0 );
+    }
+  }
+
+  // add some work
+  l_prof.addRgn( 0, 0, 0, 100, 1.0 );
+  l_prof.addRgn( 0, 0, 0,  50, 0.5 );
+  l_prof.addRgn( 1, 0, 0,  20, 0.25 );
+  l_prof.addRgn( 2, 6, 2,  10, 2.0 );
+  l_prof.addIdle( 1, 0.75 );
+  l_prof.addIdle( 1, 0.25 );
+
+  REQUIRE( l_prof.getRgn( 0, 0 ).calls == 2 );
+  REQUIRE( l_prof.getRgn( 0, 0 ).ens   == 150 );
+  REQUIRE( l_prof.getRgn( 0, 0 ).time  == Approx( 1.5 ) );
+  REQUIRE( l_prof.getRgn( 1, 0 ).calls == 1 );
+  REQUIRE( l_prof.getRgn( 1, 0 ).ens   == 20 );
+  REQUIRE( l_prof.getRgn( 2, 6 ).st    == 2 );
+  REQUIRE( l_prof.getRgn( 2, 5 ).calls == 0 );
+  REQUIRE( l_prof.getIdle( 0 ) == 0 );
+  REQUIRE( l_prof.getIdle( 1 ) == Approx( 1.0 ) );
+
+  // FLOP estimates
+  l_prof.setFlops( 2, 1000 );
+  REQUIRE( l_prof.flops( l_prof.getRgn( 0, 0 ) ) == 0 );
+  REQUIRE( l_prof.flops( l_prof.getRgn( 2, 6 ) ) == Approx( 10000 ) );
+  l_prof.setFlops( 0, 10 );
+  REQUIRE( l_prof.flops( l_prof.getRgn( 0, 0 ) ) == Approx( 1500 ) );
+
+  // summarize the first interval, which resets the counters
+  l_prof.dump( 1, 0.5 );
+  REQUIRE( l_prof.total().sync == 1 );
+  REQUIRE( l_prof.getRgn( 0, 0 ).calls == 0 );
+  REQUIRE( l_prof.getIdle( 1 ) == 0 );
+
+  // second interval
+  l_prof.addRgn( 0, 0, 0, 10, 0.5 );
+  l_prof.addRgn( 2, 7, 2, 30, 1.0 );
+  l_prof.addIdle( 2, 0.5 );
+  l_prof.dump( 2, 1.0 );
+  REQUIRE( l_prof.total().sync == 2 );
+
+  // check the total
+  edge::monitor::Profiler::t_interval l_tot = l_prof.total();
+  REQUIRE( l_tot.sync == 2 );
+  REQUIRE( l_tot.simTime == Approx( 1.0 ) );
+  REQUIRE( l_tot.rgns[0][0].calls == 3 );
+  REQUIRE( l_tot.rgns[0][0].ens   == 160 );
+  REQUIRE( l_tot.rgns[0][0].time  == Approx( 2.0 ) );
+  REQUIRE( l_tot.rgns[2][6].calls == 1 );
+  REQUIRE( l_tot.rgns[2][7].ens   == 30 );
+  REQUIRE( l_tot.rgns[2][7].st    == 2 );
+  REQUIRE( l_tot.idle[1] == Approx( 1.0 ) );
+  REQUIRE( l_tot.idle[2] == Approx( 0.5 ) );
+
+  // JSON Lines record of the total
+  std::ostringstream l_json;
+  l_prof.writeRecord( l_tot, true, l_json );
+  std::string l_jsonStr = l_json.str();
+  REQUIRE( l_jsonStr.find( "{\"total\": {\"sync\": 2" ) == 0 );
+  REQUIRE( l_jsonStr.find( "{\"id\": 6, \"time_group\": 1, \"entry\": 2, \"step\": 2, \"calls\": 1, \"entities\": 10" ) != std::string::npos );
+  REQUIRE( l_jsonStr.find( "\"flops\": 10000" ) != std::string::npos );
+  REQUIRE( std::count( l_jsonStr.begin(), l_jsonStr.end(), '\n' ) == 1 );
+  REQUIRE( l_jsonStr.back() == '\n' );
+
+  // brackets are balanced
+  long l_bal = 0;
+  long l_min = 0;
+  for( std::size_t l_ch = 0; l_ch < l_jsonStr.size(); l_ch++ ) {
+    if( l_jsonStr[l_ch] == '{' || l_jsonStr[l_ch] == '[' ) l_bal++;
+    if( l_jsonStr[l_ch] == '}' || l_jsonStr[l_ch] == ']' ) l_bal--;
+    l_min = std::min( l_min, l_bal );
+  }
+  REQUIRE( l_min == 0 );
+  REQUIRE( l_bal == 0 );
+
+  // CSV rows of the total
+  l_prof.m_csv = true;
+  std::ostringstream l_csv;
+  l_prof.writeHeader( l_csv );
+  l_prof.writeRecord( l_tot, true, l_csv );
+  std::string l_csvStr = l_csv.str();
+  REQUIRE( l_csvStr.find( "sync,sim_time,wall_time,thread,region,time_group,entry,step,calls,entities,time,flops\n" ) == 0 );
+  REQUIRE( l_csvStr.find( ",2,6,1,2,2,1,10,2,10000\n" ) != std::string::npos );
+  REQUIRE( l_csvStr.find( ",1,idle,,,,,,1,\n" ) != std::string::npos );
+  REQUIRE( l_csvStr.find( "\ntotal,1," ) != std::string::npos );
+
+  // rows: header + the total with 3 idle rows and the active regions
+  REQUIRE( std::count( l_csvStr.begin(), l_csvStr.end(), '\n' ) == 1 + (3+4) );
+
+  // selection of the format through the extension
+  std::string l_pathCsv = std::string( std::tmpnam(nullptr) ) + ".csv";
+  l_prof.init( 1, 1, 1, l_pathCsv );
+  REQUIRE( l_prof.m_csv == true );
+  REQUIRE( l_prof.total().sync == 0 );
+  l_prof.fin();
+  std::remove( l_pathCsv.c_str() );
+
+  // the records are appended at every synchronization point, the total at the end
+  std::string l_pathJson = std::string( std::tmpnam(nullptr) ) + ".json";
+  l_prof.init( 2, 1, 2, l_pathJson );
+  REQUIRE( l_prof.m_csv == false );
+
+  std::size_t l_nLines[4] = { 0, 0, 0, 0 };
+  for( unsigned short l_sy = 0; l_sy < 4; l_sy++ ) {
+    if( l_sy < 3 ) {
+      l_prof.addRgn( 1, 1, 0, 5, 0.5 );
+      l_prof.dump( l_sy+1, l_sy+1.0 );
+    }
+    else l_prof.fin();
+
+    // the output is flushed after every record
+    std::ifstream l_file( l_pathJson );
+    std::string l_line;
+    while( std::getline( l_file, l_line ) ) l_nLines[l_sy]++;
+  }
+  REQUIRE( l_nLines[0] == 2 );
+  REQUIRE( l_nLines[1] == 3 );
+  REQUIRE( l_nLines[2] == 4 );
+  REQUIRE( l_nLines[3] == 5 );
+  REQUIRE( l_prof.total().rgns[1][1].calls == 3 );
+  REQUIRE( l_prof.total().rgns[1][1].ens == 15 );
+
+  // finishing twice doesn't write anything
+  l_prof.fin();
+  std::ifstream l_file( l_pathJson );
+  std::string l_line;
+  std::string l_last;
+  std::size_t l_nLinesFin = 0;
+  while( std::getline( l_file, l_line ) ) {
+    l_last = l_line;
+    l_nLinesFin++;
+  }
+  REQUIRE( l_nLinesFin == 5 );
+  REQUIRE( l_last.find( "{\"total\": {\"sync\": 3, \"sim_time\": 3" ) == 0 );
+  std::remove( l_pathJson.c_str() );
+}
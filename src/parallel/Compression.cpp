@@ -0,0 +1,357 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Compression of the messages in distributed memory settings.
+ **/
+#include "Compression.h"
+#include "global.h"
+#include "io/logging.h"
+#ifdef PP_USE_MPI
+#include "mpi_wrapper.inc"
+#endif
+#include <cstring>
+
+void edge::parallel::Compression::config( std::string const & i_mode,
+                                          unsigned short      i_nByVal,
+                                          unsigned short      i_nBitsMant ) {
+  EDGE_CHECK( i_mode == "none" || i_mode == "lossless" || i_mode == "lossy" )
+    << "unknown compression mode: " << i_mode;
+  EDGE_CHECK( i_nByVal == 2 || i_nByVal == 4 || i_nByVal == 8 )
+    << "unsupported number of bytes per value: " << i_nByVal;
+
+  if(      i_mode == "lossless" ) m_mode = LOSSLESS;
+  else if( i_mode == "lossy"    ) m_mode = LOSSY;
+  else                            m_mode = NONE;
+
+  m_nByVal = i_nByVal;
+  m_nBitsMant = i_nBitsMant;
+}
+
+std::size_t edge::parallel::Compression::bound( std::size_t i_nBytes ) {
+  // header, raw data and worst-case overhead of the literal lengths
+  return 1 + i_nBytes + i_nBytes / 255 + 16;
+}
+
+void edge::parallel::Compression::round( std::size_t      i_nVals,
+                                         unsigned short   i_nByVal,
+                                         unsigned short   i_nBitsMant,
+                                         unsigned char  * io_vals ) {
+  // number of mantissa bits of the value's type
+  unsigned short l_nBitsMantTy = (i_nByVal == 2) ? 7 : ( (i_nByVal == 4) ? 23 : 52 );
+  if( i_nBitsMant >= l_nBitsMantTy ) return;
+
+  unsigned short l_nBitsDrop = l_nBitsMantTy - i_nBitsMant;
+  unsigned short l_nBitsExp = i_nByVal*8 - 1 - l_nBitsMantTy;
+
+  std::uint64_t l_maskExp  = ( (std::uint64_t(1) << l_nBitsExp) - 1 ) << l_nBitsMantTy;
+  std::uint64_t l_maskDrop = (std::uint64_t(1) << l_nBitsDrop) - 1;
+
+  for( std::size_t l_va = 0; l_va < i_nVals; l_va++ ) {
+    std::uint64_t l_bits = 0;
+    std::memcpy( &l_bits, io_vals + l_va*i_nByVal, i_nByVal );
+
+    // keep infinities and NaNs
+    if( (l_bits & l_maskExp) == l_maskExp ) continue;
+
+    // round to nearest, ties to even
+    std::uint64_t l_rnd = l_bits + (l_maskDrop >> 1) + ( (l_bits >> l_nBitsDrop) & 1 );
+    // truncate instead of rounding to infinity
+    if( (l_rnd & l_maskExp) == l_maskExp ) l_rnd = l_bits;
+    l_rnd &= ~l_maskDrop;
+
+    std::memcpy( io_vals + l_va*i_nByVal, &l_rnd, i_nByVal );
+  }
+}
+
+void edge::parallel::Compression::shuffle( std::size_t           i_nBytes,
+                                           unsigned short        i_nByVal,
+                                           unsigned char const * i_raw,
+                                           unsigned char       * o_shuf ) {
+  std::size_t l_nVals = i_nBytes / i_nByVal;
+
+  for( unsigned short l_by = 0; l_by < i_nByVal; l_by++ )
+    for( std::size_t l_va = 0; l_va < l_nVals; l_va++ )
+      o_shuf[l_by*l_nVals + l_va] = i_raw[l_va*i_nByVal + l_by];
+
+  for( std::size_t l_by = l_nVals*i_nByVal; l_by < i_nBytes; l_by++ )
+    o_shuf[l_by] = i_raw[l_by];
+}
+
+void edge::parallel::Compression::unshuffle( std::size_t           i_nBytes,
+                                             unsigned short        i_nByVal,
+                                             unsigned char const * i_shuf,
+                                             unsigned char       * o_raw ) {
+  std::size_t l_nVals = i_nBytes / i_nByVal;
+
+  for( std::size_t l_va = 0; l_va < l_nVals; l_va++ )
+    for( unsigned short l_by = 0; l_by < i_nByVal; l_by++ )
+      o_raw[l_va*i_nByVal + l_by] = i_shuf[l_by*l_nVals + l_va];
+
+  for( std::size_t l_by = l_nVals*i_nByVal; l_by < i_nBytes; l_by++ )
+    o_raw[l_by] = i_shuf[l_by];
+}
+
+std::size_t edge::parallel::Compression::lzCompress( std::size_t           i_nBytes,
+                                                     unsigned char const * i_in,
+                                                     unsigned char       * o_out ) {
+  // minimum length and max offset of a match
+  std::size_t const l_minMatch = 4;
+  std::size_t const l_maxOff = 65535;
+
+  // hash table of the last positions (+1) of four-byte sequences
+  std::uint32_t l_table[4096];
+  std::memset( l_table, 0, sizeof(l_table) );
+
+  std::size_t l_op = 0;
+  std::size_t l_ip = 0;
+  std::size_t l_anchor = 0;
+
+  // writes a sequence of literals and an optional match
+  auto l_emit = [&]( std::size_t i_nLits,
+                     std::size_t i_lenMatch,
+                     std::size_t i_off ) {
+    std::size_t l_lenMatch = (i_off > 0) ? i_lenMatch - l_minMatch : 0;
+
+    o_out[l_op++] = (unsigned char) (   ( ( (i_nLits < 15) ? i_nLits : 15 ) << 4 )
+                                      |     ( (l_lenMatch < 15) ? l_lenMatch : 15 ) );
+
+    if( i_nLits >= 15 ) {
+      std::size_t l_rem = i_nLits - 15;
+      for( ; l_rem >= 255; l_rem -= 255 ) o_out[l_op++] = 255;
+      o_out[l_op++] = (unsigned char) l_rem;
+    }
+
+    std::memcpy( o_out+l_op, i_in+l_anchor, i_nLits );
+    l_op += i_nLits;
+
+    if( i_off > 0 ) {
+      o_out[l_op++] = (unsigned char) (  i_off       & 0xff );
+      o_out[l_op++] = (unsigned char) ( (i_off >> 8) & 0xff );
+
+      if( l_lenMatch >= 15 ) {
+        std::size_t l_rem = l_lenMatch - 15;
+        for( ; l_rem >= 255; l_rem -= 255 ) o_out[l_op++] = 255;
+        o_out[l_op++] = (unsigned char) l_rem;
+      }
+    }
+  };
+
+  // the last bytes are always literals
+  if( i_nBytes > 12 ) {
+    std::size_t l_limit = i_nBytes - 5;
+
+    while( l_ip + l_minMatch <= l_limit ) {
+      std::uint32_t l_seq;
+      std::memcpy( &l_seq, i_in+l_ip, 4 );
+      std::uint32_t l_hash = (l_seq * 2654435761u) >> 20;
+
+      std::size_t l_cand = l_table[l_hash];
+      l_table[l_hash] = (std::uint32_t) (l_ip+1);
+
+      if(    l_cand > 0
+          && l_ip - (l_cand-1) <= l_maxOff
+          && std::memcmp( i_in+l_cand-1, i_in+l_ip, l_minMatch ) == 0 ) {
+        std::size_t l_ref = l_cand-1;
+        std::size_t l_len = l_minMatch;
+        while( l_ip + l_len < l_limit && i_in[l_ref+l_len] == i_in[l_ip+l_len] ) l_len++;
+
+        l_emit( l_ip - l_anchor, l_len, l_ip - l_ref );
+        l_ip += l_len;
+        l_anchor = l_ip;
+      }
+      else l_ip++;
+    }
+  }
+
+  // trailing literals
+  l_emit( i_nBytes - l_anchor, 0, 0 );
+
+  return l_op;
+}
+
+bool edge::parallel::Compression::lzDecompress( std::size_t           i_nBytesIn,
+                                                unsigned char const * i_in,
+                                                std::size_t           i_nBytesOut,
+                                                unsigned char       * o_out ) {
+  std::size_t l_ip = 0;
+  std::size_t l_op = 0;
+
+  // reads the extension of a length
+  auto l_ext = [&]( std::size_t & io_len ) {
+    unsigned char l_by = 255;
+    while( l_by == 255 ) {
+      if( l_ip >= i_nBytesIn ) return false;
+      l_by = i_in[l_ip++];
+      io_len += l_by;
+    }
+    return true;
+  };
+
+  while( true ) {
+    if( l_ip >= i_nBytesIn ) return false;
+    unsigned char l_token = i_in[l_ip++];
+
+    // literals
+    std::size_t l_nLits = l_token >> 4;
+    if( l_nLits == 15 && !l_ext( l_nLits ) ) return false;
+    if( l_ip + l_nLits > i_nBytesIn || l_op + l_nLits > i_nBytesOut ) return false;
+
+    std::memcpy( o_out+l_op, i_in+l_ip, l_nLits );
+    l_ip += l_nLits;
+    l_op += l_nLits;
+
+    // the last sequence holds literals only
+    if( l_op == i_nBytesOut ) return l_ip == i_nBytesIn;
+
+    // match
+    if( l_ip + 2 > i_nBytesIn ) return false;
+    std::size_t l_off = std::size_t( i_in[l_ip] ) | ( std::size_t( i_in[l_ip+1] ) << 8 );
+    l_ip += 2;
+
+    std::size_t l_lenMatch = l_token & 15;
+    if( l_lenMatch == 15 && !l_ext( l_lenMatch ) ) return false;
+    l_lenMatch += 4;
+
+    if( l_off == 0 || l_off > l_op || l_op + l_lenMatch > i_nBytesOut ) return false;
+
+    // byte-wise copy, since the match might overlap
+    for( std::size_t l_by = 0; l_by < l_lenMatch; l_by++ )
+      o_out[l_op+l_by] = o_out[l_op-l_off+l_by];
+    l_op += l_lenMatch;
+  }
+}
+
+std::size_t edge::parallel::Compression::encode( std::size_t           i_nBytes,
+                                                 unsigned char const * i_raw,
+                                                 unsigned char       * o_enc ) {
+  m_timerEnc.start();
+
+  std::size_t l_nBytesEnc = 0;
+  unsigned char const * l_raw = i_raw;
+
+  if( m_mode != NONE ) {
+    if( m_scratchEnc[0].size() < i_nBytes ) {
+      m_scratchEnc[0].resize( i_nBytes );
+      m_scratchEnc[1].resize( i_nBytes );
+    }
+
+    // round the mantissas
+    if( m_mode == LOSSY ) {
+      std::memcpy( m_scratchEnc[0].data(), i_raw, i_nBytes );
+      round( i_nBytes / m_nByVal,
+             m_nByVal,
+             m_nBitsMant,
+             m_scratchEnc[0].data() );
+      l_raw = m_scratchEnc[0].data();
+    }
+
+    shuffle( i_nBytes,
+             m_nByVal,
+             l_raw,
+             m_scratchEnc[1].data() );
+
+    l_nBytesEnc = lzCompress( i_nBytes,
+                              m_scratchEnc[1].data(),
+                              o_enc+1 );
+  }
+
+  // compressed stream or raw data if the data does not compress
+  if( m_mode != NONE && l_nBytesEnc < i_nBytes ) {
+    o_enc[0] = 1;
+  }
+  else {
+    o_enc[0] = 0;
+    std::memcpy( o_enc+1, l_raw, i_nBytes );
+    l_nBytesEnc = i_nBytes;
+  }
+  l_nBytesEnc++;
+
+  m_nMsgsEnc++;
+  m_nBytesRaw += i_nBytes;
+  m_nBytesEnc += l_nBytesEnc;
+
+  m_timerEnc.end();
+
+  return l_nBytesEnc;
+}
+
+void edge::parallel::Compression::decode( std::size_t           i_nBytesEnc,
+                                          unsigned char const * i_enc,
+                                          std::size_t           i_nBytes,
+                                          unsigned char       * o_raw ) {
+  m_timerDec.start();
+
+  EDGE_CHECK_GT( i_nBytesEnc, 0 );
+
+  if( i_enc[0] == 0 ) {
+    EDGE_CHECK_EQ( i_nBytesEnc, i_nBytes+1 );
+    std::memcpy( o_raw, i_enc+1, i_nBytes );
+  }
+  else {
+    EDGE_CHECK_EQ( i_enc[0], 1 );
+    if( m_scratchDec.size() < i_nBytes ) m_scratchDec.resize( i_nBytes );
+
+    bool l_valid = lzDecompress( i_nBytesEnc-1,
+                                 i_enc+1,
+                                 i_nBytes,
+                                 m_scratchDec.data() );
+    EDGE_CHECK( l_valid ) << "corrupted compressed message";
+
+    unshuffle( i_nBytes,
+               m_nByVal,
+               m_scratchDec.data(),
+               o_raw );
+  }
+
+  m_nMsgsDec++;
+
+  m_timerDec.end();
+}
+
+double edge::parallel::Compression::ratio() const {
+  if( m_nBytesEnc == 0 ) return 1;
+  return double(m_nBytesRaw) / double(m_nBytesEnc);
+}
+
+void edge::parallel::Compression::logStats() const {
+  unsigned long long l_stats[4] = { m_nMsgsEnc, m_nMsgsDec, m_nBytesRaw, m_nBytesEnc };
+  double l_times[2] = { m_timerEnc.elapsed(), m_timerDec.elapsed() };
+
+  unsigned long long l_statsG[4];
+  double l_timesG[2];
+#ifdef PP_USE_MPI
+  MPI_Allreduce( l_stats, l_statsG, 4, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD );
+  MPI_Allreduce( l_times, l_timesG, 2, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD );
+#else
+  for( unsigned short l_st = 0; l_st < 4; l_st++ ) l_statsG[l_st] = l_stats[l_st];
+  for( unsigned short l_ti = 0; l_ti < 2; l_ti++ ) l_timesG[l_ti] = l_times[l_ti];
+#endif
+
+  double l_ratio = (l_statsG[3] > 0) ? double(l_statsG[2]) / double(l_statsG[3]) : 1;
+
+  EDGE_LOG_INFO << "statistics of the message compression (" << ( (m_mode == LOSSY) ? "lossy" : "lossless" ) << "):";
+  EDGE_LOG_INFO << "  #encoded messages:          " << l_statsG[0];
+  EDGE_LOG_INFO << "  #decoded messages:          " << l_statsG[1];
+  EDGE_LOG_INFO << "  raw bytes:                  " << l_statsG[2];
+  EDGE_LOG_INFO << "  encoded bytes:              " << l_statsG[3];
+  EDGE_LOG_INFO << "  compression ratio:          " << l_ratio;
+  EDGE_LOG_INFO << "  max encoding time any rank: " << l_timesG[0] << "s";
+  EDGE_LOG_INFO << "  max decoding time any rank: " << l_timesG[1] << "s";
+}
@@ -0,0 +1,226 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Compression of the messages in distributed memory settings.
+ **/
+#ifndef EDGE_PARALLEL_COMPRESSION_H
+#define EDGE_PARALLEL_COMPRESSION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "monitor/Timer.hpp"
+
+namespace edge {
+  namespace parallel {
+    class Compression;
+  }
+}
+
+/**
+ * Compression of the messages in distributed memory settings.
+ *
+ * The lossless mode shuffles the bytes of the values (all first bytes, all second bytes, ..) and applies a fast LZ-type compression.
+ * The lossy mode additionally rounds the mantissas of the floating point values to the given number of bits.
+ * This bounds the relative error by 2^-(#bits+1).
+ *
+ * Encoded messages start with a one-byte header, which is followed by either the raw data or the compressed stream.
+ * Data which does not compress is sent raw.
+ **/
+class edge::parallel::Compression {
+  public:
+    //! compression mode
+    typedef enum {
+      NONE     = 0,
+      LOSSLESS = 1,
+      LOSSY    = 2
+    } t_mode;
+
+  private:
+    //! compression mode
+    t_mode m_mode = NONE;
+
+    //! number of bytes per value
+    unsigned short m_nByVal = 4;
+
+    //! number of mantissa bits kept in lossy compression
+    unsigned short m_nBitsMant = 0;
+
+    //! scratch memory of the encoding
+    std::vector< unsigned char > m_scratchEnc[2];
+
+    //! scratch memory of the decoding
+    std::vector< unsigned char > m_scratchDec;
+
+    //! number of encoded messages
+    std::size_t m_nMsgsEnc = 0;
+
+    //! number of decoded messages
+    std::size_t m_nMsgsDec = 0;
+
+    //! number of raw bytes of the encoded messages
+    std::size_t m_nBytesRaw = 0;
+
+    //! number of bytes after encoding
+    std::size_t m_nBytesEnc = 0;
+
+    //! timer of the encoding
+    monitor::Timer m_timerEnc;
+
+    //! timer of the decoding
+    monitor::Timer m_timerDec;
+
+  public:
+    /**
+     * Configures the compression.
+     *
+     * @param i_mode compression mode: none, lossless or lossy.
+     * @param i_nByVal number of bytes per value: 2 (bfloat16), 4 (float) or 8 (double).
+     * @param i_nBitsMant number of mantissa bits, which are kept in lossy compression.
+     **/
+    void config( std::string const & i_mode,
+                 unsigned short      i_nByVal,
+                 unsigned short      i_nBitsMant );
+
+    /**
+     * Gets the compression mode.
+     *
+     * @return compression mode.
+     **/
+    t_mode mode() const { return m_mode; }
+
+    /**
+     * Gets the maximum size of an encoded message.
+     *
+     * @param i_nBytes number of bytes of the raw message.
+     * @return maximum number of bytes after encoding.
+     **/
+    static std::size_t bound( std::size_t i_nBytes );
+
+    /**
+     * Rounds the mantissas of the floating point values.
+     * Infinities and NaNs are kept, values which would round to infinity are truncated.
+     *
+     * @param i_nVals number of values.
+     * @param i_nByVal number of bytes per value: 2 (bfloat16), 4 (float) or 8 (double).
+     * @param i_nBitsMant number of mantissa bits, which are kept.
+     * @param io_vals values which will be rounded.
+     **/
+    static void round( std::size_t      i_nVals,
+                       unsigned short   i_nByVal,
+                       unsigned short   i_nBitsMant,
+                       unsigned char  * io_vals );
+
+    /**
+     * Shuffles the bytes of the values, the i-th byte of all values is stored contiguously.
+     * Trailing bytes, which do not form a full value, are copied.
+     *
+     * @param i_nBytes number of bytes.
+     * @param i_nByVal number of bytes per value.
+     * @param i_raw raw data.
+     * @param o_shuf will be set to the shuffled data.
+     **/
+    static void shuffle( std::size_t           i_nBytes,
+                         unsigned short        i_nByVal,
+                         unsigned char const * i_raw,
+                         unsigned char       * o_shuf );
+
+    /**
+     * Reverts the shuffle of the bytes.
+     *
+     * @param i_nBytes number of bytes.
+     * @param i_nByVal number of bytes per value.
+     * @param i_shuf shuffled data.
+     * @param o_raw will be set to the raw data.
+     **/
+    static void unshuffle( std::size_t           i_nBytes,
+                           unsigned short        i_nByVal,
+                           unsigned char const * i_shuf,
+                           unsigned char       * o_raw );
+
+    /**
+     * LZ-type compression.
+     * The stream is a sequence of tokens, holding the number of literals and the length of the match in 4 bit each,
+     * followed by extensions of the lengths, the literals and the 16 bit offset of the match.
+     * The last sequence holds literals only.
+     *
+     * @param i_nBytes number of input bytes.
+     * @param i_in input data.
+     * @param o_out will be set to the compressed stream, requires at least bound( i_nBytes ) bytes.
+     * @return number of bytes in the compressed stream.
+     **/
+    static std::size_t lzCompress( std::size_t           i_nBytes,
+                                   unsigned char const * i_in,
+                                   unsigned char       * o_out );
+
+    /**
+     * LZ-type decompression.
+     *
+     * @param i_nBytesIn number of bytes in the compressed stream.
+     * @param i_in compressed stream.
+     * @param i_nBytesOut number of bytes of the decompressed data.
+     * @param o_out will be set to the decompressed data.
+     * @return true if the stream is valid, false otherwise.
+     **/
+    static bool lzDecompress( std::size_t           i_nBytesIn,
+                              unsigned char const * i_in,
+                              std::size_t           i_nBytesOut,
+                              unsigned char       * o_out );
+
+    /**
+     * Encodes a message.
+     *
+     * @param i_nBytes number of bytes of the raw message.
+     * @param i_raw raw message.
+     * @param o_enc will be set to the encoded message, requires at least bound( i_nBytes ) bytes.
+     * @return number of bytes of the encoded message.
+     **/
+    std::size_t encode( std::size_t           i_nBytes,
+                        unsigned char const * i_raw,
+                        unsigned char       * o_enc );
+
+    /**
+     * Decodes a message.
+     *
+     * @param i_nBytesEnc number of bytes of the encoded message.
+     * @param i_enc encoded message.
+     * @param i_nBytes number of bytes of the raw message.
+     * @param o_raw will be set to the raw message.
+     **/
+    void decode( std::size_t           i_nBytesEnc,
+                 unsigned char const * i_enc,
+                 std::size_t           i_nBytes,
+                 unsigned char       * o_raw );
+
+    /**
+     * Gets the compression ratio (raw bytes over encoded bytes) of the encoded messages.
+     *
+     * @return compression ratio, 1 if no message was encoded.
+     **/
+    double ratio() const;
+
+    /**
+     * Logs the statistics of the encoded and decoded messages, accumulated over all ranks.
+     **/
+    void logStats() const;
+};
+
+#endif
@@ -0,0 +1,182 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Tests the compression of the messages.
+ **/
+#include <catch.hpp>
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include "Compression.h"
+
+TEST_CASE( "Compression: Shuffle of the bytes.", "[shuffle][Compression]" ) {
+  unsigned char l_raw[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+  unsigned char l_shuf[10];
+  unsigned char l_back[10];
+
+  // three values with three bytes, one trailing byte
+  edge::parallel::Compression::shuffle( 10, 3, l_raw, l_shuf );
+
+  unsigned char l_ref[10] = { 0, 3, 6, 1, 4, 7, 2, 5, 8, 9 };
+  for( unsigned short l_by = 0; l_by < 10; l_by++ )
+    REQUIRE( l_shuf[l_by] == l_ref[l_by] );
+
+  edge::parallel::Compression::unshuffle( 10, 3, l_shuf, l_back );
+  for( unsigned short l_by = 0; l_by < 10; l_by++ )
+    REQUIRE( l_back[l_by] == l_raw[l_by] );
+}
+
+TEST_CASE( "Compression: LZ-type compression.", "[lz][Compression]" ) {
+  // sizes which cover the special cases: empty, short literal-only and long sequences
+  std::size_t l_sizes[5] = { 0, 7, 13, 1000, 70000 };
+
+  for( unsigned short l_si = 0; l_si < 5; l_si++ ) {
+    std::size_t l_size = l_sizes[l_si];
+
+    // repetitive and pseudo-random data
+    std::vector< unsigned char > l_data[2];
+    l_data[0].resize( l_size );
+    l_data[1].resize( l_size );
+    unsigned int l_state = 17;
+    for( std::size_t l_by = 0; l_by < l_size; l_by++ ) {
+      l_data[0][l_by] = (unsigned char) ( (l_by / 300) % 7 );
+      l_state = l_state * 1103515245u + 12345u;
+      l_data[1][l_by] = (unsigned char) (l_state >> 24);
+    }
+
+    for( unsigned short l_da = 0; l_da < 2; l_da++ ) {
+      std::vector< unsigned char > l_comp( edge::parallel::Compression::bound( l_size ) );
+      std::vector< unsigned char > l_back( l_size+1 );
+
+      std::size_t l_nComp = edge::parallel::Compression::lzCompress( l_size,
+                                                                     l_data[l_da].data(),
+                                                                     l_comp.data() );
+      REQUIRE( l_nComp <= edge::parallel::Compression::bound( l_size ) - 1 );
+
+      // repetitive data compresses
+      if( l_da == 0 && l_size >= 1000 ) REQUIRE( l_nComp * 20 < l_size );
+
+      bool l_valid = edge::parallel::Compression::lzDecompress( l_nComp,
+                                                                l_comp.data(),
+                                                                l_size,
+                                                                l_back.data() );
+      REQUIRE( l_valid );
+      REQUIRE( std::memcmp( l_back.data(), l_data[l_da].data(), l_size ) == 0 );
+
+      // truncated streams are detected
+      if( l_nComp > 1 ) {
+        l_valid = edge::parallel::Compression::lzDecompress( l_nComp-1,
+                                                             l_comp.data(),
+                                                             l_size,
+                                                             l_back.data() );
+        REQUIRE( !l_valid );
+      }
+    }
+  }
+}
+
+TEST_CASE( "Compression: Rounding of the mantissas.", "[round][Compression]" ) {
+  float  l_valsS[5] = { 1.0f, -3.14159265f, 1.0e-20f, 2.718281828f, INFINITY };
+  double l_valsD[5] = { 1.0,  -3.14159265,  1.0e-200, 2.718281828,  INFINITY };
+
+  float  l_rndS[5];
+  double l_rndD[5];
+  std::memcpy( l_rndS, l_valsS, sizeof(l_valsS) );
+  std::memcpy( l_rndD, l_valsD, sizeof(l_valsD) );
+
+  edge::parallel::Compression::round( 5, 4, 10, (unsigned char *) l_rndS );
+  edge::parallel::Compression::round( 5, 8, 10, (unsigned char *) l_rndD );
+
+  for( unsigned short l_va = 0; l_va < 4; l_va++ ) {
+    REQUIRE( std::abs( l_rndS[l_va] - l_valsS[l_va] ) <= std::ldexp( 1.0f, -11 ) * std::abs( l_valsS[l_va] ) );
+    REQUIRE( std::abs( l_rndD[l_va] - l_valsD[l_va] ) <= std::ldexp( 1.0,  -11 ) * std::abs( l_valsD[l_va] ) );
+  }
+  REQUIRE( l_rndS[0] == 1.0f );
+  REQUIRE( std::isinf( l_rndS[4] ) );
+  REQUIRE( std::isinf( l_rndD[4] ) );
+
+  // the dropped bits are zero
+  std::uint32_t l_bits;
+  std::memcpy( &l_bits, l_rndS+1, 4 );
+  REQUIRE( (l_bits & ((1u << 13) - 1)) == 0 );
+
+  // no rounding to infinity
+  float l_max = 3.4028235e38f;
+  edge::parallel::Compression::round( 1, 4, 3, (unsigned char *) &l_max );
+  REQUIRE( std::isfinite( l_max ) );
+}
+
+TEST_CASE( "Compression: Encoding and decoding of messages.", "[encode][decode][Compression]" ) {
+  // smooth data
+  std::size_t l_nVals = 2000;
+  std::vector< float > l_vals( l_nVals );
+  for( std::size_t l_va = 0; l_va < l_nVals; l_va++ )
+    l_vals[l_va] = std::sin( 0.001f * l_va ) + 2;
+
+  std::size_t l_nBytes = l_nVals * sizeof(float);
+  std::vector< unsigned char > l_enc( edge::parallel::Compression::bound( l_nBytes ) );
+  std::vector< float > l_back( l_nVals );
+
+  // lossless
+  edge::parallel::Compression l_comp;
+  l_comp.config( "lossless", 4, 0 );
+  std::size_t l_nEnc = l_comp.encode( l_nBytes,
+                                      (unsigned char const *) l_vals.data(),
+                                      l_enc.data() );
+  REQUIRE( l_nEnc <= edge::parallel::Compression::bound( l_nBytes ) );
+  l_comp.decode( l_nEnc,
+                 l_enc.data(),
+                 l_nBytes,
+                 (unsigned char *) l_back.data() );
+  REQUIRE( std::memcmp( l_back.data(), l_vals.data(), l_nBytes ) == 0 );
+  REQUIRE( l_comp.ratio() > 1 );
+
+  // lossy
+  l_comp.config( "lossy", 4, 8 );
+  std::size_t l_nEncLossy = l_comp.encode( l_nBytes,
+                                           (unsigned char const *) l_vals.data(),
+                                           l_enc.data() );
+  REQUIRE( l_nEncLossy < l_nEnc );
+  l_comp.decode( l_nEncLossy,
+                 l_enc.data(),
+                 l_nBytes,
+                 (unsigned char *) l_back.data() );
+  for( std::size_t l_va = 0; l_va < l_nVals; l_va++ )
+    REQUIRE( std::abs( l_back[l_va] - l_vals[l_va] ) <= std::ldexp( 1.0f, -9 ) * l_vals[l_va] );
+
+  // incompressible data is sent raw
+  std::vector< unsigned char > l_rand( 512 );
+  unsigned int l_state = 3;
+  for( std::size_t l_by = 0; l_by < l_rand.size(); l_by++ ) {
+    l_state = l_state * 1103515245u + 12345u;
+    l_rand[l_by] = (unsigned char) (l_state >> 24);
+  }
+  l_comp.config( "lossless", 8, 0 );
+  l_nEnc = l_comp.encode( l_rand.size(),
+                          l_rand.data(),
+                          l_enc.data() );
+  REQUIRE( l_nEnc == l_rand.size()+1 );
+  std::vector< unsigned char > l_randBack( l_rand.size() );
+  l_comp.decode( l_nEnc,
+                 l_enc.data(),
+                 l_rand.size(),
+                 l_randBack.data() );
+  REQUIRE( l_randBack == l_rand );
+}
@@ -44,6 +44,12 @@ void edge::parallel::Distributed::recvCommBuffers2( unsigned short   i_tg,
   o_cbGeL = m_nRecvsSync[i_tg]%2;
 }
 
+std::size_t edge::parallel::Distributed::nIvs( std::size_t i_tgL,
+                                               std::size_t i_tgR ) const {
+  if( i_tgL <= i_tgR ) return 1;
+  return m_rates.empty() ? 2 : m_rates[i_tgR];
+}
+
 edge::parallel::Distributed::Distributed( int    i_argc,
                                           char * i_argv[] ) {
   // set default values for non-mpi runs
@@ -84,6 +90,8 @@ edge::parallel::Distributed::Distributed( int    i_argc,
 }
 
 void edge::parallel::Distributed::fin() {
+  if( m_comp.mode() != Compression::NONE ) m_comp.logStats();
+
 #ifdef PP_USE_MPI
   MPI_Barrier( MPI_COMM_WORLD );
   MPI_Finalize();
@@ -142,6 +150,13 @@ void edge::parallel::Distributed::init( unsigned short         i_nTgs,
   }
   m_nSeRe = (std::size_t *) io_dynMem.allocate( m_nChs * sizeof(std::size_t) );
 
+  // the double-buffered schemes alternate the buffers in rate-2 cycles
+  if( m_nCommBuffers == 2 && m_nChs > 0 ) {
+    for( std::size_t l_tg = 0; l_tg+1 < m_rates.size(); l_tg++ ) {
+      EDGE_CHECK_EQ( m_rates[l_tg], 2 ) << "double-buffered communication supports rate-2 LTS only";
+    }
+  }
+
   std::size_t l_sizeSend = 0;
   std::size_t l_sizeRecv = 0;
   for( std::size_t l_ch = 0; l_ch < m_nChs; l_ch++ ) {
@@ -150,8 +165,8 @@ void edge::parallel::Distributed::init( unsigned short         i_nTgs,
     std::size_t l_nSeRe = i_commStruct[1 + l_ch*4 + 3];
     m_nSeRe[l_ch] = l_nSeRe;
 
-    l_sizeSend += (l_tg > l_tgAd) ? 2 * l_nSeRe * i_nByFa : l_nSeRe * i_nByFa;
-    l_sizeRecv += (l_tg < l_tgAd) ? 2 * l_nSeRe * i_nByFa : l_nSeRe * i_nByFa;
+    l_sizeSend += nIvs( l_tg, l_tgAd ) * l_nSeRe * i_nByFa;
+    l_sizeRecv += nIvs( l_tgAd, l_tg ) * l_nSeRe * i_nByFa;
   }
 
   // allocate send and receive buffer
@@ -202,8 +217,8 @@ void edge::parallel::Distributed::init( unsigned short         i_nTgs,
     std::size_t l_tgAd  = i_commStruct[1 + l_ch*4 + 2];
     std::size_t l_nSeRe = i_commStruct[1 + l_ch*4 + 3];
 
-    l_sizeSend = (l_tg > l_tgAd) ? l_nSeRe * i_nByFa * 2 : l_nSeRe * i_nByFa;
-    l_sizeRecv = (l_tg < l_tgAd) ? l_nSeRe * i_nByFa * 2 : l_nSeRe * i_nByFa;
+    l_sizeSend = l_nSeRe * i_nByFa * nIvs( l_tg, l_tgAd );
+    l_sizeRecv = l_nSeRe * i_nByFa * nIvs( l_tgAd, l_tg );
 
     // assign
     m_sendMsgs[l_ch].tgL     = l_tg;
@@ -238,8 +253,8 @@ void edge::parallel::Distributed::init( unsigned short         i_nTgs,
         }
       }
 
-      l_offSend += (l_tg > l_tgAd) ? i_nByFa * 2 : i_nByFa;
-      l_offRecv += (l_tg < l_tgAd) ? i_nByFa * 2 : i_nByFa;
+      l_offSend += i_nByFa * nIvs( l_tg, l_tgAd );
+      l_offRecv += i_nByFa * nIvs( l_tgAd, l_tg );
     }
     l_first += l_nSeRe;
   }
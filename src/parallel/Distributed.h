@@ -25,7 +25,9 @@
 #define EDGE_PARALLEL_DISTRIBUTED_H
 
 #include <cstddef>
+#include <vector>
 #include "data/Dynamic.h"
+#include "Compression.h"
 
 namespace edge {
   namespace parallel {
@@ -108,6 +110,25 @@ class edge::parallel::Distributed {
     //! receive messages
     t_msg * m_recvMsgs = nullptr;
 
+    //! compression of the messages
+    Compression m_comp;
+
+    //! true if persistent requests are used for the messages
+    bool m_persistent = false;
+
+    //! integer LTS rates of the time groups w.r.t. the next larger ones, rate-2 if not set
+    std::vector< unsigned short > m_rates;
+
+    /**
+     * Gets the number of time intervals in the messages from the local to an adjacent time group.
+     *
+     * @param i_tgL local time group.
+     * @param i_tgR adjacent time group.
+     * @return number of time intervals, which is the LTS rate if the local time group is larger and 1 otherwise.
+     **/
+    std::size_t nIvs( std::size_t i_tgL,
+                      std::size_t i_tgR ) const;
+
     /**
      * Derives the local send buffer and remote receive buffers for double-buffered schemes based on the number of sends since the last sync.
      *
@@ -195,9 +216,40 @@ class edge::parallel::Distributed {
 
     /**
      * Finalizes MPI if initialized.
+     * Logs the statistics of the message compression, if enabled.
      **/
     void fin();
 
+    /**
+     * Configures the compression of the messages, which is applied by the MPI interface.
+     * Has to be called before the initialization of the communication structure.
+     *
+     * @param i_mode compression mode: none, lossless or lossy.
+     * @param i_nByVal number of bytes per value in the messages.
+     * @param i_nBitsMant number of mantissa bits, which are kept in lossy compression.
+     **/
+    void setCompression( std::string const & i_mode,
+                         unsigned short      i_nByVal,
+                         unsigned short      i_nBitsMant ) { m_comp.config( i_mode, i_nByVal, i_nBitsMant ); }
+
+    /**
+     * Enables or disables persistent requests of the messages, which are used by the MPI interface.
+     * Has to be called before the initialization of the communication structure.
+     *
+     * @param i_persistent true if persistent requests are used.
+     **/
+    void setPersistent( bool i_persistent ) { m_persistent = i_persistent; }
+
+    /**
+     * Sets the integer LTS rates of the time groups, which determine the sizes of the messages between different time groups.
+     * Has to be called before the initialization of the communication structure, rate-2 LTS is assumed otherwise.
+     *
+     * @param i_nTgs number of time groups.
+     * @param i_rates rates of the time groups w.r.t. the next larger ones, 1 for the largest group.
+     **/
+    void setRates( unsigned short         i_nTgs,
+                   unsigned short const * i_rates ) { m_rates.assign( i_rates, i_rates+i_nTgs ); }
+
     /**
      * Gets the maximum version of the support MPI standard as a string.
      *
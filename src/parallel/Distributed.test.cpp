@@ -284,4 +284,22 @@ TEST_CASE( "Tests the derivation of recv comm buffer ids for double-buffered sch
                            l_cbGeL );
   REQUIRE( l_cbLtL == 0 );
   REQUIRE( l_cbGeL == 0 );
-}
\ No newline at end of file
+}
+TEST_CASE( "Tests the number of time intervals in the messages for integer-rate LTS.", "[Distributed][nIvs]" ) {
+  edge::parallel::DistributedDummy l_dist( 0, nullptr );
+
+  // rate-2 LTS by default
+  REQUIRE( l_dist.nIvs( 0, 0 ) == 1 );
+  REQUIRE( l_dist.nIvs( 0, 1 ) == 1 );
+  REQUIRE( l_dist.nIvs( 1, 0 ) == 2 );
+
+  unsigned short l_rates[4] = { 3, 2, 4, 1 };
+  l_dist.setRates( 4, l_rates );
+
+  REQUIRE( l_dist.nIvs( 1, 1 ) == 1 );
+  REQUIRE( l_dist.nIvs( 0, 1 ) == 1 );
+  REQUIRE( l_dist.nIvs( 1, 0 ) == 3 );
+  REQUIRE( l_dist.nIvs( 2, 1 ) == 2 );
+  REQUIRE( l_dist.nIvs( 3, 2 ) == 4 );
+  REQUIRE( l_dist.nIvs( 2, 3 ) == 1 );
+}
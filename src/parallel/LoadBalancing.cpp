@@ -28,9 +28,10 @@
 
 #include "LoadBalancing.h"
 
-void edge::parallel::LoadBalancing::resolveSpEn( unsigned short i_id ) {
+void edge::parallel::LoadBalancing::resolveSpEn( unsigned short            i_id,
+                                                 std::vector< WrkPkgLb > & io_wrkPkgs ) {
   // work packages of the region
-  WrkPkgLb *l_wps = m_wrkRgns[i_id].wrkPkgs.data();
+  WrkPkgLb *l_wps = io_wrkPkgs.data();
 
   // iterate over the defined sparse types
   for( unsigned short l_ty = 0; l_ty < m_wrkRgns[i_id].firstSp.size(); l_ty++ ) {
@@ -38,7 +39,7 @@ void edge::parallel::LoadBalancing::resolveSpEn( unsigned short i_id ) {
     std::size_t l_sp = 0;
 
     // iterate over the work packages
-    for( unsigned short l_wp = 0; l_wp < m_wrkRgns[i_id].wrkPkgs.size(); l_wp++ ) { 
+    for( std::size_t l_wp = 0; l_wp < io_wrkPkgs.size(); l_wp++ ) { 
       // assign first sparse id
       l_wps[l_wp].firstSp[l_ty] = m_wrkRgns[i_id].firstSp[l_ty] + l_sp;
 
@@ -56,8 +57,31 @@ void edge::parallel::LoadBalancing::resolveSpEn( unsigned short i_id ) {
   }
 }
 
-void edge::parallel::LoadBalancing::init( unsigned int i_nWrks) {
+void edge::parallel::LoadBalancing::init( unsigned int i_nWrks,
+                                          std::size_t  i_chunkSize ) {
   m_nWrks = i_nWrks;
+  m_chunkSize = i_chunkSize;
+}
+
+void edge::parallel::LoadBalancing::chunkWrkRgn( unsigned short i_id ) {
+  std::size_t l_size = m_wrkRgns[i_id].size;
+
+  // empty regions get a single, empty chunk
+  std::size_t l_nChunks = (l_size + m_chunkSize - 1) / m_chunkSize;
+  l_nChunks = std::max( l_nChunks, std::size_t(1) );
+
+  std::vector< WrkPkgLb > & l_chs = m_wrkRgns[i_id].chunks;
+  l_chs.resize( l_nChunks );
+
+  for( std::size_t l_ch = 0; l_ch < l_nChunks; l_ch++ ) {
+    std::size_t l_off = std::min( l_size, l_ch * m_chunkSize );
+    l_chs[l_ch].first = m_wrkRgns[i_id].first + l_off;
+    l_chs[l_ch].size  = std::min( m_chunkSize, l_size - l_off );
+    l_chs[l_ch].firstSp.resize( m_wrkRgns[i_id].firstSp.size() );
+  }
+
+  // assign sparse first ids
+  resolveSpEn( i_id, l_chs );
 }
 
 void edge::parallel::LoadBalancing::balanceWrkRgn( unsigned short i_id ) {
@@ -150,7 +174,7 @@ void edge::parallel::LoadBalancing::balanceWrkRgn( unsigned short i_id ) {
                  m_wrkRgns[i_id].first+m_wrkRgns[i_id].size );
 
   // assign sparse first ids
-  resolveSpEn( i_id );
+  resolveSpEn( i_id, m_wrkRgns[i_id].wrkPkgs );
 }
 
 void edge::parallel::LoadBalancing::balance() {
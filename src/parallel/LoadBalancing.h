@@ -49,6 +49,9 @@ class edge::parallel::LoadBalancing {
     //! number of workers
     unsigned int m_nWrks;
 
+    //! number of entities in a chunk, 0 if the work regions are not chunked
+    std::size_t m_chunkSize;
+
     //! load balancing definition of a work package
     struct WrkPkgLb {
       //! timer for the work package
@@ -75,6 +78,9 @@ class edge::parallel::LoadBalancing {
       //! work packages of the region
       std::vector< WrkPkgLb > wrkPkgs;
 
+      //! fixed-size chunks of the region, claimed dynamically by the workers
+      std::vector< WrkPkgLb > chunks;
+
       //! first sparse entity id
       std::vector< std::size_t > firstSp;
 
@@ -98,8 +104,17 @@ class edge::parallel::LoadBalancing {
      * @brief Resolves the sparse entities, based on a computed balancing.
      * 
      * @param i_id work region for which the sparse entities are resolved.
+     * @param io_wrkPkgs contiguous work packages of the region, covering all entities; first sparse entities will be set.
      */
-    void resolveSpEn( unsigned short i_id );
+    void resolveSpEn( unsigned short            i_id,
+                      std::vector< WrkPkgLb > & io_wrkPkgs );
+
+    /**
+     * @brief Splits the work region with the given id into chunks.
+     *
+     * @param i_id id of the work region.
+     */
+    void chunkWrkRgn( unsigned short i_id );
 
     /**
      * @brief (Re-)Balances the work region with the given id into work packages.
@@ -125,14 +140,17 @@ class edge::parallel::LoadBalancing {
                    double i_maxImbalance=2.5E-2 ): m_zeroTime(     i_zeroTime     ),
                                                    m_maxImbalance( i_maxImbalance ),
                                                    m_nBalanced(0),
-                                                   m_nWrks(0){};
+                                                   m_nWrks(0),
+                                                   m_chunkSize(0){};
 
     /**
      * @brief Initializes the dynamic load balancing.
      * 
      * @param i_nWrks number of workers.
+     * @param i_chunkSize number of entities in a chunk, 0 disables the chunking of work regions.
      */
-    void init( unsigned int i_nWrks );
+    void init( unsigned int i_nWrks,
+               std::size_t  i_chunkSize = 0 );
 
     /**
      * @brief (Re-)Balances all work regions.
@@ -213,6 +231,46 @@ class edge::parallel::LoadBalancing {
 
       // perform initial balancing
       balanceWrkRgn( i_pos );
+
+      // split the region into chunks
+      if( m_chunkSize > 0 ) chunkWrkRgn( i_pos );
+    }
+
+    /**
+     * @brief Gets the number of chunks of the work region.
+     *
+     * @param i_wrkRgn id of the work region.
+     * @return number of chunks, at least one if chunking is enabled.
+     */
+    std::size_t nChunks( unsigned short i_wrkRgn ) const {
+      return m_wrkRgns[i_wrkRgn].chunks.size();
+    }
+
+    /**
+     * @brief Gets the given chunk of the specified region.
+     *
+     * @param i_wrkRgn id of the work region.
+     * @param i_chunk id of the chunk.
+     * @param o_first will be set to first entity of the chunk.
+     * @param o_size will be set to number of entities in the chunk.
+     * @param o_firstSp will be set to first sparse entities of the chunk (if any).
+     *
+     * @paramt TL_T_LID type of the local ids.
+     */
+    template< typename TL_T_LID >
+    void getChunk( unsigned short   i_wrkRgn,
+                   std::size_t      i_chunk,
+                   TL_T_LID       & o_first,
+                   TL_T_LID       & o_size,
+                   TL_T_LID       * o_firstSp ) const {
+      WrkPkgLb const & l_ch = m_wrkRgns[i_wrkRgn].chunks[i_chunk];
+
+      o_first = l_ch.first;
+      o_size  = l_ch.size;
+
+      for( unsigned short l_ty = 0; l_ty < l_ch.firstSp.size(); l_ty++ ) {
+        o_firstSp[l_ty] = l_ch.firstSp[l_ty];
+      }
     }
 
     /**
@@ -289,4 +289,75 @@ TEST_CASE( "Load balancing: sparse entities.", "[spEn][loadBalancing]" ) {
   REQUIRE( l_lb1.m_wrkRgns[0].wrkPkgs[0].firstSp[1] == 1 );
   REQUIRE( l_lb1.m_wrkRgns[0].wrkPkgs[1].firstSp[1] == 2 );
   REQUIRE( l_lb1.m_wrkRgns[0].wrkPkgs[2].firstSp[1] == 5 );
-}
\ No newline at end of file
+}
+TEST_CASE( "Load balancing: chunks with sparse entities.", "[chunks][loadBalancing]" ) {
+  // our sparse types
+  struct {
+    int spType;
+  } l_chars[100];
+
+  for( unsigned short l_en = 0; l_en < 100; l_en++ ) l_chars[l_en].spType = 0;
+
+  l_chars[ 4].spType = 7;
+  l_chars[ 9].spType = 7;
+  l_chars[13].spType = 7;
+  l_chars[24].spType = 7;
+  l_chars[29].spType = 7;
+  l_chars[38].spType = 7;
+  l_chars[41].spType = 7;
+  l_chars[61].spType = 7;
+  l_chars[77].spType = 7;
+  l_chars[93].spType = 7;
+
+  l_chars[ 8].spType = 8;
+  l_chars[21].spType = 8;
+  l_chars[59].spType = 8;
+  l_chars[60].spType = 8;
+  l_chars[62].spType = 8;
+  l_chars[81].spType = 8;
+  l_chars[94].spType = 8;
+
+  // init the load balancing with 3 workers and chunks of 20 entities
+  edge::parallel::LoadBalancing l_lb1;
+  l_lb1.init( 3, 20 );
+
+  int l_spTypes[2] = {7,8};
+
+  // register a work region and an empty one
+  l_lb1.regWrkRgn( 0,
+                   15,
+                   75,
+                   2,
+                   l_spTypes,
+                   l_chars );
+
+  l_lb1.regWrkRgn( 1,
+                   301,
+                   0 );
+
+  // per-worker packages are unaffected
+  REQUIRE( l_lb1.m_wrkRgns[0].wrkPkgs[1].firstSp[0] == 6 );
+
+  // last chunk holds the remainder
+  REQUIRE( l_lb1.nChunks( 0 ) == 4 );
+
+  std::size_t l_first, l_size, l_firstSp[2];
+  std::size_t l_firstRef[4] = { 15, 35, 55, 75 };
+  std::size_t l_sizeRef[4] = { 20, 20, 20, 15 };
+  std::size_t l_firstSpRef[4][2] = { {3, 1}, {5, 2}, {7, 2}, {8, 5} };
+
+  for( unsigned short l_ch = 0; l_ch < 4; l_ch++ ) {
+    l_lb1.getChunk( 0, l_ch, l_first, l_size, l_firstSp );
+
+    REQUIRE( l_first      == l_firstRef[l_ch] );
+    REQUIRE( l_size       == l_sizeRef[l_ch] );
+    REQUIRE( l_firstSp[0] == l_firstSpRef[l_ch][0] );
+    REQUIRE( l_firstSp[1] == l_firstSpRef[l_ch][1] );
+  }
+
+  // empty regions have a single, empty chunk
+  REQUIRE( l_lb1.nChunks( 1 ) == 1 );
+  l_lb1.getChunk( 1, 0, l_first, l_size, l_firstSp );
+  REQUIRE( l_first == 301 );
+  REQUIRE( l_size  ==   0 );
+}
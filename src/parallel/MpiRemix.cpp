@@ -56,9 +56,14 @@ void edge::parallel::MpiRemix::init( unsigned short         i_nTgs,
   m_sendTests = (int*) io_dynMem.allocate( l_testSize );
   m_recvTests = (int*) io_dynMem.allocate( l_testSize );
 
-  std::size_t l_reqSize = m_nChs * sizeof( MPI_Request );
+  // send and receive requests are contiguous to test them at once
+  std::size_t l_reqSize = 2 * m_nChs * sizeof( MPI_Request );
   m_sendReqs = (MPI_Request*) io_dynMem.allocate( l_reqSize );
-  m_recvReqs = (MPI_Request*) io_dynMem.allocate( l_reqSize );
+  m_recvReqs = m_sendReqs + m_nChs;
+  m_startReqs = (MPI_Request*) io_dynMem.allocate( l_reqSize );
+
+  m_idsDone = (int*) io_dynMem.allocate( 2 * m_nChs * sizeof( int ) );
+  m_statsDone = (MPI_Status*) io_dynMem.allocate( 2 * m_nChs * sizeof( MPI_Status ) );
 
   for( std::size_t l_ch = 0; l_ch < m_nChs; l_ch++ ) {
     m_sendTests[l_ch] = 0;
@@ -67,10 +72,94 @@ void edge::parallel::MpiRemix::init( unsigned short         i_nTgs,
     m_recvTests[l_ch] = 0;
     m_recvReqs[l_ch]  = MPI_REQUEST_NULL;
   }
+
+  // buffers of the encoded messages
+  if( m_comp.mode() != Compression::NONE ) {
+    std::size_t l_offSize = (m_nChs+1) * sizeof( std::size_t );
+    m_sendOffsEnc = (std::size_t*) io_dynMem.allocate( l_offSize );
+    m_recvOffsEnc = (std::size_t*) io_dynMem.allocate( l_offSize );
+
+    m_sendOffsEnc[0] = 0;
+    m_recvOffsEnc[0] = 0;
+    for( std::size_t l_ch = 0; l_ch < m_nChs; l_ch++ ) {
+      m_sendOffsEnc[l_ch+1] = m_sendOffsEnc[l_ch] + Compression::bound( m_sendMsgs[l_ch].size );
+      m_recvOffsEnc[l_ch+1] = m_recvOffsEnc[l_ch] + Compression::bound( m_recvMsgs[l_ch].size );
+    }
+
+    m_sendBuffersEnc = (unsigned char*) io_dynMem.allocate( m_sendOffsEnc[m_nChs] );
+    m_recvBuffersEnc = (unsigned char*) io_dynMem.allocate( m_recvOffsEnc[m_nChs] );
+  }
+
+  // persistent requests
+  if( m_persistent ) {
+    EDGE_CHECK( m_comp.mode() == Compression::NONE ) << "persistent requests require uncompressed messages";
+
+    for( std::size_t l_ch = 0; l_ch < m_nChs; l_ch++ ) {
+      int l_err = MPI_Send_init( m_sendBuffers + m_sendMsgs[l_ch].offL,
+                                 m_sendMsgs[l_ch].size,
+                                 MPI_BYTE,
+                                 m_sendMsgs[l_ch].rank,
+                                 m_sendMsgs[l_ch].tag,
+                                 MPI_COMM_WORLD,
+                                 &m_sendReqs[l_ch] );
+      EDGE_CHECK_EQ( l_err, MPI_SUCCESS );
+
+      l_err = MPI_Recv_init( m_recvBuffers + m_recvMsgs[l_ch].offL,
+                             m_recvMsgs[l_ch].size,
+                             MPI_BYTE,
+                             m_recvMsgs[l_ch].rank,
+                             m_recvMsgs[l_ch].tag,
+                             MPI_COMM_WORLD,
+                             &m_recvReqs[l_ch] );
+      EDGE_CHECK_EQ( l_err, MPI_SUCCESS );
+    }
+  }
+}
+
+void edge::parallel::MpiRemix::freeReqs() {
+  if( !m_persistent || m_sendReqs == nullptr ) return;
+
+  int l_fin = 0;
+  MPI_Finalized( &l_fin );
+  if( l_fin ) return;
+
+  for( std::size_t l_re = 0; l_re < 2*m_nChs; l_re++ ) {
+    if( m_sendReqs[l_re] != MPI_REQUEST_NULL ) {
+      int l_err = MPI_Request_free( &m_sendReqs[l_re] );
+      EDGE_CHECK_EQ( l_err, MPI_SUCCESS );
+    }
+  }
+}
+
+edge::parallel::MpiRemix::~MpiRemix() {
+  freeReqs();
+}
+
+void edge::parallel::MpiRemix::fin() {
+  freeReqs();
+  Distributed::fin();
 }
 
 void edge::parallel::MpiRemix::beginSends( bool           i_lt,
                                            unsigned short i_tg ) {
+  // persistent requests: start all matching sends at once
+  if( m_persistent ) {
+    int l_nStart = 0;
+    for( std::size_t l_ch = 0; l_ch < m_nChs; l_ch++ ) {
+      if( checkSendTgLt( l_ch, i_lt, i_tg ) ) {
+        m_startReqs[l_nStart] = m_sendReqs[l_ch];
+        m_sendTests[l_ch] = 0;
+        l_nStart++;
+      }
+    }
+
+    if( l_nStart > 0 ) {
+      int l_err = MPI_Startall( l_nStart, m_startReqs );
+      EDGE_CHECK_EQ( l_err, MPI_SUCCESS );
+    }
+    return;
+  }
+
   for( std::size_t l_ch = 0; l_ch < m_nChs; l_ch++ ) {
     // only send if the message's time group matches
     bool l_match = checkSendTgLt( l_ch,
@@ -79,8 +168,20 @@ void edge::parallel::MpiRemix::beginSends( bool           i_lt,
 
     // get the message on the way
     if( l_match ) {
-      int l_err = MPI_Isend( m_sendBuffers + m_sendMsgs[l_ch].offL,
-                             m_sendMsgs[l_ch].size,
+      unsigned char * l_buff = m_sendBuffers + m_sendMsgs[l_ch].offL;
+      std::size_t     l_size = m_sendMsgs[l_ch].size;
+
+      // encode the message
+      if( m_sendBuffersEnc != nullptr ) {
+        unsigned char * l_buffEnc = m_sendBuffersEnc + m_sendOffsEnc[l_ch];
+        l_size = m_comp.encode( l_size,
+                                l_buff,
+                                l_buffEnc );
+        l_buff = l_buffEnc;
+      }
+
+      int l_err = MPI_Isend( l_buff,
+                             l_size,
                              MPI_BYTE,
                              m_sendMsgs[l_ch].rank,
                              m_sendMsgs[l_ch].tag,
@@ -94,6 +195,24 @@ void edge::parallel::MpiRemix::beginSends( bool           i_lt,
 
 void edge::parallel::MpiRemix::beginRecvs( bool           i_lt,
                                            unsigned short i_tg ) {
+  // persistent requests: start all matching receives at once
+  if( m_persistent ) {
+    int l_nStart = 0;
+    for( std::size_t l_ch = 0; l_ch < m_nChs; l_ch++ ) {
+      if( checkRecvTgLt( l_ch, i_lt, i_tg ) ) {
+        m_startReqs[l_nStart] = m_recvReqs[l_ch];
+        m_recvTests[l_ch] = 0;
+        l_nStart++;
+      }
+    }
+
+    if( l_nStart > 0 ) {
+      int l_err = MPI_Startall( l_nStart, m_startReqs );
+      EDGE_CHECK_EQ( l_err, MPI_SUCCESS );
+    }
+    return;
+  }
+
   for( std::size_t l_ch = 0; l_ch < m_nChs; l_ch++ ) {
     bool l_match = checkRecvTgLt( l_ch,
                                   i_lt,
@@ -101,8 +220,17 @@ void edge::parallel::MpiRemix::beginRecvs( bool           i_lt,
 
     // get the message on the way
     if( l_match ) {
-      int l_err = MPI_Irecv( m_recvBuffers + m_recvMsgs[l_ch].offL,
-                             m_recvMsgs[l_ch].size,
+      unsigned char * l_buff = m_recvBuffers + m_recvMsgs[l_ch].offL;
+      std::size_t     l_size = m_recvMsgs[l_ch].size;
+
+      // receive the encoded message
+      if( m_recvBuffersEnc != nullptr ) {
+        l_buff = m_recvBuffersEnc + m_recvOffsEnc[l_ch];
+        l_size = m_recvOffsEnc[l_ch+1] - m_recvOffsEnc[l_ch];
+      }
+
+      int l_err = MPI_Irecv( l_buff,
+                             l_size,
                              MPI_BYTE,
                              m_recvMsgs[l_ch].rank,
                              m_recvMsgs[l_ch].tag,
@@ -116,39 +244,46 @@ void edge::parallel::MpiRemix::beginRecvs( bool           i_lt,
 
 void edge::parallel::MpiRemix::comm() {
   for( std::size_t l_it = 0; l_it < m_nIterComm; l_it++ ) {
-    std::size_t l_nFinSend = 0;
-    std::size_t l_nFinRecv = 0;
+    // test the active send and receive requests
+    int l_nDone = 0;
+    int l_err = MPI_Testsome( 2*m_nChs,
+                              m_sendReqs,
+                              &l_nDone,
+                              m_idsDone,
+                              m_statsDone );
+    EDGE_CHECK_EQ( l_err, MPI_SUCCESS );
 
-    for( std::size_t l_ch = 0; l_ch < m_nChs; l_ch++ ) {
-      // test on send
-      int l_test = -1;
-      int l_err = MPI_Test( &m_sendReqs[l_ch],
-                            &l_test,
-                            MPI_STATUS_IGNORE );
-      EDGE_CHECK_EQ( l_err, MPI_SUCCESS );
-      EDGE_CHECK_NE( l_test, -1 );
-      if( l_test == 1 ) {
-        l_nFinSend++;
-        m_sendReqs[l_ch] = MPI_REQUEST_NULL;
-        m_sendTests[l_ch] = l_test;
+    // abort early if everything is finished already
+    if( l_nDone == MPI_UNDEFINED ) break;
+
+    for( int l_do = 0; l_do < l_nDone; l_do++ ) {
+      std::size_t l_re = m_idsDone[l_do];
+
+      // send
+      if( l_re < m_nChs ) {
+        m_sendTests[l_re] = 1;
       }
+      // receive
+      else {
+        std::size_t l_ch = l_re - m_nChs;
 
-      // test on receive
-      l_test = -1;
-      l_err = MPI_Test( &m_recvReqs[l_ch],
-                        &l_test,
-                        MPI_STATUS_IGNORE );
-      EDGE_CHECK_EQ( l_err, MPI_SUCCESS );
-      EDGE_CHECK_NE( l_test, -1 );
-      if( l_test == 1 ) {
-        l_nFinRecv++;
-        m_recvReqs[l_ch] = MPI_REQUEST_NULL;
-        m_recvTests[l_ch] = l_test;
+        // decode the message, before the receive is reported as finished
+        if( m_recvBuffersEnc != nullptr ) {
+          int l_nBytesEnc = 0;
+          l_err = MPI_Get_count( &m_statsDone[l_do],
+                                 MPI_BYTE,
+                                 &l_nBytesEnc );
+          EDGE_CHECK_EQ( l_err, MPI_SUCCESS );
+
+          m_comp.decode( l_nBytesEnc,
+                         m_recvBuffersEnc + m_recvOffsEnc[l_ch],
+                         m_recvMsgs[l_ch].size,
+                         m_recvBuffers + m_recvMsgs[l_ch].offL );
+        }
+
+        m_recvTests[l_ch] = 1;
       }
     }
-
-    // abort early if everything is finished already
-    if( l_nFinSend == m_nChs && l_nFinRecv == m_nChs ) break;
   }
 }
 
@@ -47,15 +47,41 @@ class edge::parallel::MpiRemix: public Distributed {
     //! receive test flags
     volatile int *m_recvTests = nullptr;
 
-    //! send requests
+    //! send requests, followed by the receive requests
     MPI_Request *m_sendReqs = nullptr;
 
     //! receive requests
     MPI_Request *m_recvReqs = nullptr;
 
+    //! persistent requests, which are started at once
+    MPI_Request *m_startReqs = nullptr;
+
+    //! ids of the requests, which completed in a test
+    int *m_idsDone = nullptr;
+
+    //! status of the requests, which completed in a test
+    MPI_Status *m_statsDone = nullptr;
+
     //! number of iterations used in the message progression
     std::size_t m_nIterComm = 0;
 
+    //! encoded send messages, nullptr if the messages are not compressed
+    unsigned char *m_sendBuffersEnc = nullptr;
+
+    //! encoded receive messages, nullptr if the messages are not compressed
+    unsigned char *m_recvBuffersEnc = nullptr;
+
+    //! offsets of the channels' encoded send messages
+    std::size_t *m_sendOffsEnc = nullptr;
+
+    //! offsets of the channels' encoded receive messages
+    std::size_t *m_recvOffsEnc = nullptr;
+
+    /**
+     * Frees the persistent requests, if MPI is not finalized.
+     **/
+    void freeReqs();
+
   public:
     /**
      * Constructor.
@@ -64,6 +90,16 @@ class edge::parallel::MpiRemix: public Distributed {
               char * i_argv[] ): Distributed( i_argc,
                                               i_argv ){};
 
+    /**
+     * Destructor.
+     **/
+    ~MpiRemix();
+
+    /**
+     * Frees the persistent requests and finalizes MPI.
+     **/
+    void fin();
+
     /**
      * Initializes the MPI communication structure.
      *
@@ -93,6 +129,8 @@ class edge::parallel::MpiRemix: public Distributed {
 
     /**
      * Calls MPI to initiate the sends for the given time group.
+     * The messages are encoded before the sends, if compression is enabled.
+     * Persistent requests of the time group are started at once.
      *
      * @param i_lt if true sends are also issued for less-than LTS relations.
      * @param i_tg time group for which data is send.
@@ -111,6 +149,8 @@ class edge::parallel::MpiRemix: public Distributed {
 
     /**
      * Progresses MPI communication.
+     * Only the active requests are tested.
+     * Finished receives are decoded, if compression is enabled.
      **/
     void comm();
 
@@ -0,0 +1,107 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Tests the MPI interface, run with one or multiple ranks.
+ **/
+#include <catch.hpp>
+#include <cmath>
+#include <vector>
+#define protected public
+#include "MpiRemix.h"
+#undef protected
+#include "global.h"
+
+/**
+ * Exchanges the data of the faces with an adjacent rank and checks the received data.
+ *
+ * @param i_comp compression mode.
+ * @param i_nBitsMant number of mantissa bits in lossy compression.
+ * @param i_tol relative tolerance of the received data.
+ * @param i_persistent true if persistent requests are used.
+ **/
+static void mpiRemixExchange( std::string i_comp,
+                              unsigned short i_nBitsMant,
+                              float i_tol,
+                              bool i_persistent = false ) {
+  edge::data::Dynamic l_dynMem;
+  edge::parallel::MpiRemix l_mpi( 0, nullptr );
+
+  // pairs of ranks exchange data, an odd rank at the end communicates with itself
+  int l_rankAd = edge::parallel::g_rank ^ 1;
+  if( l_rankAd >= edge::parallel::g_nRanks ) l_rankAd = edge::parallel::g_rank;
+
+  // single channel in time group 0: face 0 of every element is sent, face 1 receives
+  std::size_t const l_nEls = 64;
+  std::size_t const l_nVals = 40;
+  std::size_t l_commStruct[5] = { 1, 0, std::size_t(l_rankAd), 0, l_nEls };
+
+  std::vector< unsigned short > l_sendFa( l_nEls, 0 );
+  std::vector< unsigned short > l_recvFa( l_nEls, 1 );
+  std::vector< std::size_t > l_els( l_nEls );
+  for( std::size_t l_el = 0; l_el < l_nEls; l_el++ ) l_els[l_el] = l_el;
+
+  l_mpi.setCompression( i_comp, sizeof(float), i_nBitsMant );
+  l_mpi.setPersistent( i_persistent );
+  l_mpi.init( 1,
+              2,
+              l_nEls,
+              l_nVals * sizeof(float),
+              l_commStruct,
+              l_sendFa.data(),
+              l_els.data(),
+              l_recvFa.data(),
+              l_els.data(),
+              l_dynMem );
+
+  // multiple rounds restart the requests
+  for( unsigned short l_ro = 0; l_ro < 3; l_ro++ ) {
+    // smooth, rank- and round-dependent data
+    for( std::size_t l_el = 0; l_el < l_nEls; l_el++ ) {
+      float * l_send = (float *) l_mpi.getSendPtrs()[0][l_el*2 + 0];
+      for( std::size_t l_va = 0; l_va < l_nVals; l_va++ )
+        l_send[l_va] = edge::parallel::g_rank + 1 + l_ro + std::sin( 0.01f * (l_el*l_nVals + l_va) );
+    }
+
+    l_mpi.beginRecvs( true, 0 );
+    l_mpi.beginSends( true, 0 );
+    while( !l_mpi.finRecvs( true, 0 ) || !l_mpi.finSends( true, 0 ) ) l_mpi.comm();
+
+    for( std::size_t l_el = 0; l_el < l_nEls; l_el++ ) {
+      float const * l_recv = (float const *) l_mpi.getRecvPtrs()[0][l_el*2 + 1];
+      for( std::size_t l_va = 0; l_va < l_nVals; l_va++ ) {
+        float l_ref = l_rankAd + 1 + l_ro + std::sin( 0.01f * (l_el*l_nVals + l_va) );
+        REQUIRE( std::abs( l_recv[l_va] - l_ref ) <= i_tol * l_ref );
+      }
+    }
+  }
+
+  // encoded messages are smaller than the raw ones
+  if( i_comp != "none" ) REQUIRE( l_mpi.m_comp.ratio() > 1 );
+}
+
+TEST_CASE( "MpiRemix: Exchange of face data.", "[MpiRemix]" ) {
+  mpiRemixExchange( "none",     0, 0 );
+  mpiRemixExchange( "lossless", 0, 0 );
+  mpiRemixExchange( "lossy",    8, std::ldexp( 1.0f, -9 ) );
+}
+
+TEST_CASE( "MpiRemix: Exchange of face data with persistent requests.", "[MpiRemix]" ) {
+  mpiRemixExchange( "none", 0, 0, true );
+}
@@ -0,0 +1,201 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Benchmark of the work distribution in the shared memory parallelization.
+ **/
+#include "monitor/Bench.hpp"
+#include "Shared.h"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <vector>
+
+namespace edge {
+  namespace parallel {
+    namespace bench {
+      /**
+       * Performs synthetic work of the given cost.
+       *
+       * @param i_cost cost of the work.
+       * @param i_seed seed of the work.
+       * @return result of the work.
+       **/
+      double work( unsigned int i_cost,
+                   double       i_seed );
+
+      /**
+       * Measures the makespan of steps, every step processes all entities of the work regions.
+       * The cost of the entities is uneven: clustered, expensive entities mimic receivers, point sources or LTS-interfaces.
+       *
+       * @param i_mode work distribution: static, measured (rebalanced after every step), tasks or chunks.
+       * @param i_chunkSize size of the chunks if chunked.
+       * @param i_nSteps number of steps.
+       * @param io_recs record of the results will be appended.
+       **/
+      void makespan( std::string                           const & i_mode,
+                     std::size_t                                   i_chunkSize,
+                     unsigned int                                  i_nSteps,
+                     std::vector< monitor::Bench::Record >       & io_recs );
+
+      /**
+       * Compares the makespan of the work distributions.
+       *
+       * @param io_recs records of the results will be appended.
+       **/
+      void makespan( std::vector< monitor::Bench::Record > & io_recs );
+    }
+  }
+}
+
+double edge::parallel::bench::work( unsigned int i_cost,
+                                    double       i_seed ) {
+  double l_val = i_seed;
+  for( unsigned int l_it = 0; l_it < i_cost * 32; l_it++ ) {
+    l_val = 0.5 * l_val + 1.0 / ( 1.0 + l_val );
+  }
+  return l_val;
+}
+
+void edge::parallel::bench::makespan( std::string                     const & i_mode,
+                                      std::size_t                             i_chunkSize,
+                                      unsigned int                            i_nSteps,
+                                      std::vector< monitor::Bench::Record >   & io_recs ) {
+  // two time groups with inner and send regions
+  std::size_t l_nRgns = 4;
+  std::size_t l_nEnsRgn[4] = { 1 << 15, 1 << 12, 1 << 14, 1 << 11 };
+  std::size_t l_nEns = 0;
+  for( std::size_t l_rg = 0; l_rg < l_nRgns; l_rg++ ) l_nEns += l_nEnsRgn[l_rg];
+
+  // uneven cost: 3% of the entities are clustered and 16 times more expensive
+  std::vector< unsigned int > l_cost( l_nEns, 1 );
+  for( std::size_t l_en = 0; l_en < l_nEns; l_en++ ) {
+    if( (l_en / 256) % 32 == 5 ) l_cost[l_en] = 16;
+  }
+  std::vector< double > l_res( l_nEns, 0 );
+
+  Shared l_shared;
+  l_shared.init();
+  if(      i_mode == "tasks"  ) l_shared.enableTasks();
+  else if( i_mode == "chunks" ) l_shared.enableChunks( i_chunkSize );
+
+  std::size_t l_first = 0;
+  for( std::size_t l_rg = 0; l_rg < l_nRgns; l_rg++ ) {
+    l_shared.regWrkRgn( l_rg / 2, 0, l_rg, l_first, l_nEnsRgn[l_rg], l_nRgns-l_rg );
+    l_first += l_nEnsRgn[l_rg];
+  }
+
+  // time of every step
+  std::vector< double > l_times;
+  std::chrono::steady_clock::time_point l_start;
+
+  l_shared.resetStatus( Shared::WAI );
+
+#ifdef PP_USE_OMP
+#pragma omp parallel
+#endif
+  {
+    for( unsigned int l_st = 0; l_st < i_nSteps; l_st++ ) {
+#ifdef PP_USE_OMP
+#pragma omp master
+#endif
+      {
+        l_start = std::chrono::steady_clock::now();
+        for( std::size_t l_rg = 0; l_rg < l_nRgns; l_rg++ ) l_shared.setStatusAll( Shared::RDY, l_rg );
+      }
+#ifdef PP_USE_OMP
+#pragma omp barrier
+#endif
+
+      bool l_fin = false;
+      while( !l_fin ) {
+        unsigned short l_tg, l_step;
+        unsigned int l_id;
+        int_el l_firstEn, l_size;
+        int_el l_enSp[1];
+
+        if( l_shared.isWrk() && l_shared.getWrkTd( l_tg, l_step, l_id, l_firstEn, l_size, l_enSp ) ) {
+          l_shared.setStatusTd( Shared::IPR, l_id );
+          for( int_el l_en = l_firstEn; l_en < l_firstEn+l_size; l_en++ ) l_res[l_en] = work( l_cost[l_en], l_res[l_en] );
+          l_shared.setStatusTd( Shared::FIN, l_id );
+        }
+
+        l_fin = true;
+        for( std::size_t l_rg = 0; l_rg < l_nRgns; l_rg++ ) l_fin = l_fin && l_shared.getStatusAll( Shared::FIN, l_rg );
+      }
+
+#ifdef PP_USE_OMP
+#pragma omp barrier
+#pragma omp master
+#endif
+      {
+        std::chrono::duration< double > l_dur = std::chrono::steady_clock::now() - l_start;
+        l_times.push_back( l_dur.count() );
+
+        // rebalance based on the measured times
+        if( i_mode == "measured" ) l_shared.balance();
+      }
+#ifdef PP_USE_OMP
+#pragma omp barrier
+#endif
+    }
+  }
+
+  // ignore the first step (warm-up, initial measurements)
+  double l_min = std::numeric_limits< double >::max();
+  double l_max = 0;
+  double l_ave = 0;
+  for( std::size_t l_st = 1; l_st < l_times.size(); l_st++ ) {
+    l_min = std::min( l_min, l_times[l_st] );
+    l_max = std::max( l_max, l_times[l_st] );
+    l_ave += l_times[l_st];
+  }
+  l_ave /= std::max( l_times.size(), std::size_t(2) ) - 1;
+
+  // prevent the compiler from removing the work
+  double l_chk = 0;
+  for( std::size_t l_en = 0; l_en < l_nEns; l_en++ ) l_chk += l_res[l_en];
+
+  monitor::Bench::Record l_rec;
+  l_rec.add( "mode", i_mode )
+       .add( "chunk_size", (double) i_chunkSize )
+       .add( "n_threads", (double) g_nThreads )
+       .add( "n_entities", (double) l_nEns )
+       .add( "n_steps", (double) i_nSteps )
+       .add( "makespan_min", l_min )
+       .add( "makespan_ave", l_ave )
+       .add( "makespan_max", l_max )
+       .add( "checksum", l_chk );
+  io_recs.push_back( l_rec );
+}
+
+void edge::parallel::bench::makespan( std::vector< monitor::Bench::Record > & io_recs ) {
+  unsigned int l_nSteps = 20;
+
+  makespan( "static",   0, l_nSteps, io_recs );
+  makespan( "measured", 0, l_nSteps, io_recs );
+  makespan( "tasks",    0, l_nSteps, io_recs );
+
+  std::size_t l_chunkSizes[4] = { 64, 256, 1024, 4096 };
+  for( unsigned short l_cs = 0; l_cs < 4; l_cs++ ) {
+    makespan( "chunks", l_chunkSizes[l_cs], l_nSteps, io_recs );
+  }
+}
+
+EDGE_BENCH( "parallel/shared/makespan", edge::parallel::bench::makespan )
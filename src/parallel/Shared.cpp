@@ -92,6 +92,15 @@ void edge::parallel::Shared::print() {
   EDGE_LOG_INFO << "  #workers: " << m_nWrks;
 }
 
+void edge::parallel::Shared::enableChunks( std::size_t i_chunkSize ) {
+  EDGE_CHECK_GT( i_chunkSize, 0 );
+  EDGE_CHECK_EQ( m_wrkRgns.size(), 0 );
+
+  m_tasks = true;
+  m_chunkSize = i_chunkSize;
+  m_balancing.init( m_nWrks, m_chunkSize );
+}
+
 bool edge::parallel::Shared::isCommLead() {
   if( m_nWrks == g_nThreads ) return g_thread==0;
   else                        return g_thread==m_nWrks;
@@ -141,6 +150,49 @@ bool edge::parallel::Shared::getWrkTd( unsigned short & o_tg,
   o_first     = std::numeric_limits< int_el       >::max();
   o_size      = std::numeric_limits< int_el       >::max();
 
+  // claim the next chunk of the released regions with the highest priority
+  if( m_chunkSize > 0 ) {
+    for( std::size_t l_rg = 0; l_rg < m_wrkRgns.size(); l_rg++ ) {
+      std::size_t l_nChs = m_balancing.nChunks( l_rg );
+      if( m_wrkCnts[l_rg].nextChunk.load( std::memory_order_relaxed ) >= l_nChs ) continue;
+
+      std::size_t l_ch = m_wrkCnts[l_rg].nextChunk.fetch_add( 1, std::memory_order_acq_rel );
+      if( l_ch >= l_nChs ) continue;
+
+      o_tg    = m_wrkRgns[l_rg].tg;
+      o_step  = m_wrkRgns[l_rg].step;
+      o_id    = m_wrkRgns[l_rg].id;
+
+      m_balancing.getChunk( l_rg,
+                            l_ch,
+                            o_first,
+                            o_size,
+                            o_firstSp );
+
+      return true;
+    }
+
+    return false;
+  }
+
+  // take work from the task queues
+  if( m_tasks ) {
+    unsigned int l_rg, l_pkg;
+    if( !m_stealing.get( g_thread, l_rg, l_pkg ) ) return false;
+
+    o_tg    = m_wrkRgns[l_rg].tg;
+    o_step  = m_wrkRgns[l_rg].step;
+    o_id    = m_wrkRgns[l_rg].id;
+
+    m_balancing.getWrkTd( l_rg,
+                          l_pkg,
+                          o_first,
+                          o_size,
+                          o_firstSp );
+
+    return true;
+  }
+
   // iterate over work region
   for( std::size_t l_rg = 0; l_rg < m_wrkRgns.size(); l_rg++ ) {
     volatile WrkPkg* l_wps = m_wrkRgns[l_rg].wrkPkgs.data();
@@ -178,8 +230,21 @@ void edge::parallel::Shared::setStatusAll( t_status     i_status,
 
   std::size_t l_rg = getWrkRgn( i_id );
 
+  // open all chunks of the region, the counter of the next chunk publishes the region to the workers
+  if( m_chunkSize > 0 ) {
+    EDGE_CHECK( i_status == RDY ) << "status change not allowed";
+    EDGE_CHECK_GE( m_wrkCnts[l_rg].nextChunk.load( std::memory_order_acquire ), m_balancing.nChunks( l_rg ) );
+
+    m_wrkCnts[l_rg].nOpen.store( m_balancing.nChunks( l_rg ), std::memory_order_relaxed );
+    m_wrkCnts[l_rg].nextChunk.store( 0, std::memory_order_release );
+    return;
+  }
+
   volatile WrkPkg* l_wps = m_wrkRgns[l_rg].wrkPkgs.data();
 
+  // all work packages of the region are open again
+  if( m_tasks ) m_wrkCnts[l_rg].nOpen.store( m_nWrks, std::memory_order_relaxed );
+
   // iterate over all workers and set status
   for( int l_td = 0; l_td < m_nWrks; l_td++ ) {
     if( i_status == RDY ) {
@@ -192,6 +257,13 @@ void edge::parallel::Shared::setStatusAll( t_status     i_status,
     // set status
     l_wps[l_td].status = i_status;
   }
+
+  // release the work packages to the queues of their owners
+  if( m_tasks ) {
+    for( int l_td = 0; l_td < m_nWrks; l_td++ ) {
+      m_stealing.push( l_td, l_rg, l_td );
+    }
+  }
 }
 
 void edge::parallel::Shared::resetStatus( t_status i_status ) {
@@ -209,10 +281,21 @@ void edge::parallel::Shared::resetStatus( t_status i_status ) {
       // set status
       l_wps[l_td].status = i_status;
     }
+
+    // only finished regions have no open work packages
+    if( m_chunkSize > 0 ) {
+      m_wrkCnts[l_rg].nextChunk.store( m_balancing.nChunks( l_rg ), std::memory_order_relaxed );
+      m_wrkCnts[l_rg].nOpen.store( (i_status == FIN) ? 0 : m_balancing.nChunks( l_rg ),
+                                   std::memory_order_release );
+    }
+    else if( m_tasks ) {
+      m_wrkCnts[l_rg].nOpen.store( (i_status == FIN) ? 0 : m_nWrks,
+                                   std::memory_order_release );
+    }
   }
 }
 
-void edge::parallel::Shared::setStatusTd(  t_status     i_status,
+bool edge::parallel::Shared::setStatusTd(  t_status     i_status,
                                            unsigned int i_id ) {
   // flush for a consistent view
 #ifdef PP_USE_OMP
@@ -224,18 +307,34 @@ void edge::parallel::Shared::setStatusTd(  t_status     i_status,
 
   std::size_t l_rg = getWrkRgn( i_id );
 
-  volatile t_status *l_st = &m_wrkRgns[l_rg].wrkPkgs[g_thread].status;
+  // chunks have no individual status, the last finished chunk finishes the region
+  if( m_chunkSize > 0 ) {
+    if( i_status == FIN ) {
+      return m_wrkCnts[l_rg].nOpen.fetch_sub( 1, std::memory_order_acq_rel ) == 1;
+    }
+    EDGE_CHECK( i_status == IPR ) << "previous status not matching: " << i_status;
+    return false;
+  }
+
+  // work package of the calling thread, which differs for stolen tasks
+  unsigned int l_pkg = g_thread;
+  if( m_tasks ) {
+    EDGE_CHECK_EQ( m_stealing.claimed( g_thread ).rg, l_rg );
+    l_pkg = m_stealing.claimed( g_thread ).pkg;
+  }
+
+  volatile t_status *l_st = &m_wrkRgns[l_rg].wrkPkgs[l_pkg].status;
 
   // check that the previous status matches
   if( i_status == IPR ) {
     EDGE_CHECK( *l_st == RDY );
     // start the timer for this work package, now having status "in progress"
-    m_balancing.startClock( l_rg, g_thread );
+    m_balancing.startClock( l_rg, l_pkg );
   }
   else if( i_status == FIN ) {
     EDGE_CHECK( *l_st == IPR );
     // stop the timer for this work package, now having status "finished"
-    m_balancing.stopClock( l_rg, g_thread );
+    m_balancing.stopClock( l_rg, l_pkg );
   }
   else {
     EDGE_LOG_FATAL << "previous status not matching: " << i_status;
@@ -243,6 +342,13 @@ void edge::parallel::Shared::setStatusTd(  t_status     i_status,
 
   // assign
   *l_st = i_status;
+
+  // publish the results of the work package
+  if( m_tasks && i_status == FIN ) {
+    return m_wrkCnts[l_rg].nOpen.fetch_sub( 1, std::memory_order_acq_rel ) == 1;
+  }
+
+  return false;
 }
 
 bool edge::parallel::Shared::getStatusAll( t_status     i_status,
@@ -250,6 +356,11 @@ bool edge::parallel::Shared::getStatusAll( t_status     i_status,
   // find the correct work region
   std::size_t l_rg = getWrkRgn( i_id );
 
+  // no need to walk the workers' packages in task-based scheduling
+  if( m_tasks && i_status == FIN ) {
+    return m_wrkCnts[l_rg].nOpen.load( std::memory_order_acquire ) == 0;
+  }
+
   volatile WrkPkg* l_wps = m_wrkRgns[l_rg].wrkPkgs.data();
 
   // iterate over all workers and check if we are finished
@@ -268,4 +379,10 @@ void edge::parallel::Shared::balance() {
   m_balancing.balance();
   if( EDGE_VLOG_IS_ON(2) )
     m_balancing.print();
+
+  if( m_tasks && m_chunkSize == 0 ) {
+    if( EDGE_VLOG_IS_ON(2) )
+      m_stealing.print();
+    m_stealing.resetStats();
+  }
 }
\ No newline at end of file
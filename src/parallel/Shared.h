@@ -24,12 +24,14 @@
 #ifndef EDGE_PARALLEL_SHARED_H
 #define EDGE_PARALLEL_SHARED_H
 
+#include <atomic>
 #include <cstdint>
 #include <vector>
 #include "data/SparseEntities.hpp"
 #include "data/EntityLayout.type"
 #include "parallel/global.h"
 #include "LoadBalancing.h"
+#include "WorkStealing.h"
 #include "io/logging.h"
 
 namespace edge {
@@ -82,12 +84,39 @@ class edge::parallel::Shared {
       std::vector< WrkPkg > wrkPkgs;
     };
 
+    // number of open work packages of a region (task-based scheduling only)
+    struct WrkCnt {
+      //! number of work packages which are not finished
+      std::atomic< int > nOpen{0};
+
+      //! next chunk of the region which is claimed by a worker (chunked work regions only)
+      std::atomic< std::size_t > nextChunk{0};
+
+      //! 64byte padding for separate signaling cache lines
+      uint64_t padding[8];
+    };
+
     //! work regions present in the simulation, sorted by priority (descending).
     std::vector< WrkRgn > m_wrkRgns;
 
     //! dynamic load balancing
     LoadBalancing m_balancing;
 
+    //! true if the work packages are distributed through task queues rather than polled by the workers
+    bool m_tasks = false;
+
+    //! number of entities in the chunks of the work regions, 0 if the regions are split into one package per worker
+    std::size_t m_chunkSize = 0;
+
+    //! task queues of the workers
+    WorkStealing m_stealing;
+
+    //! counters of the open work packages, one per work region (sorted as the regions)
+    std::vector< WrkCnt > m_wrkCnts;
+
+    //! token of the thread which is currently scheduling (task-based scheduling only)
+    std::atomic_flag m_schedToken = ATOMIC_FLAG_INIT;
+
     /**
      * Gets the work region for the given id.
      *
@@ -125,6 +154,46 @@ class edge::parallel::Shared {
      **/
     void init( unsigned int i_nWrks = 0 );
 
+    /**
+     * Enables the task-based scheduling of the work packages.
+     * Instead of polling the work regions, released work packages are pushed to per-worker task queues.
+     * Idle workers steal tasks from the other workers and take over the scheduling (see lockSched).
+     *
+     * Remark: This should be called outside of the omp-parallel region and before any work region is registered.
+     **/
+    void enableTasks() { m_tasks = true; }
+
+    /**
+     * Enables the chunking of the work regions, which implies task-based scheduling.
+     * Instead of a single package per worker, every work region is split into fixed-size chunks.
+     * Workers claim the chunks of the released regions dynamically through an atomic counter per region.
+     *
+     * Remark: This should be called outside of the omp-parallel region, after init and before any work region is registered.
+     *
+     * @param i_chunkSize number of entities in a chunk.
+     **/
+    void enableChunks( std::size_t i_chunkSize );
+
+    /**
+     * Determines if the task-based scheduling is enabled.
+     *
+     * @return true if the task-based scheduling is enabled, false otherwise.
+     **/
+    bool tasks() const { return m_tasks; }
+
+    /**
+     * Tries to obtain the scheduling token (task-based scheduling only).
+     * The holder of the token is the only thread running the scheduling and communication tasks.
+     *
+     * @return true if the calling thread obtained the token, false if another thread holds it.
+     **/
+    bool lockSched() { return !m_schedToken.test_and_set( std::memory_order_acquire ); }
+
+    /**
+     * Releases the scheduling token.
+     **/
+    void unlockSched() { m_schedToken.clear( std::memory_order_release ); }
+
     /**
      * Determine if the thread is the lead of the communication threads
      *
@@ -216,6 +285,17 @@ class edge::parallel::Shared {
                              i_nSpTypes,
                              i_spType,
                              i_enChars );
+
+      // adjust the task-based scheduling to the new number of regions
+      if( m_tasks ) {
+        if( m_chunkSize == 0 ) m_stealing.init( m_nWrks, m_wrkRgns.size() );
+        std::vector< WrkCnt >( m_wrkRgns.size() ).swap( m_wrkCnts );
+
+        // nothing to claim until released
+        for( std::size_t l_rg = 0; l_rg < m_wrkRgns.size(); l_rg++ ) {
+          m_wrkCnts[l_rg].nextChunk.store( m_balancing.nChunks( l_rg ), std::memory_order_relaxed );
+        }
+      }
     }
 
 // sync memory view
@@ -227,6 +307,7 @@ class edge::parallel::Shared {
     /**
      * Gets work for the calling thread.
      * If work is available, OMP-flush is called.
+     * In task-based scheduling, the work package is taken from the task queues, possibly from another worker.
      *
      * @param o_tg time group.
      * @param o_step step in the computational scheme.
@@ -250,13 +331,15 @@ class edge::parallel::Shared {
      *
      * @param i_st status which is set.
      * @param i_id id of the work region.
+     * @return true if task-based scheduling is used and the call finished the last open work package of the region, false otherwise.
      **/
-    void setStatusTd( t_status     i_status,
+    bool setStatusTd( t_status     i_status,
                       unsigned int i_id );
 
     /**
      * Checks if the status of all workers matches for the region.
      * If this is true, OMP-flush is called.
+     * In task-based scheduling, FIN is resolved through the region's counter of open work packages.
      *
      * @param i_status status to check.
      * @param i_id id of the region.
@@ -268,6 +351,7 @@ class edge::parallel::Shared {
     /**
      * Sets the status of the region for all workers.
      * Additionally, OMP-flush is called.
+     * In task-based scheduling, RDY releases the region's work packages to the owners' task queues.
      *
      * @param i_status status to set.
      * @param i_id id of the region.
@@ -285,6 +369,7 @@ class edge::parallel::Shared {
 
     /**
      * @brief Balances the work packages.
+     *        In task-based scheduling the stats of the task queues are printed (verbose only) and reset.
      */
     void balance();
 
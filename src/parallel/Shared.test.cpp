@@ -59,4 +59,143 @@ TEST_CASE( "NUMA-aware initialization", "[numaInit]" ) {
   // check the result
   for( unsigned int l_en = 0; l_en < 73*31; l_en++ )  REQUIRE( l_arr1[l_en] == float(0) );
   for( unsigned int l_en = 0; l_en <     3; l_en++ )  REQUIRE( l_arr2[l_en] == float(0) );
-}
\ No newline at end of file
+}
+TEST_CASE( "Task-based scheduling of work regions", "[shared][tasks]" ) {
+  edge::parallel::Shared l_shared;
+  l_shared.init();
+  l_shared.enableTasks();
+
+  // register two work regions
+  l_shared.regWrkRgn( 0, 0, 0, 0,    1000, 1 );
+  l_shared.regWrkRgn( 1, 2, 7, 1000,   10, 2 );
+  REQUIRE( l_shared.m_wrkCnts.size() == 2 );
+
+  // nothing is finished after a reset to waiting
+  l_shared.resetStatus( edge::parallel::Shared::WAI );
+  REQUIRE( !l_shared.getStatusAll( edge::parallel::Shared::FIN, 0 ) );
+  REQUIRE( !l_shared.getStatusAll( edge::parallel::Shared::FIN, 7 ) );
+
+  // release both regions
+  l_shared.setStatusAll( edge::parallel::Shared::RDY, 0 );
+  l_shared.setStatusAll( edge::parallel::Shared::RDY, 7 );
+
+  // process all entities
+  std::vector< unsigned short > l_exec( 1010, 0 );
+  unsigned int l_nLast[2] = {0, 0};
+
+#ifdef PP_USE_OMP
+#pragma omp parallel
+#endif
+  {
+    while(    !l_shared.getStatusAll( edge::parallel::Shared::FIN, 0 )
+           || !l_shared.getStatusAll( edge::parallel::Shared::FIN, 7 ) ) {
+      unsigned short l_tg, l_st;
+      unsigned int l_id;
+      int_el l_first, l_size;
+      int_el l_enSp[1];
+
+      if( l_shared.getWrkTd( l_tg, l_st, l_id, l_first, l_size, l_enSp ) ) {
+        l_shared.setStatusTd( edge::parallel::Shared::IPR, l_id );
+        for( int_el l_en = l_first; l_en < l_first+l_size; l_en++ ) {
+#ifdef PP_USE_OMP
+#pragma omp atomic
+#endif
+          l_exec[l_en]++;
+        }
+        if( l_shared.setStatusTd( edge::parallel::Shared::FIN, l_id ) ) {
+#ifdef PP_USE_OMP
+#pragma omp atomic
+#endif
+          l_nLast[l_id/7]++;
+        }
+      }
+    }
+  }
+
+  // every entity was processed exactly once
+  for( std::size_t l_en = 0; l_en < l_exec.size(); l_en++ ) REQUIRE( l_exec[l_en] == 1 );
+
+  // exactly one worker finished the last work package of each region
+  REQUIRE( l_nLast[0] == 1 );
+  REQUIRE( l_nLast[1] == 1 );
+
+  // no tasks are left
+  for( int l_wo = 0; l_wo < l_shared.m_nWrks; l_wo++ ) REQUIRE( l_shared.m_stealing.m_queues[l_wo].nTasks == 0 );
+
+  // scheduling token
+  REQUIRE(  l_shared.lockSched() );
+  REQUIRE( !l_shared.lockSched() );
+  l_shared.unlockSched();
+  REQUIRE(  l_shared.lockSched() );
+  l_shared.unlockSched();
+}
+
+TEST_CASE( "Chunked work regions with dynamic self-scheduling", "[shared][chunks]" ) {
+  edge::parallel::Shared l_shared;
+  l_shared.init();
+  l_shared.enableChunks( 64 );
+  REQUIRE( l_shared.tasks() );
+
+  // register two work regions and an empty one
+  l_shared.regWrkRgn( 0, 0, 0, 0,    1000, 1 );
+  l_shared.regWrkRgn( 1, 2, 7, 1000,   10, 2 );
+  l_shared.regWrkRgn( 1, 1, 9, 1010,    0, 0 );
+  REQUIRE( l_shared.m_balancing.nChunks( 0 ) ==  1 );
+  REQUIRE( l_shared.m_balancing.nChunks( 1 ) == 16 );
+  REQUIRE( l_shared.m_balancing.nChunks( 2 ) ==  1 );
+
+  // nothing can be claimed before the regions are released
+  unsigned short l_tg, l_st;
+  unsigned int l_id;
+  int_el l_first, l_size;
+  int_el l_enSp[1];
+
+  l_shared.resetStatus( edge::parallel::Shared::WAI );
+  REQUIRE( !l_shared.getStatusAll( edge::parallel::Shared::FIN, 0 ) );
+  REQUIRE( !l_shared.getWrkTd( l_tg, l_st, l_id, l_first, l_size, l_enSp ) );
+
+  // two rounds of processing all entities
+  for( unsigned short l_ro = 0; l_ro < 2; l_ro++ ) {
+    l_shared.setStatusAll( edge::parallel::Shared::RDY, 0 );
+    l_shared.setStatusAll( edge::parallel::Shared::RDY, 7 );
+    l_shared.setStatusAll( edge::parallel::Shared::RDY, 9 );
+
+    std::vector< unsigned short > l_exec( 1010, 0 );
+    unsigned int l_nLast[3] = {0, 0, 0};
+
+#ifdef PP_USE_OMP
+#pragma omp parallel private( l_tg, l_st, l_id, l_first, l_size, l_enSp )
+#endif
+    {
+      while(    !l_shared.getStatusAll( edge::parallel::Shared::FIN, 0 )
+             || !l_shared.getStatusAll( edge::parallel::Shared::FIN, 7 )
+             || !l_shared.getStatusAll( edge::parallel::Shared::FIN, 9 ) ) {
+        if( edge::parallel::g_thread < l_shared.m_nWrks &&
+            l_shared.getWrkTd( l_tg, l_st, l_id, l_first, l_size, l_enSp ) ) {
+          l_shared.setStatusTd( edge::parallel::Shared::IPR, l_id );
+          for( int_el l_en = l_first; l_en < l_first+l_size; l_en++ ) {
+#ifdef PP_USE_OMP
+#pragma omp atomic
+#endif
+            l_exec[l_en]++;
+          }
+          if( l_shared.setStatusTd( edge::parallel::Shared::FIN, l_id ) ) {
+#ifdef PP_USE_OMP
+#pragma omp atomic
+#endif
+            l_nLast[ (l_id == 0) ? 0 : (l_id == 7 ? 1 : 2) ]++;
+          }
+        }
+      }
+    }
+
+    // every entity was processed exactly once
+    for( std::size_t l_en = 0; l_en < l_exec.size(); l_en++ ) REQUIRE( l_exec[l_en] == 1 );
+
+    // exactly one worker finished the last chunk of each region
+    for( unsigned short l_rg = 0; l_rg < 3; l_rg++ ) REQUIRE( l_nLast[l_rg] == 1 );
+
+    // nothing is left
+    REQUIRE( !l_shared.getWrkTd( l_tg, l_st, l_id, l_first, l_size, l_enSp ) );
+  }
+}
@@ -0,0 +1,152 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Per-worker task queues with work stealing.
+ **/
+#include "WorkStealing.h"
+#include "io/logging.h"
+
+edge::parallel::WorkStealing::~WorkStealing() {
+  delete[] m_queues;
+  delete[] m_stats;
+}
+
+void edge::parallel::WorkStealing::init( unsigned int i_nWrks,
+                                         std::size_t  i_nRgns ) {
+  delete[] m_queues;
+  delete[] m_stats;
+
+  m_nWrks = i_nWrks;
+  m_queues = new Queue[m_nWrks];
+  m_stats  = new Stats[m_nWrks];
+
+  // every queue holds at most one task per work region
+  for( unsigned int l_wo = 0; l_wo < m_nWrks; l_wo++ ) {
+    m_queues[l_wo].tasks.resize( i_nRgns );
+  }
+}
+
+bool edge::parallel::WorkStealing::take( Queue  & io_queue,
+                                         t_task & o_task ) {
+  // cheap check without the lock
+  if( io_queue.nTasks.load( std::memory_order_relaxed ) == 0 ) return false;
+
+  while( io_queue.lock.test_and_set( std::memory_order_acquire ) );
+
+  std::size_t l_nTasks = io_queue.nTasks.load( std::memory_order_relaxed );
+  bool l_found = l_nTasks > 0;
+  if( l_found ) {
+    // find the highest priority
+    std::size_t l_ta = 0;
+    for( std::size_t l_ot = 1; l_ot < l_nTasks; l_ot++ ) {
+      if( io_queue.tasks[l_ot].rg < io_queue.tasks[l_ta].rg ) l_ta = l_ot;
+    }
+    o_task = io_queue.tasks[l_ta];
+
+    // fill the gap with the last task
+    io_queue.tasks[l_ta] = io_queue.tasks[l_nTasks-1];
+    io_queue.nTasks.store( l_nTasks-1, std::memory_order_relaxed );
+  }
+
+  io_queue.lock.clear( std::memory_order_release );
+
+  return l_found;
+}
+
+void edge::parallel::WorkStealing::push( unsigned int i_wrk,
+                                         unsigned int i_rg,
+                                         unsigned int i_pkg ) {
+  Queue & l_queue = m_queues[i_wrk];
+
+  while( l_queue.lock.test_and_set( std::memory_order_acquire ) );
+
+  std::size_t l_nTasks = l_queue.nTasks.load( std::memory_order_relaxed );
+  EDGE_CHECK_LT( l_nTasks, l_queue.tasks.size() );
+  l_queue.tasks[l_nTasks].rg  = i_rg;
+  l_queue.tasks[l_nTasks].pkg = i_pkg;
+  l_queue.nTasks.store( l_nTasks+1, std::memory_order_relaxed );
+
+  l_queue.lock.clear( std::memory_order_release );
+}
+
+bool edge::parallel::WorkStealing::get( unsigned int   i_wrk,
+                                        unsigned int & o_rg,
+                                        unsigned int & o_pkg ) {
+  Stats & l_stats = m_stats[i_wrk];
+  t_task l_task;
+
+  // own queue first
+  bool l_found = take( m_queues[i_wrk], l_task );
+
+  // steal from the other workers
+  for( unsigned int l_of = 1; l_of < m_nWrks && !l_found; l_of++ ) {
+    l_found = take( m_queues[ (i_wrk+l_of) % m_nWrks ], l_task );
+    if( l_found ) l_stats.nStolen++;
+  }
+
+  if( l_found ) {
+    o_rg  = l_task.rg;
+    o_pkg = l_task.pkg;
+    l_stats.claimed = l_task;
+    l_stats.nTasks++;
+
+    // end idle phase
+    if( l_stats.idle ) {
+      std::chrono::duration< double > l_dur = std::chrono::steady_clock::now() - l_stats.idleStart;
+      l_stats.idleTime += l_dur.count();
+      l_stats.idle = false;
+    }
+  }
+  // start idle phase
+  else if( !l_stats.idle ) {
+    l_stats.idleStart = std::chrono::steady_clock::now();
+    l_stats.idle = true;
+  }
+
+  return l_found;
+}
+
+void edge::parallel::WorkStealing::resetStats() {
+  for( unsigned int l_wo = 0; l_wo < m_nWrks; l_wo++ ) {
+    m_stats[l_wo].nTasks   = 0;
+    m_stats[l_wo].nStolen  = 0;
+    m_stats[l_wo].idle     = false;
+    m_stats[l_wo].idleTime = 0;
+  }
+}
+
+void edge::parallel::WorkStealing::print() const {
+  EDGE_LOG_INFO << "printing statistics of the task-based scheduling";
+
+  std::chrono::steady_clock::time_point l_now = std::chrono::steady_clock::now();
+
+  for( unsigned int l_wo = 0; l_wo < m_nWrks; l_wo++ ) {
+    double l_idle = m_stats[l_wo].idleTime;
+    if( m_stats[l_wo].idle ) {
+      std::chrono::duration< double > l_dur = l_now - m_stats[l_wo].idleStart;
+      l_idle += l_dur.count();
+    }
+
+    EDGE_LOG_INFO << "  worker #" << l_wo << ": "
+                  << m_stats[l_wo].nTasks << " tasks, "
+                  << m_stats[l_wo].nStolen << " stolen, "
+                  << l_idle << "s idle";
+  }
+}
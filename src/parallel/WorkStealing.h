@@ -0,0 +1,179 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Per-worker task queues with work stealing.
+ **/
+#ifndef EDGE_PARALLEL_WORK_STEALING_H
+#define EDGE_PARALLEL_WORK_STEALING_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace edge {
+  namespace parallel {
+    class WorkStealing;
+  }
+}
+
+/**
+ * Per-worker task queues with work stealing.
+ *
+ * A task is a work package (one per worker) of a work region.
+ * Released tasks are pushed to the queue of the worker owning the package, which keeps the first-touch placement of the data.
+ * Workers take tasks from their own queue and steal from the queues of other workers if their own queue runs dry.
+ *
+ * Work regions are sorted by priority (descending), thus the region's position is used as priority.
+ * The queues hold at most one task per work region, which makes a linear search for the highest priority cheaper than maintaining a heap.
+ **/
+class edge::parallel::WorkStealing {
+  public:
+    //! task in a queue
+    typedef struct {
+      //! position of the work region
+      unsigned int rg;
+
+      //! work package in the region
+      unsigned int pkg;
+    } t_task;
+
+  private:
+    //! task queue of a worker
+    struct Queue {
+      //! lock of the queue
+      std::atomic_flag lock = ATOMIC_FLAG_INIT;
+
+      //! number of tasks in the queue
+      std::atomic< std::size_t > nTasks{0};
+
+      //! tasks in the queue
+      std::vector< t_task > tasks;
+
+      //! 64byte padding for separate cache lines of the workers
+      uint64_t padding[8];
+    };
+
+    //! statistics of a worker
+    struct Stats {
+      //! number of executed tasks
+      std::size_t nTasks = 0;
+
+      //! number of tasks stolen from other workers
+      std::size_t nStolen = 0;
+
+      //! true if the worker is idling
+      bool idle = false;
+
+      //! start of the current idle phase
+      std::chrono::steady_clock::time_point idleStart;
+
+      //! accumulated idle time in seconds
+      double idleTime = 0;
+
+      //! task which is currently processed by the worker
+      t_task claimed = {0, 0};
+
+      //! 64byte padding for separate cache lines of the workers
+      uint64_t padding[8];
+    };
+
+    //! number of workers
+    unsigned int m_nWrks = 0;
+
+    //! queues of the workers
+    Queue * m_queues = nullptr;
+
+    //! stats of the workers
+    Stats * m_stats = nullptr;
+
+    /**
+     * Takes the task with the highest priority from the given queue.
+     *
+     * @param io_queue queue from which the task is taken.
+     * @param o_task will be set to the task if the queue is non-empty.
+     * @return true if a task was taken, false if the queue is empty.
+     **/
+    static bool take( Queue  & io_queue,
+                      t_task & o_task );
+
+  public:
+    /**
+     * Destructor.
+     **/
+    ~WorkStealing();
+
+    /**
+     * Initializes the queues.
+     * Remark: This should be called outside of the omp-parallel region.
+     *
+     * @param i_nWrks number of workers.
+     * @param i_nRgns number of work regions.
+     **/
+    void init( unsigned int i_nWrks,
+               std::size_t  i_nRgns );
+
+    /**
+     * Releases a task by pushing it to the queue of the given worker.
+     *
+     * @param i_wrk worker owning the queue.
+     * @param i_rg position of the work region.
+     * @param i_pkg work package in the region.
+     **/
+    void push( unsigned int i_wrk,
+               unsigned int i_rg,
+               unsigned int i_pkg );
+
+    /**
+     * Gets a task for the given worker.
+     * The worker's own queue is queried first, then the other workers' queues in round robin order.
+     * Idle time of the worker is accounted between unsuccessful and successful calls.
+     *
+     * @param i_wrk worker asking for the task.
+     * @param o_rg will be set to the position of the work region if successful.
+     * @param o_pkg will be set to the work package if successful.
+     * @return true if a task was found, false otherwise.
+     **/
+    bool get( unsigned int   i_wrk,
+              unsigned int & o_rg,
+              unsigned int & o_pkg );
+
+    /**
+     * Gets the task which was last obtained by the worker.
+     *
+     * @param i_wrk worker.
+     * @return claimed task.
+     **/
+    t_task const & claimed( unsigned int i_wrk ) const { return m_stats[i_wrk].claimed; }
+
+    /**
+     * Resets the statistics of all workers.
+     * Remark: This should be called outside of the omp-parallel region.
+     **/
+    void resetStats();
+
+    /**
+     * Prints the statistics of the workers, gathered since the last reset.
+     * Idle phases which are still open are accounted up to the time of the call.
+     **/
+    void print() const;
+};
+
+#endif
@@ -0,0 +1,140 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Unit tests of the task queues with work stealing.
+ **/
+#include <catch.hpp>
+#include <vector>
+#ifdef PP_USE_OMP
+#include <omp.h>
+#endif
+
+#define private public
+#include "WorkStealing.h"
+#undef private
+
+TEST_CASE( "Work stealing: local tasks and priorities.", "[workStealing]" ) {
+  edge::parallel::WorkStealing l_ws;
+  l_ws.init( 3, 5 );
+
+  unsigned int l_rg = 0;
+  unsigned int l_pkg = 0;
+
+  // nothing available
+  REQUIRE( !l_ws.get( 0, l_rg, l_pkg ) );
+  REQUIRE( l_ws.m_stats[0].idle );
+
+  // release three tasks to worker 1
+  l_ws.push( 1, 3, 1 );
+  l_ws.push( 1, 0, 1 );
+  l_ws.push( 1, 4, 1 );
+  REQUIRE( l_ws.m_queues[1].nTasks == 3 );
+
+  // owner gets the highest priority first
+  REQUIRE( l_ws.get( 1, l_rg, l_pkg ) );
+  REQUIRE( l_rg  == 0 );
+  REQUIRE( l_pkg == 1 );
+  REQUIRE( l_ws.claimed(1).rg  == 0 );
+  REQUIRE( l_ws.claimed(1).pkg == 1 );
+
+  REQUIRE( l_ws.get( 1, l_rg, l_pkg ) );
+  REQUIRE( l_rg  == 3 );
+  REQUIRE( l_ws.m_stats[1].nStolen == 0 );
+
+  // worker 2 steals the remaining task
+  REQUIRE( l_ws.get( 2, l_rg, l_pkg ) );
+  REQUIRE( l_rg  == 4 );
+  REQUIRE( l_pkg == 1 );
+  REQUIRE( l_ws.m_stats[2].nStolen == 1 );
+  REQUIRE( l_ws.m_stats[2].nTasks  == 1 );
+
+  // worker 0 ends its idle phase
+  l_ws.push( 2, 2, 2 );
+  REQUIRE( l_ws.get( 0, l_rg, l_pkg ) );
+  REQUIRE( l_rg  == 2 );
+  REQUIRE( l_pkg == 2 );
+  REQUIRE( !l_ws.m_stats[0].idle );
+  REQUIRE( l_ws.m_stats[0].idleTime >= 0 );
+
+  // everything is consumed
+  for( unsigned int l_wo = 0; l_wo < 3; l_wo++ ) {
+    REQUIRE( !l_ws.get( l_wo, l_rg, l_pkg ) );
+    REQUIRE( l_ws.m_queues[l_wo].nTasks == 0 );
+  }
+
+  // reset stats
+  l_ws.resetStats();
+  for( unsigned int l_wo = 0; l_wo < 3; l_wo++ ) {
+    REQUIRE( l_ws.m_stats[l_wo].nTasks   == 0 );
+    REQUIRE( l_ws.m_stats[l_wo].nStolen  == 0 );
+    REQUIRE( l_ws.m_stats[l_wo].idleTime == 0 );
+  }
+}
+
+TEST_CASE( "Work stealing: concurrent execution.", "[workStealing]" ) {
+  unsigned int l_nWrks = 4;
+#ifdef PP_USE_OMP
+#pragma omp parallel
+#pragma omp master
+  l_nWrks = omp_get_num_threads();
+#endif
+
+  unsigned int l_nRgns = 37;
+  edge::parallel::WorkStealing l_ws;
+  l_ws.init( l_nWrks, l_nRgns );
+
+  // release all tasks to the first worker
+  for( unsigned int l_rg = 0; l_rg < l_nRgns; l_rg++ ) l_ws.push( 0, l_rg, l_rg % l_nWrks );
+
+  // count executions of the tasks
+  std::vector< unsigned int > l_exec( l_nRgns, 0 );
+  unsigned int l_nWrong = 0;
+
+#ifdef PP_USE_OMP
+#pragma omp parallel num_threads(l_nWrks)
+#endif
+  {
+    unsigned int l_wo = 0;
+#ifdef PP_USE_OMP
+    l_wo = omp_get_thread_num();
+#endif
+    unsigned int l_rg, l_pkg;
+    while( l_ws.get( l_wo, l_rg, l_pkg ) ) {
+#ifdef PP_USE_OMP
+#pragma omp atomic
+#endif
+      l_exec[l_rg]++;
+
+      if( l_pkg != l_rg % l_nWrks ) {
+#ifdef PP_USE_OMP
+#pragma omp atomic
+#endif
+        l_nWrong++;
+      }
+    }
+  }
+
+  // every task is executed exactly once
+  REQUIRE( l_nWrong == 0 );
+  std::size_t l_nTasks = 0;
+  for( unsigned int l_wo = 0; l_wo < l_nWrks; l_wo++ ) l_nTasks += l_ws.m_stats[l_wo].nTasks;
+  REQUIRE( l_nTasks == l_nRgns );
+  for( unsigned int l_rg = 0; l_rg < l_nRgns; l_rg++ ) REQUIRE( l_exec[l_rg] == 1 );
+}
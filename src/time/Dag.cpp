@@ -0,0 +1,112 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Static dependency graph of the time stepping's control flow.
+ **/
+#include "Dag.h"
+#include "io/logging.h"
+
+edge::time::Dag::~Dag() {
+  delete[] m_nOpenPreds;
+}
+
+void edge::time::Dag::clear() {
+  m_types.clear();
+  m_tgs.clear();
+  m_ids.clear();
+  m_deps.clear();
+  m_succOff.clear();
+  m_succs.clear();
+  m_nPreds.clear();
+  m_roots.clear();
+
+  delete[] m_nOpenPreds;
+  m_nOpenPreds = nullptr;
+  m_nOpen.store( 0, std::memory_order_relaxed );
+}
+
+std::size_t edge::time::Dag::addNode( t_node         i_type,
+                                      unsigned short i_tg,
+                                      unsigned int   i_id ) {
+  m_types.push_back( i_type );
+  m_tgs.push_back( i_tg );
+  m_ids.push_back( i_id );
+
+  return m_types.size()-1;
+}
+
+void edge::time::Dag::addDep( std::size_t i_pred,
+                              std::size_t i_succ ) {
+  EDGE_CHECK_LT( i_pred, m_types.size() );
+  EDGE_CHECK_LT( i_succ, m_types.size() );
+  EDGE_CHECK_NE( i_pred, i_succ );
+
+  m_deps.push_back( std::make_pair( i_pred, i_succ ) );
+}
+
+void edge::time::Dag::compile() {
+  std::size_t l_nNodes = m_types.size();
+
+  // derive the compressed successor list
+  m_succOff.assign( l_nNodes+1, 0 );
+  m_nPreds.assign( l_nNodes, 0 );
+  for( std::size_t l_de = 0; l_de < m_deps.size(); l_de++ ) {
+    m_succOff[ m_deps[l_de].first+1 ]++;
+    m_nPreds[ m_deps[l_de].second ]++;
+  }
+  for( std::size_t l_no = 0; l_no < l_nNodes; l_no++ ) {
+    m_succOff[l_no+1] += m_succOff[l_no];
+  }
+
+  m_succs.resize( m_deps.size() );
+  std::vector< std::size_t > l_pos( m_succOff.begin(), m_succOff.end()-1 );
+  for( std::size_t l_de = 0; l_de < m_deps.size(); l_de++ ) {
+    m_succs[ l_pos[m_deps[l_de].first]++ ] = m_deps[l_de].second;
+  }
+
+  // collect the roots
+  m_roots.clear();
+  for( std::size_t l_no = 0; l_no < l_nNodes; l_no++ ) {
+    if( m_nPreds[l_no] == 0 ) m_roots.push_back( l_no );
+  }
+
+  // check that all nodes are reachable in topological order, i.e., the graph is acyclic
+  std::vector< unsigned int > l_nPreds = m_nPreds;
+  std::vector< std::size_t > l_rdy = m_roots;
+  std::size_t l_nVisited = 0;
+  while( l_rdy.size() > 0 ) {
+    std::size_t l_no = l_rdy.back();
+    l_rdy.pop_back();
+    l_nVisited++;
+
+    for( std::size_t l_sc = m_succOff[l_no]; l_sc < m_succOff[l_no+1]; l_sc++ ) {
+      if( --l_nPreds[ m_succs[l_sc] ] == 0 ) l_rdy.push_back( m_succs[l_sc] );
+    }
+  }
+  EDGE_CHECK_EQ( l_nVisited, l_nNodes ) << "dependency graph contains cycles";
+
+  // reset the counters
+  delete[] m_nOpenPreds;
+  m_nOpenPreds = new std::atomic< unsigned int >[l_nNodes];
+  for( std::size_t l_no = 0; l_no < l_nNodes; l_no++ ) {
+    m_nOpenPreds[l_no].store( m_nPreds[l_no], std::memory_order_relaxed );
+  }
+  m_nOpen.store( l_nNodes, std::memory_order_release );
+}
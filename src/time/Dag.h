@@ -0,0 +1,199 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Static dependency graph of the time stepping's control flow.
+ **/
+#ifndef EDGE_TIME_DAG_H
+#define EDGE_TIME_DAG_H
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace edge {
+  namespace time {
+    class Dag;
+  }
+}
+
+/**
+ * Static dependency graph of the time stepping's control flow.
+ *
+ * The graph is compiled once per synchronization interval, unrolling all time steps of all time groups.
+ * Every node holds an atomic counter of unfinished predecessors.
+ * The thread finishing a node decrements the counters of the successors and releases those without open dependencies.
+ * This replaces the repeated evaluation of a state machine by the scheduler.
+ **/
+class edge::time::Dag {
+  public:
+    //! types of the nodes
+    typedef enum: unsigned short {
+      //! work region, processed by the workers
+      RGN  = 0,
+      //! distributed memory sends
+      SEND = 1,
+      //! distributed memory receives
+      RECV = 2,
+      //! flush of the receiver output
+      OUT  = 3,
+      //! completion of a time step
+      TS   = 4
+    } t_node;
+
+  private:
+    //! type of every node
+    std::vector< t_node > m_types;
+
+    //! time group of every node
+    std::vector< unsigned short > m_tgs;
+
+    //! id of every node, e.g., the work region's id
+    std::vector< unsigned int > m_ids;
+
+    //! dependencies (predecessor, successor) before compilation
+    std::vector< std::pair< std::size_t, std::size_t > > m_deps;
+
+    //! offsets of the nodes' successors in the compressed successor list
+    std::vector< std::size_t > m_succOff;
+
+    //! compressed list of successors
+    std::vector< std::size_t > m_succs;
+
+    //! number of predecessors of every node after compilation
+    std::vector< unsigned int > m_nPreds;
+
+    //! nodes without predecessors
+    std::vector< std::size_t > m_roots;
+
+    //! number of open predecessors of every node
+    std::atomic< unsigned int > * m_nOpenPreds = nullptr;
+
+    //! number of nodes which did not finish
+    std::atomic< std::size_t > m_nOpen{0};
+
+  public:
+    /**
+     * Destructor.
+     **/
+    ~Dag();
+
+    /**
+     * Removes all nodes and dependencies.
+     **/
+    void clear();
+
+    /**
+     * Adds a node to the graph.
+     *
+     * @param i_type type of the node.
+     * @param i_tg time group of the node.
+     * @param i_id id of the node.
+     * @return position of the node.
+     **/
+    std::size_t addNode( t_node         i_type,
+                         unsigned short i_tg,
+                         unsigned int   i_id );
+
+    /**
+     * Adds a dependency between two nodes.
+     *
+     * @param i_pred predecessor, which has to finish before the successor is released.
+     * @param i_succ successor.
+     **/
+    void addDep( std::size_t i_pred,
+                 std::size_t i_succ );
+
+    /**
+     * Compiles the graph, which resets the counters of the open predecessors.
+     * Aborts if the graph contains cycles.
+     **/
+    void compile();
+
+    /**
+     * Gets the number of nodes.
+     *
+     * @return number of nodes.
+     **/
+    std::size_t size() const { return m_types.size(); }
+
+    /**
+     * Gets the nodes without predecessors, which are ready after compilation.
+     *
+     * @return root nodes.
+     **/
+    std::vector< std::size_t > const & roots() const { return m_roots; }
+
+    /**
+     * Gets the type of a node.
+     *
+     * @param i_node position of the node.
+     * @return type.
+     **/
+    t_node type( std::size_t i_node ) const { return m_types[i_node]; }
+
+    /**
+     * Gets the time group of a node.
+     *
+     * @param i_node position of the node.
+     * @return time group.
+     **/
+    unsigned short tg( std::size_t i_node ) const { return m_tgs[i_node]; }
+
+    /**
+     * Gets the id of a node.
+     *
+     * @param i_node position of the node.
+     * @return id.
+     **/
+    unsigned int id( std::size_t i_node ) const { return m_ids[i_node]; }
+
+    /**
+     * Gets the number of nodes which did not finish yet.
+     *
+     * @return number of open nodes.
+     **/
+    std::size_t nOpen() const { return m_nOpen.load( std::memory_order_acquire ); }
+
+    /**
+     * Finishes a node and releases all successors without open dependencies.
+     * Thread-safe, every node has to be finished exactly once.
+     *
+     * @param i_node node which finished.
+     * @param i_release function which is called for every released successor.
+     * @return true if this was the last open node of the graph.
+     *
+     * @paramt TL_T_RELEASE type of the release function, taking the position of the node as argument.
+     **/
+    template< typename TL_T_RELEASE >
+    bool finish( std::size_t    i_node,
+                 TL_T_RELEASE   i_release ) {
+      for( std::size_t l_sc = m_succOff[i_node]; l_sc < m_succOff[i_node+1]; l_sc++ ) {
+        std::size_t l_succ = m_succs[l_sc];
+        if( m_nOpenPreds[l_succ].fetch_sub( 1, std::memory_order_acq_rel ) == 1 ) {
+          i_release( l_succ );
+        }
+      }
+
+      return m_nOpen.fetch_sub( 1, std::memory_order_acq_rel ) == 1;
+    }
+};
+
+#endif
@@ -0,0 +1,171 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Unit tests of the static dependency graph.
+ **/
+#include <catch.hpp>
+#include <atomic>
+#include <vector>
+#ifdef PP_USE_OMP
+#include <omp.h>
+#endif
+
+#define private public
+#include "Dag.h"
+#undef private
+
+TEST_CASE( "Dependency graph: compilation and release of nodes.", "[dag]" ) {
+  edge::time::Dag l_dag;
+
+  // diamond and an isolated node
+  std::size_t l_a = l_dag.addNode( edge::time::Dag::RGN,  0, 3 );
+  std::size_t l_b = l_dag.addNode( edge::time::Dag::SEND, 0, 6 );
+  std::size_t l_c = l_dag.addNode( edge::time::Dag::RECV, 1, 7 );
+  std::size_t l_d = l_dag.addNode( edge::time::Dag::TS,   1, 8 );
+  std::size_t l_e = l_dag.addNode( edge::time::Dag::OUT,  2, 0 );
+
+  l_dag.addDep( l_a, l_b );
+  l_dag.addDep( l_a, l_c );
+  l_dag.addDep( l_c, l_d );
+  l_dag.addDep( l_b, l_d );
+
+  l_dag.compile();
+
+  REQUIRE( l_dag.size() == 5 );
+  REQUIRE( l_dag.nOpen() == 5 );
+  REQUIRE( l_dag.type( l_c ) == edge::time::Dag::RECV );
+  REQUIRE( l_dag.tg(   l_c ) == 1 );
+  REQUIRE( l_dag.id(   l_c ) == 7 );
+
+  REQUIRE( l_dag.roots().size() == 2 );
+  REQUIRE( l_dag.roots()[0] == l_a );
+  REQUIRE( l_dag.roots()[1] == l_e );
+
+  REQUIRE( l_dag.m_nPreds[l_a] == 0 );
+  REQUIRE( l_dag.m_nPreds[l_b] == 1 );
+  REQUIRE( l_dag.m_nPreds[l_d] == 2 );
+
+  std::vector< std::size_t > l_rel;
+  auto l_fun = [&l_rel]( std::size_t i_no ) { l_rel.push_back( i_no ); };
+
+  REQUIRE( !l_dag.finish( l_a, l_fun ) );
+  REQUIRE( l_rel.size() == 2 );
+  REQUIRE( l_rel[0] == l_b );
+  REQUIRE( l_rel[1] == l_c );
+
+  // d waits for b
+  REQUIRE( !l_dag.finish( l_c, l_fun ) );
+  REQUIRE( l_rel.size() == 2 );
+  REQUIRE( !l_dag.finish( l_b, l_fun ) );
+  REQUIRE( l_rel.size() == 3 );
+  REQUIRE( l_rel[2] == l_d );
+
+  REQUIRE( !l_dag.finish( l_d, l_fun ) );
+  REQUIRE( l_dag.nOpen() == 1 );
+  REQUIRE(  l_dag.finish( l_e, l_fun ) );
+  REQUIRE( l_dag.nOpen() == 0 );
+
+  // recompilation resets the counters
+  l_dag.compile();
+  REQUIRE( l_dag.nOpen() == 5 );
+  REQUIRE( l_dag.m_nOpenPreds[l_d] == 2 );
+
+  l_dag.clear();
+  REQUIRE( l_dag.size() == 0 );
+  REQUIRE( l_dag.nOpen() == 0 );
+}
+
+TEST_CASE( "Dependency graph: concurrent execution.", "[dag]" ) {
+  edge::time::Dag l_dag;
+
+  // layers of nodes, every node depends on all nodes of the previous layer
+  std::size_t l_nLays = 50;
+  std::size_t l_nNoLay = 7;
+
+  for( std::size_t l_la = 0; l_la < l_nLays; l_la++ ) {
+    for( std::size_t l_no = 0; l_no < l_nNoLay; l_no++ ) {
+      l_dag.addNode( edge::time::Dag::RGN, 0, l_la );
+      if( l_la > 0 ) {
+        for( std::size_t l_pr = 0; l_pr < l_nNoLay; l_pr++ ) {
+          l_dag.addDep( (l_la-1)*l_nNoLay + l_pr, l_la*l_nNoLay + l_no );
+        }
+      }
+    }
+  }
+  l_dag.compile();
+  REQUIRE( l_dag.roots().size() == l_nNoLay );
+
+  // ready nodes, processed concurrently
+  std::vector< std::size_t > l_rdy = l_dag.roots();
+  std::vector< unsigned int > l_nRel( l_dag.size(), 0 );
+  std::atomic< std::size_t > l_nFinLays[50];
+  for( std::size_t l_la = 0; l_la < l_nLays; l_la++ ) l_nFinLays[l_la] = 0;
+  std::atomic< unsigned int > l_nWrong{0};
+  std::atomic< unsigned int > l_nLast{0};
+  std::atomic< bool > l_done{false};
+
+  auto l_fun = [&]( std::size_t i_no ) {
+    // all predecessors have to be finished
+    std::size_t l_la = i_no / l_nNoLay;
+    if( l_la > 0 && l_nFinLays[l_la-1] != l_nNoLay ) l_nWrong++;
+
+#ifdef PP_USE_OMP
+#pragma omp critical(dag_test)
+#endif
+    {
+      l_nRel[i_no]++;
+      l_rdy.push_back( i_no );
+    }
+  };
+
+#ifdef PP_USE_OMP
+#pragma omp parallel
+#endif
+  {
+    while( !l_done ) {
+      bool l_found = false;
+      std::size_t l_no = 0;
+#ifdef PP_USE_OMP
+#pragma omp critical(dag_test)
+#endif
+      {
+        if( l_rdy.size() > 0 ) {
+          l_found = true;
+          l_no = l_rdy.back();
+          l_rdy.pop_back();
+        }
+      }
+
+      if( l_found ) {
+        l_nFinLays[ l_no / l_nNoLay ]++;
+        if( l_dag.finish( l_no, l_fun ) ) {
+          l_nLast++;
+          l_done = true;
+        }
+      }
+    }
+  }
+
+  REQUIRE( l_nWrong == 0 );
+  REQUIRE( l_nLast == 1 );
+  REQUIRE( l_dag.nOpen() == 0 );
+  REQUIRE( l_rdy.size() == 0 );
+  for( std::size_t l_no = l_nNoLay; l_no < l_dag.size(); l_no++ ) REQUIRE( l_nRel[l_no] == 1 );
+}
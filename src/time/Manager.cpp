@@ -24,6 +24,7 @@
 
 #include "Manager.h"
 #include "monitor/instrument.hpp"
+#include "io/logging.h"
 
 void edge::time::Manager::schedule() {
 #if defined PP_T_EQUATIONS_ADVECTION
@@ -37,6 +38,110 @@ void edge::time::Manager::schedule() {
 #endif
 }
 
+void edge::time::Manager::compileDag() {
+  m_dag.clear();
+
+#if defined PP_T_EQUATIONS_SEISMIC
+#include "src/impl/seismic/inc/time/man_dag.inc"
+#else
+  EDGE_LOG_FATAL << "dependency graph not defined";
+#endif
+
+  m_dag.compile();
+
+  // every serial node is released at most once
+  m_dagSerRdy.clear();
+  m_dagSerTkn.clear();
+  m_dagSerIpr.clear();
+  m_dagSerRdy.reserve( m_dag.size() );
+  m_dagSerTkn.reserve( m_dag.size() );
+  m_dagSerIpr.reserve( m_dag.size() );
+
+  m_dagRgns.assign( m_timeGroups.size() * N_ENTRIES_CONTROL_FLOW,
+                    std::numeric_limits< std::size_t >::max() );
+}
+
+void edge::time::Manager::releaseDag( std::size_t i_node ) {
+  if( m_dag.type( i_node ) == Dag::RGN ) {
+    // remember the node for the finishing worker
+    m_dagRgns[ m_dag.id( i_node ) ] = i_node;
+    m_shared.setStatusAll( parallel::Shared::RDY, m_dag.id( i_node ) );
+  }
+  else if( m_dag.type( i_node ) == Dag::TS ) {
+    m_timeGroups[ m_dag.tg( i_node ) ]->updateTsInfo();
+    finishDag( i_node );
+  }
+  else {
+    while( m_dagSerLock.test_and_set( std::memory_order_acquire ) ) {}
+    m_dagSerRdy.push_back( i_node );
+    m_dagSerLock.clear( std::memory_order_release );
+  }
+}
+
+void edge::time::Manager::finishDag( std::size_t i_node ) {
+  unsigned short l_tg = m_dag.tg( i_node );
+
+  // keep the time group's counters consistent
+  if( m_dag.type( i_node ) == Dag::RGN ) {
+    unsigned short l_en = m_dag.id( i_node ) % N_ENTRIES_CONTROL_FLOW;
+    if( m_dagUpdates[l_en] != nullptr ) ( m_timeGroups[l_tg]->*m_dagUpdates[l_en] )();
+  }
+  else if( m_dag.type( i_node ) == Dag::SEND ) m_timeGroups[l_tg]->updateSend();
+  else if( m_dag.type( i_node ) == Dag::RECV ) m_timeGroups[l_tg]->updateRecv();
+
+  bool l_last = m_dag.finish( i_node,
+                              [this]( std::size_t i_succ ) { releaseDag( i_succ ); } );
+
+  if( l_last ) m_finished = true;
+}
+
+void edge::time::Manager::progressDag() {
+  // take the released nodes
+  while( m_dagSerLock.test_and_set( std::memory_order_acquire ) ) {}
+  m_dagSerTkn.swap( m_dagSerRdy );
+  m_dagSerLock.clear( std::memory_order_release );
+
+  // start the nodes
+  for( std::size_t l_sn = 0; l_sn < m_dagSerTkn.size(); l_sn++ ) {
+    std::size_t l_no = m_dagSerTkn[l_sn];
+    unsigned short l_tg = m_dag.tg( l_no );
+
+    if( m_dag.type( l_no ) == Dag::SEND ) {
+      m_distributed.beginSends( m_timeGroups[l_tg]->sendLt(), l_tg );
+      m_dagSerIpr.push_back( l_no );
+    }
+    else if( m_dag.type( l_no ) == Dag::RECV ) {
+      m_distributed.beginRecvs( m_timeGroups[l_tg]->recvLt(), l_tg );
+      m_dagSerIpr.push_back( l_no );
+    }
+    else {
+      EDGE_CHECK_EQ( m_dag.type( l_no ), Dag::OUT );
+      // flush receivers if buffer size gets low
+      m_recvs.flushIf();
+      finishDag( l_no );
+    }
+  }
+  m_dagSerTkn.clear();
+
+  // test the nodes in progress
+  std::size_t l_sn = 0;
+  while( l_sn < m_dagSerIpr.size() ) {
+    std::size_t l_no = m_dagSerIpr[l_sn];
+    unsigned short l_tg = m_dag.tg( l_no );
+
+    bool l_fin;
+    if( m_dag.type( l_no ) == Dag::SEND ) l_fin = m_distributed.finSends( m_timeGroups[l_tg]->sendLt(), l_tg );
+    else                                  l_fin = m_distributed.finRecvs( m_timeGroups[l_tg]->recvLt(), l_tg );
+
+    if( l_fin ) {
+      m_dagSerIpr[l_sn] = m_dagSerIpr.back();
+      m_dagSerIpr.pop_back();
+      finishDag( l_no );
+    }
+    else l_sn++;
+  }
+}
+
 edge::time::Manager::Manager( double                            i_dt,
                               parallel::Shared                & i_shared,
                               parallel::Distributed           & i_distributed,
@@ -56,33 +161,41 @@ edge::time::Manager::~Manager() {
 }
 
 bool edge::time::Manager::getTimePredAvailable( unsigned short i_tg ) {
+  // rates w.r.t. the time groups with smaller and larger time steps
+  std::size_t l_rateGt = m_timeGroups[i_tg]->getRateGt();
+  std::size_t l_rateLt = m_timeGroups[i_tg]->getRateLt();
+
   // time group with smaller time step
   bool l_left = (i_tg == 0) ?
                 true :
-                   m_timeGroups[i_tg-1]->nTimePredInner() == m_timeGroups[i_tg]->nTimePredInner()*2
-                && m_timeGroups[i_tg-1]->nTimePredSend()  == m_timeGroups[i_tg]->nTimePredSend()*2;
+                   m_timeGroups[i_tg-1]->nTimePredInner() == m_timeGroups[i_tg]->nTimePredInner()*l_rateGt
+                && m_timeGroups[i_tg-1]->nTimePredSend()  == m_timeGroups[i_tg]->nTimePredSend()*l_rateGt;
 
   // time group with larger time step
   bool l_right = (i_tg == m_timeGroups.size() - 1 ) ?
                  true :
-                      m_timeGroups[i_tg]->nTimePredInner() <= m_timeGroups[i_tg+1]->nTimePredInner()*2
-                   && m_timeGroups[i_tg]->nTimePredSend()  <= m_timeGroups[i_tg+1]->nTimePredSend()*2;
+                      m_timeGroups[i_tg]->nTimePredInner() <= m_timeGroups[i_tg+1]->nTimePredInner()*l_rateLt
+                   && m_timeGroups[i_tg]->nTimePredSend()  <= m_timeGroups[i_tg+1]->nTimePredSend()*l_rateLt;
 
   return l_left && l_right;
 }
 
 bool edge::time::Manager::getTimePredConsumed( unsigned short i_tg ) {
+  // rates w.r.t. the time groups with smaller and larger time steps
+  std::size_t l_rateGt = m_timeGroups[i_tg]->getRateGt();
+  std::size_t l_rateLt = m_timeGroups[i_tg]->getRateLt();
+
   // time group with smaller time step
   bool l_left = (i_tg == 0) ?
                 true :
-                      m_timeGroups[i_tg-1]->nDofUpInner() == m_timeGroups[i_tg]->nTimePredInner()*2
-                   && m_timeGroups[i_tg-1]->nDofUpSend()  == m_timeGroups[i_tg]->nTimePredSend()*2;
+                      m_timeGroups[i_tg-1]->nDofUpInner() == m_timeGroups[i_tg]->nTimePredInner()*l_rateGt
+                   && m_timeGroups[i_tg-1]->nDofUpSend()  == m_timeGroups[i_tg]->nTimePredSend()*l_rateGt;
 
-  // time group with larger time step: last time group, odd time step, even time step (accumulated data consumed)
+  // time group with larger time step: last time group, accumulating time step, last time step of the cycle (accumulated data consumed)
   bool l_right = (i_tg == m_timeGroups.size() - 1 ) ?
-                 true :    m_timeGroups[i_tg]->getUpdatesSync()%2 == 0
-                        || (    m_timeGroups[i_tg]->nTimePredInner() == m_timeGroups[i_tg+1]->nDofUpInner()*2
-                             && m_timeGroups[i_tg]->nTimePredSend()  == m_timeGroups[i_tg+1]->nDofUpSend()*2 );
+                 true :    m_timeGroups[i_tg]->getUpdatesSync()%l_rateLt != l_rateLt-1
+                        || (    m_timeGroups[i_tg]->nTimePredInner() == m_timeGroups[i_tg+1]->nDofUpInner()*l_rateLt
+                             && m_timeGroups[i_tg]->nTimePredSend()  == m_timeGroups[i_tg+1]->nDofUpSend()*l_rateLt );
 
   return l_left && l_right;
 }
@@ -91,11 +204,29 @@ void edge::time::Manager::communicate() {
   m_distributed.comm();
 }
 
+void edge::time::Manager::progress() {
+  if( m_shared.lockSched() ) {
+    // the time groups might have finished since the last check
+    if( m_finished == false ) {
+      if( m_dagSched ) progressDag();
+      else             schedule();
+      communicate();
+    }
+    m_shared.unlockSched();
+  }
+}
+
 void edge::time::Manager::compute() {
   PP_INSTR_FUN("compute")
 
+  // task-based scheduling: idle workers take over scheduling and communication
+  bool l_tasks = m_shared.tasks();
+
   // scheduling and communicating workers have other duties, pure workers stay where they are
-  bool l_schdCmm = m_shared.isSched() || m_shared.isComm();
+  bool l_schdCmm = !l_tasks && ( m_shared.isSched() || m_shared.isComm() );
+
+  // start of the current idle phase, if profiled
+  double l_idleBeg = ( m_prof != nullptr ) ? monitor::Profiler::now() : 0;
 
   while( m_finished == false ) {
     bool l_wrk;
@@ -113,6 +244,12 @@ void edge::time::Manager::compute() {
       // set status to "in progress"
       m_shared.setStatusTd( parallel::Shared::IPR, l_id );
 
+      double l_beg = 0;
+      if( m_prof != nullptr ) {
+        l_beg = monitor::Profiler::now();
+        m_prof->addIdle( parallel::g_thread, l_beg - l_idleBeg );
+      }
+
       // compute
       PP_INSTR_REG_DEF(step)
       PP_INSTR_REG_BEG(step,"step")
@@ -126,13 +263,32 @@ void edge::time::Manager::compute() {
 
       PP_INSTR_REG_END(step)
 
-      // set status to "finished"
-      m_shared.setStatusTd( parallel::Shared::FIN, l_id );
+      if( m_prof != nullptr ) {
+        l_idleBeg = monitor::Profiler::now();
+        m_prof->addRgn( parallel::g_thread, l_id, l_st, l_size, l_idleBeg - l_beg );
+      }
+
+      // set status to "finished", the last worker of the region continues the dependency graph
+      bool l_last = m_shared.setStatusTd( parallel::Shared::FIN, l_id );
+      if( l_last && m_dagSched ) finishDag( m_dagRgns[l_id] );
     }
+    else if( l_tasks ) progress();
 
     // non-pure workers are allowed to exit
     if( l_schdCmm == true ) break;
   }
+
+  if( m_prof != nullptr ) m_prof->addIdle( parallel::g_thread, monitor::Profiler::now() - l_idleBeg );
+}
+
+void edge::time::Manager::enableDag() {
+  EDGE_CHECK( m_shared.tasks() ) << "dependency graph requires task-based scheduling";
+
+#if defined PP_T_EQUATIONS_SEISMIC
+  m_dagSched = true;
+#else
+  EDGE_LOG_WARNING << "dependency graph not defined for the equations, falling back to polling";
+#endif
 }
 
 void edge::time::Manager::simulate( double i_time ) {
@@ -160,15 +316,29 @@ void edge::time::Manager::simulate( double i_time ) {
   // we are not finished until the scheduling threads decides so
   m_finished = false;
 
+  // compile the dependency graph and release the nodes without dependencies
+  if( m_dagSched ) {
+    compileDag();
+    for( std::size_t l_ro = 0; l_ro < m_dag.roots().size(); l_ro++ ) {
+      releaseDag( m_dag.roots()[l_ro] );
+    }
+  }
+
   // jump into respective tasks
 #ifdef PP_USE_OMP
 #pragma omp parallel
 {
 #endif
   while( m_finished == false ) {
-    if( m_shared.isSched() ) schedule();
-    if( m_shared.isComm()  ) communicate();
-    if( m_shared.isWrk()   ) compute();
+    if( m_shared.tasks() ) {
+      if( m_shared.isWrk() ) compute();
+      else                   progress();
+    }
+    else {
+      if( m_shared.isSched() ) schedule();
+      if( m_shared.isComm()  ) communicate();
+      if( m_shared.isWrk()   ) compute();
+    }
   }
 #ifdef PP_USE_OMP
 }
@@ -29,7 +29,10 @@
 #include "parallel/Shared.h"
 #include "constants.hpp"
 #include "io/Receivers.h"
+#include "monitor/Profiler.h"
 #include "TimeGroupStatic.h"
+#include "Dag.h"
+#include <atomic>
 #include <vector>
 
 namespace edge {
@@ -61,6 +64,33 @@ class edge::time::Manager {
     //! true if the manager reached the desired synchronization point
     volatile bool m_finished = false;
 
+    //! true if the control flow is driven by the dependency graph
+    bool m_dagSched = false;
+
+    //! profiler of the work regions, nullptr if disabled
+    monitor::Profiler * m_prof = nullptr;
+
+    //! dependency graph of the current synchronization interval
+    Dag m_dag;
+
+    //! node which was released last for every work region
+    std::vector< std::size_t > m_dagRgns;
+
+    //! counter updates of the time groups if the work regions with the respective control flow entries finish
+    void (TimeGroupStatic::*m_dagUpdates[N_ENTRIES_CONTROL_FLOW])();
+
+    //! lock for the released serial nodes
+    std::atomic_flag m_dagSerLock = ATOMIC_FLAG_INIT;
+
+    //! released serial nodes (communication, output), executed by the thread holding the scheduling token
+    std::vector< std::size_t > m_dagSerRdy;
+
+    //! serial nodes which were taken by the thread holding the scheduling token
+    std::vector< std::size_t > m_dagSerTkn;
+
+    //! serial nodes in progress
+    std::vector< std::size_t > m_dagSerIpr;
+
     /**
      * Returns true if the time predictions of the neighboring smaller and large time group (on this rank) are available for an update.
      *
@@ -87,6 +117,38 @@ class edge::time::Manager {
      **/
     void communicate();
 
+    /**
+     * Compiles the dependency graph for the upcoming synchronization interval.
+     **/
+    void compileDag();
+
+    /**
+     * Releases a node of the dependency graph whose dependencies are met.
+     * Work regions are released to the workers, serial nodes to the thread holding the scheduling token.
+     *
+     * @param i_node node which is released.
+     **/
+    void releaseDag( std::size_t i_node );
+
+    /**
+     * Finishes a node of the dependency graph and releases the successors.
+     *
+     * @param i_node node which finished.
+     **/
+    void finishDag( std::size_t i_node );
+
+    /**
+     * Runs and tests the released serial nodes of the dependency graph.
+     * Remark: Only the thread holding the scheduling token is allowed to call this function.
+     **/
+    void progressDag();
+
+    /**
+     * Runs the scheduling and communication tasks if the calling thread obtains the scheduling token.
+     * Used in task-based scheduling, where idle threads take over these duties.
+     **/
+    void progress();
+
     /**
      * Performs computations.
      **/
@@ -113,6 +175,22 @@ class edge::time::Manager {
      **/
     ~Manager();
 
+    /**
+     * Drives the control flow by a dependency graph instead of polling.
+     * Requires task-based scheduling in the shared memory parallelization.
+     * Falls back to polling if the equations do not provide a dependency graph.
+     **/
+    void enableDag();
+
+    /**
+     * Enables profiling of the work regions and the idle times of the workers.
+     *
+     * @param io_prof initialized profiler, which accumulates the counters.
+     **/
+    void enableProfiling( monitor::Profiler & io_prof ) {
+      m_prof = &io_prof;
+    }
+
     /**
      * Advances in time for the given time.
      *
@@ -34,6 +34,7 @@
 #endif
 
 edge::time::TimeGroupStatic::TimeGroupStatic( unsigned short                   i_nTgs,
+                                              unsigned short const           * i_rates,
                                               unsigned short                   i_tgId,
                                               data::Internal                 & i_internal,
                                               unsigned short                   i_nCommBuffers,
@@ -43,17 +44,21 @@ edge::time::TimeGroupStatic::TimeGroupStatic( unsigned short                   i
   m_sendPtrs = i_sendPtrs;
   m_recvPtrs = i_recvPtrs;
 
-  // derive multiple of fundamental time step (rate-2 LTS)
+  // derive multiple of fundamental time step (integer-rate LTS)
   m_funMul = 1;
   for( unsigned short l_tg = 0; l_tg < i_tgId; l_tg++ ) {
-    m_funMul *= 2;
+    m_funMul *= i_rates[l_tg];
   }
   // derive divisor of max time step
   m_maxDiv = 1;
-  for( unsigned short l_tg = i_tgId+1; l_tg < i_nTgs; l_tg++ ) {
-    m_maxDiv *= 2;
+  for( unsigned short l_tg = i_tgId; l_tg < i_nTgs-1; l_tg++ ) {
+    m_maxDiv *= i_rates[l_tg];
   }
 
+  // rates of the adjacent time groups
+  m_rateLt = (i_tgId < i_nTgs-1) ? i_rates[i_tgId]   : 1;
+  m_rateGt = (i_tgId > 0       ) ? i_rates[i_tgId-1] : 1;
+
   m_covSimTime = 0;
   m_nTsSync = 0;
   m_nTsPer = 0;
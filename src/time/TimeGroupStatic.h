@@ -38,10 +38,16 @@ namespace edge {
 class edge::time::TimeGroupStatic {
   private:
     //! multiplier of the fundamental time step which defines the time step of this group
-    unsigned short m_funMul;
+    std::size_t m_funMul;
 
     //! divisor of the largest LTS group's time step which results in this group's time step
-    unsigned short m_maxDiv;
+    std::size_t m_maxDiv;
+
+    //! rate of the next larger time group w.r.t. this one (less-than LTS relations), 1 for the largest group
+    unsigned short m_rateLt;
+
+    //! rate of this time group w.r.t. the next smaller one (greater-than LTS relations), 1 for the smallest group
+    unsigned short m_rateGt;
 
     //! number of performend time steps since last synchronization
     volatile std::size_t m_nTsSync;
@@ -98,6 +104,7 @@ class edge::time::TimeGroupStatic {
      * Constructor.
      *
      * @param i_nTgs number of time groups.
+     * @param i_rates integer LTS rates of the time groups w.r.t. the next larger ones, 1 for the largest group.
      * @param i_tgId id of this time group.
      * @param i_internal internal data.
      * @param i_nCommBuffers number of communication buffers.
@@ -105,6 +112,7 @@ class edge::time::TimeGroupStatic {
      * @param i_recvPtrs receive pointers.
      **/
     TimeGroupStatic( unsigned short                   i_nTgs,
+                     unsigned short const           * i_rates,
                      unsigned short                   i_tgId,
                      data::Internal                 & i_internal,
                      unsigned short                   i_nCommBuffers,
@@ -188,6 +196,34 @@ class edge::time::TimeGroupStatic {
      **/
     std::size_t nRecvSync(){ return m_nRecvSync; }
 
+    /**
+     * Gets the rate of the next larger time group w.r.t. this one.
+     *
+     * @return rate of less-than LTS relations, 1 for the largest group.
+     **/
+    unsigned short getRateLt() const { return m_rateLt; }
+
+    /**
+     * Gets the rate of this time group w.r.t. the next smaller one.
+     *
+     * @return rate of greater-than LTS relations, 1 for the smallest group.
+     **/
+    unsigned short getRateGt() const { return m_rateGt; }
+
+    /**
+     * Checks if the next send completes the accumulated data of less-than LTS relations, i.e., is the last one of a cycle of the next larger group.
+     *
+     * @return true if sends for less-than LTS relations are due.
+     **/
+    bool sendLt() const { return m_nSendSync%m_rateLt == m_rateLt-1u; }
+
+    /**
+     * Checks if the next receive starts a cycle of the next larger group, which delivers the data of less-than LTS relations.
+     *
+     * @return true if receives for less-than LTS relations are due.
+     **/
+    bool recvLt() const { return m_nRecvSync%m_rateLt == 0; }
+
     /**
      * Updates the time step info.
      **/
@@ -208,6 +244,13 @@ class edge::time::TimeGroupStatic {
                       int_el         const * i_enSp,
                       io::Receivers        & io_recvs );
 
+    /**
+     * Gets the number of updates the time group performs between the last and the next synchronization.
+     *
+     * @return number of updates in the synchronization interval.
+     **/
+    std::size_t getUpdatesReqSync() const { return m_nTsReqFull + m_maxDiv; }
+
     /**
      * Gets the number of updates the time group performed since the last synchronization.
      *
@@ -229,6 +272,18 @@ class edge::time::TimeGroupStatic {
      **/
     double getCovSimTime() { return m_covSimTime; };
 
+    /**
+     * Restores the persistent counters of the time group, e.g., when restarting from a checkpoint.
+     *
+     * @param i_nTsPer number of performed updates.
+     * @param i_covSimTime covered simulation time.
+     **/
+    void restore( std::size_t i_nTsPer,
+                  double      i_covSimTime ) {
+      m_nTsPer = i_nTsPer;
+      m_covSimTime = i_covSimTime;
+    }
+
     /**
      * Checks if the time group is performing its last time step
      *
@@ -0,0 +1,82 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Tests the LTS time groups.
+ **/
+#include <catch.hpp>
+#include "TimeGroupStatic.h"
+
+TEST_CASE( "Tests the setup of integer-rate LTS time groups.", "[TimeGroupStatic][rates]" ) {
+  edge::data::Internal l_internal;
+
+  // rates w.r.t. the next larger time groups: 0 -> 1: 3, 1 -> 2: 2
+  unsigned short l_rates[3] = { 3, 2, 1 };
+
+  edge::time::TimeGroupStatic l_tg0( 3, l_rates, 0, l_internal, 1, nullptr, nullptr );
+  edge::time::TimeGroupStatic l_tg1( 3, l_rates, 1, l_internal, 1, nullptr, nullptr );
+  edge::time::TimeGroupStatic l_tg2( 3, l_rates, 2, l_internal, 1, nullptr, nullptr );
+
+  REQUIRE( l_tg0.getRateLt() == 3 );
+  REQUIRE( l_tg0.getRateGt() == 1 );
+  REQUIRE( l_tg1.getRateLt() == 2 );
+  REQUIRE( l_tg1.getRateGt() == 3 );
+  REQUIRE( l_tg2.getRateLt() == 1 );
+  REQUIRE( l_tg2.getRateGt() == 2 );
+
+  // two full time steps of the largest group and a shorter synchronization step
+  l_tg0.setUp( 0.1, 1.3 );
+  l_tg1.setUp( 0.1, 1.3 );
+  l_tg2.setUp( 0.1, 1.3 );
+
+  REQUIRE( l_tg0.getUpdatesReqSync() == 18 );
+  REQUIRE( l_tg1.getUpdatesReqSync() ==  6 );
+  REQUIRE( l_tg2.getUpdatesReqSync() ==  3 );
+
+  // full time steps of the groups
+  l_tg0.updateTsInfo();
+  l_tg1.updateTsInfo();
+  l_tg2.updateTsInfo();
+  REQUIRE( l_tg0.getCovSimTime() == Approx( 0.1 ) );
+  REQUIRE( l_tg1.getCovSimTime() == Approx( 0.3 ) );
+  REQUIRE( l_tg2.getCovSimTime() == Approx( 0.6 ) );
+
+  // the time groups reach the synchronization point together
+  while( !l_tg0.finished() ) l_tg0.updateTsInfo();
+  while( !l_tg1.finished() ) l_tg1.updateTsInfo();
+  while( !l_tg2.finished() ) l_tg2.updateTsInfo();
+
+  REQUIRE( l_tg0.getCovSimTime() == Approx( 1.3 ) );
+  REQUIRE( l_tg1.getCovSimTime() == Approx( 1.3 ) );
+  REQUIRE( l_tg2.getCovSimTime() == Approx( 1.3 ) );
+
+  // less-than LTS relations: data is sent in the last and received in the first time step of every cycle
+  for( unsigned short l_ts = 0; l_ts < 6; l_ts++ ) {
+    REQUIRE( l_tg0.sendLt() == (l_ts%3 == 2) );
+    REQUIRE( l_tg0.recvLt() == (l_ts%3 == 0) );
+    REQUIRE( l_tg1.sendLt() == (l_ts%2 == 1) );
+    REQUIRE( l_tg1.recvLt() == (l_ts%2 == 0) );
+    REQUIRE( l_tg2.sendLt() );
+    REQUIRE( l_tg2.recvLt() );
+
+    l_tg0.updateSend(); l_tg0.updateRecv();
+    l_tg1.updateSend(); l_tg1.updateRecv();
+    l_tg2.updateSend(); l_tg2.updateRecv();
+  }
+}
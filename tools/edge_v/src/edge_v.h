@@ -26,6 +26,7 @@
 #include "io/Gmsh.h"
 #include "io/Hdf5.h"
 #include "mesh/Mesh.h"
+#include "mesh/Reordering.h"
 #include "models/Constant.h"
 #include "models/Model.h"
 #include "time/Cfl.h"
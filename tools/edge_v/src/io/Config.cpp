@@ -39,13 +39,17 @@ edge_v::io::Config::Config( std::string & i_xml ) {
   m_meshOut[0] = l_mesh.child("files").child("out").child("base").text().as_string();
   m_meshOut[1] = l_mesh.child("files").child("out").child("extension").text().as_string();
   m_writeElAn = l_mesh.child("write_element_annotations").text().as_bool();
+  m_writeBin = l_mesh.child("write_binary").text().as_bool();
   if( l_mesh.child("periodic") ) {
     int l_periodic = l_mesh.child("periodic").text().as_int();
     if( l_periodic > 0 ) m_periodic = l_periodic;
   }
   m_reorderOnly = l_mesh.child("reorder_only").text().as_bool();
+  m_elOrder = l_mesh.child("element_order").text().as_string();
+  EDGE_V_CHECK( m_elOrder == "" || m_elOrder == "morton" || m_elOrder == "rcm" ) << "unknown element order: " << m_elOrder;
   m_nPartitions = l_mesh.child("n_partitions").text().as_ullong();
   m_nPartitions = std::max( m_nPartitions, std::size_t(1) );
+  m_multiCon = l_mesh.child("multi_constraint").text().as_bool( true );
 
   // read velocity model
   pugi::xml_node l_velMod = l_doc.child("edge_v").child("velocity_model");
@@ -83,6 +87,10 @@ edge_v::io::Config::Config( std::string & i_xml ) {
     m_tsunami.disp.push_back( l_disp.text().as_string() );
   }
   m_tsunami.expr = l_tsunami.child("expression").text().as_string();
+  m_tsunami.tileSize = l_tsunami.child("grid").child("tile_size").text().as_ullong( m_tsunami.tileSize );
+  m_tsunami.nCacheTiles = l_tsunami.child("grid").child("n_cache_tiles").text().as_ullong( m_tsunami.nCacheTiles );
+  EDGE_V_CHECK_GT( m_tsunami.tileSize, 0 );
+  EDGE_V_CHECK_GT( m_tsunami.nCacheTiles, 0 );
 
   // mesh refinement
   pugi::xml_node l_ref = l_doc.child("edge_v").child("refinement");
@@ -93,5 +101,22 @@ edge_v::io::Config::Config( std::string & i_xml ) {
   pugi::xml_node l_time = l_doc.child("edge_v").child("time");
   m_nTsGroups = std::max( l_time.child("n_groups").text().as_uint(), 1u );
   m_funDt     = l_time.child("fundamental_time_step").text().as_double();
+
+  // integer LTS rates: none (rate-2), a single one for all groups or one per pair of adjacent groups
+  std::vector< unsigned short > l_rates;
+  for( pugi::xml_node l_rate = l_time.child("rate"); l_rate; l_rate = l_rate.next_sibling("rate") ) {
+    unsigned int l_ra = l_rate.text().as_uint();
+    EDGE_V_CHECK_GE( l_ra, 2 ) << "LTS rates have to be integers >= 2";
+    l_rates.push_back( l_ra );
+  }
+  EDGE_V_CHECK( l_rates.size() <= 1 || l_rates.size() == m_nTsGroups-1u )
+    << "expected one rate or " << m_nTsGroups-1 << " rates, got " << l_rates.size();
+
+  m_tsRates.resize( m_nTsGroups-1 );
+  for( unsigned short l_tg = 0; l_tg < m_nTsGroups-1; l_tg++ ) {
+    if(      l_rates.size() == 0 ) m_tsRates[l_tg] = 2;
+    else if( l_rates.size() == 1 ) m_tsRates[l_tg] = l_rates[0];
+    else                           m_tsRates[l_tg] = l_rates[l_tg];
+  }
   m_tsOut     = l_time.child("files").child("out").child("time_steps").text().as_string();
 }
\ No newline at end of file
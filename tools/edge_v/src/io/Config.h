@@ -73,6 +73,10 @@ class edge_v::io::Config {
       std::vector< std::string > disp;
       //! expression which is evaluated
       std::string expr = "";
+      //! number of grid cells per tile and dimension when sampling the grids
+      std::size_t tileSize = 512;
+      //! maximum number of cached tiles when sampling the grids
+      std::size_t nCacheTiles = 256;
     } m_tsunami;
 
     //! mesh refinement parameters
@@ -84,15 +88,24 @@ class edge_v::io::Config {
     //! writes element annotations if true
     bool m_writeElAn = false;
 
+    //! writes binary partitions if true
+    bool m_writeBin = false;
+
     //! periodic boundary conditions
     int m_periodic = std::numeric_limits< int >::max();
 
     //! number of partitions to derive
     std::size_t m_nPartitions = 1;
 
+    //! if true, the partitioning uses one balance constraint per time group
+    bool m_multiCon = true;
+
     //! if true the mesh-entities are reordered but the mesh is not partitioned.
     bool m_reorderOnly = false;
 
+    //! order of the elements within the blocks of a partition's time groups: "", "morton" or "rcm"
+    std::string m_elOrder = "";
+
     //! path to the output-csv for the time steps
     std::string m_tsOut = "";
 
@@ -102,6 +115,9 @@ class edge_v::io::Config {
     //! relative minimum time step
     double m_funDt = 0;
 
+    //! integer rates of the time step groups w.r.t. the next smaller ones
+    std::vector< unsigned short > m_tsRates;
+
   public:
     /**
      * Constructor.
@@ -220,12 +236,26 @@ class edge_v::io::Config {
     /**
      * Gets the expression which determines the velocities in the tsunami model.
      * Input variables are "x" and "y" the coordinates of a queried point.
-     * Further "data" is the height of the closest-by data point in the bathymetry grid.
+     * Further "data" is the height in the bathymetry grid, bilinearly interpolated at the point.
      *
      * @return expression.
      **/
     std::string const & getModTsunamiExpr() const { return m_tsunami.expr; }
 
+    /**
+     * Gets the tile size used when sampling the grids of the tsunami model.
+     *
+     * @return number of grid cells per tile and dimension.
+     **/
+    std::size_t getModTsunamiTileSize() const { return m_tsunami.tileSize; }
+
+    /**
+     * Gets the capacity of the tile cache used when sampling the grids of the tsunami model.
+     *
+     * @return maximum number of cached tiles.
+     **/
+    std::size_t getModTsunamiNCacheTiles() const { return m_tsunami.nCacheTiles; }
+
     /**
      * Gets the expression of the mesh refinement.
      *
@@ -254,6 +284,13 @@ class edge_v::io::Config {
      **/
     bool getWriteElAn() const { return m_writeElAn; }
 
+    /**
+     * Gets the configuration for binary partitions, which are written in addition to the Gmsh partitions.
+     *
+     * @return true if binary partitions are written.
+     **/
+    bool getWriteBin() const { return m_writeBin; }
+
     /**
      * Gets the number of partitions in the output mesh.
      *
@@ -261,6 +298,13 @@ class edge_v::io::Config {
      **/
     std::size_t nPartitions() const { return m_nPartitions; }
 
+    /**
+     * Gets the multi-constraint setting of the partitioning.
+     *
+     * @return true if every time group is balanced separately.
+     **/
+    bool getMultiCon() const { return m_multiCon; }
+
     /**
      * Gets the configuration of the reorder-only setting.
      *
@@ -268,6 +312,13 @@ class edge_v::io::Config {
      **/
     bool getReorderOnly() const { return m_reorderOnly; }
 
+    /**
+     * Gets the order of the elements within the blocks of a partition's time groups.
+     *
+     * @return "morton" (space-filling curve), "rcm" (reverse Cuthill-McKee) or "" (unspecified).
+     **/
+    std::string const & getElOrder() const { return m_elOrder; }
+
     /**
      * Gets the the number of time step groups.
      *
@@ -282,6 +333,13 @@ class edge_v::io::Config {
      **/
     double getFunDt() const { return m_funDt; }
 
+    /**
+     * Gets the integer rates of the time step groups, i.e., the ratios of the groups' time steps to the ones of the next smaller groups.
+     *
+     * @return rates, one for every pair of adjacent time step groups.
+     **/
+    std::vector< unsigned short > const & getTsRates() const { return m_tsRates; }
+
     /**
      * Gets the output file for the time steps of the elements.
      *
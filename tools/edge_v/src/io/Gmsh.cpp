@@ -373,7 +373,8 @@ void edge_v::io::Gmsh::getFaVe( int     i_physicalGroupFa,
   }
 }
 
-void edge_v::io::Gmsh::reorder( t_idx const * i_priorities ) {
+void edge_v::io::Gmsh::reorder( t_idx const * i_priorities,
+                                t_idx const * i_keys ) {
   // derive the permutation based on the priorities
   std::vector< std::size_t > l_elPerm;
   l_elPerm.resize( m_elTags.size() );
@@ -383,7 +384,9 @@ void edge_v::io::Gmsh::reorder( t_idx const * i_priorities ) {
   std::sort( l_elPerm.begin(),
              l_elPerm.end(),
              [&]( std::size_t const & i_e0, std::size_t const & i_e1 )  {
-               return (i_priorities[i_e0] < i_priorities[i_e1]); });
+               if( i_priorities[i_e0] != i_priorities[i_e1] ) return (i_priorities[i_e0] < i_priorities[i_e1]);
+               if( i_keys != nullptr && i_keys[i_e0] != i_keys[i_e1] ) return (i_keys[i_e0] < i_keys[i_e1]);
+               return (i_e0 < i_e1); });
 
   // perform the reordering within gmsh
   t_entityType l_elTy = getElType();
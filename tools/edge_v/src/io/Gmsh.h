@@ -204,10 +204,13 @@ class edge_v::io::Gmsh {
 
     /**
      * Reorders the elements based on the given priorities.
+     * Elements with equal priority are sorted by the optional keys.
      *
      * @param i_priorities priorities of the elements (lower is higher, sorted first).
+     * @param i_keys keys of the elements, used to order elements with equal priority; nullptr if not used.
      **/
-    void reorder( t_idx const * i_priorities );
+    void reorder( t_idx const * i_priorities,
+                  t_idx const * i_keys = nullptr );
 
     /**
      * Partitions the mesh.
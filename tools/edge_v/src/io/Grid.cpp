@@ -21,13 +21,22 @@
  * Grid holding input data.
  **/
 #include "Grid.h"
+#include <algorithm>
+
+edge_v::io::Grid::Grid( io::Hdf5 const * i_reader,
+                        t_idx            i_tileSize,
+                        std::size_t      i_nCacheTiles ) {
+  EDGE_V_CHECK_GT( i_tileSize, 0 );
+  EDGE_V_CHECK_GT( i_nCacheTiles, 0 );
 
-edge_v::io::Grid::Grid( io::Hdf5 const * i_reader ) {
   m_reader = i_reader;
+  m_tileSize = i_tileSize;
+  m_nCacheTiles = i_nCacheTiles;
 }
 
 void edge_v::io::Grid::free() {
   if( m_data != nullptr ) delete[] m_data;
+  m_data = nullptr;
 }
 
 edge_v::io::Grid::~Grid() {
@@ -35,66 +44,190 @@ edge_v::io::Grid::~Grid() {
   free();
 }
 
-void edge_v::io::Grid::init( t_idx             i_nPts,
-                             double   const (* i_pts)[3],
-                             io::Hdf5 const  * i_reader,
-                             float           * o_data ) {
+std::uint64_t edge_v::io::Grid::morton( t_idx i_tx,
+                                        t_idx i_ty ) {
+  std::uint64_t l_code = 0;
+  for( unsigned short l_bi = 0; l_bi < 32; l_bi++ ) {
+    l_code |= ( (std::uint64_t(i_tx) >> l_bi) & 1 ) << (2*l_bi);
+    l_code |= ( (std::uint64_t(i_ty) >> l_bi) & 1 ) << (2*l_bi + 1);
+  }
+  return l_code;
+}
+
+float edge_v::io::Grid::interpolate( double const   i_pt[3],
+                                     t_idx  const   i_cell[2],
+                                     double const * i_x,
+                                     double const * i_y,
+                                     t_tile const & i_tile ) {
+  // weights of the upper grid points
+  double l_wx = (i_pt[0] - i_x[ i_cell[0] ]) / (i_x[ i_cell[0]+1 ] - i_x[ i_cell[0] ]);
+  double l_wy = (i_pt[1] - i_y[ i_cell[1] ]) / (i_y[ i_cell[1]+1 ] - i_y[ i_cell[1] ]);
+
+  // tile-local ids of the lower-left grid point
+  t_idx l_ro = i_cell[1] - i_tile.first[0];
+  t_idx l_co = i_cell[0] - i_tile.first[1];
+  float const * l_z0 = i_tile.data.data() + l_ro * i_tile.size[1] + l_co;
+  float const * l_z1 = l_z0 + i_tile.size[1];
+
+  double l_val  = (1-l_wy) * ( (1-l_wx) * l_z0[0] + l_wx * l_z0[1] );
+         l_val +=    l_wy  * ( (1-l_wx) * l_z1[0] + l_wx * l_z1[1] );
+
+  return l_val;
+}
+
+std::shared_ptr< edge_v::io::Grid::t_tile const > edge_v::io::Grid::getTile( t_idx i_tx,
+                                                                              t_idx i_ty,
+                                                                              t_idx i_nx,
+                                                                              t_idx i_ny ) {
+  t_idx l_nTx = (i_nx - 2) / m_tileSize + 1;
+  t_idx l_key = i_ty * l_nTx + i_tx;
+
+  std::shared_ptr< t_tile const > l_tile;
+
+  // the cache and the serial HDF5-library are shared by all threads
+#ifdef PP_USE_OMP
+#pragma omp critical (edge_v_io_grid_tile)
+#endif
+  {
+    auto l_it = m_cache.find( l_key );
+
+    if( l_it != m_cache.end() ) {
+      // move to the front of the LRU list
+      m_lru.splice( m_lru.begin(),
+                    m_lru,
+                    l_it->second.second );
+      l_tile = l_it->second.first;
+    }
+    else {
+      // read the tile, which overlaps by one grid point with the next ones
+      std::shared_ptr< t_tile > l_new = std::make_shared< t_tile >();
+      l_new->first[0] = i_ty * m_tileSize;
+      l_new->first[1] = i_tx * m_tileSize;
+      l_new->size[0] = std::min( m_tileSize+1, i_ny - l_new->first[0] );
+      l_new->size[1] = std::min( m_tileSize+1, i_nx - l_new->first[1] );
+      l_new->data.resize( l_new->size[0] * l_new->size[1] );
+
+      m_reader->get( "/z",
+                     i_nx,
+                     l_new->first,
+                     l_new->size,
+                     l_new->data.data() );
+
+      // insert and evict the least recently used tile if the cache is full
+      m_lru.push_front( l_key );
+      m_cache[l_key] = std::make_pair( std::shared_ptr< t_tile const >( l_new ),
+                                       m_lru.begin() );
+      if( m_cache.size() > m_nCacheTiles ) {
+        m_cache.erase( m_lru.back() );
+        m_lru.pop_back();
+      }
+
+      l_tile = l_new;
+    }
+  }
+
+  return l_tile;
+}
+
+void edge_v::io::Grid::init( t_idx           i_nPts,
+                             double const (* i_pts)[3] ) {
+  // free memory if allocated
+  free();
+
   // get the number of x- and y-values
-  t_idx l_nx = i_reader->nVas("/x");
-  t_idx l_ny = i_reader->nVas("/y");
-  t_idx l_nz = i_reader->nVas("/z");
+  t_idx l_nx = m_reader->nVas("/x");
+  t_idx l_ny = m_reader->nVas("/y");
+  t_idx l_nz = m_reader->nVas("/z");
 
   // check sanity
-  EDGE_V_CHECK_GT( l_nz, 0 );
+  EDGE_V_CHECK_GT( l_nx, 1 );
+  EDGE_V_CHECK_GT( l_ny, 1 );
+  EDGE_V_CHECK_GE( l_nz, l_nx * l_ny );
   EDGE_V_CHECK_EQ( l_nz % l_nx, 0 );
   EDGE_V_CHECK_EQ( l_nz % l_ny, 0 );
 
-  // read the coordinates
+  // read the coordinates, the data is read in tiles
   double * l_x = new double[ l_nx ];
   double * l_y = new double[ l_ny ];
-  float  * l_z = new float[  l_nz ];
 
-  i_reader->get( "/x",
+  m_reader->get( "/x",
                  l_x );
 
-  i_reader->get( "/y",
+  m_reader->get( "/y",
                  l_y );
 
-  i_reader->get( "/z",
-                 l_z );
-
-  // iterate over all pts and query
-  for( t_idx l_pt = 0; l_pt < i_nPts; l_pt++ ) {
-    // get grid id
-    t_idx l_id0 = std::lower_bound( l_y, l_y + l_ny, i_pts[l_pt][1] ) - l_y;
-    t_idx l_id1 = std::lower_bound( l_x, l_x + l_nx, i_pts[l_pt][0] ) - l_x;
-    t_idx l_id = l_id0 * l_nx + l_id1;
-
-    // check that the point is within the grid
-    EDGE_V_CHECK_GT( i_pts[l_pt][0], l_x[0] );
-    EDGE_V_CHECK_GT( i_pts[l_pt][1], l_y[0] );
-    EDGE_V_CHECK_LT( l_id1, l_nx );
-    EDGE_V_CHECK_LT( l_id0, l_ny );
+  m_data = new float[i_nPts];
 
-    o_data[l_pt] = l_z[l_id];
+  // cells, tile codes and order of the points in a chunk
+  t_idx l_chunkSize = std::min( m_chunkSize, i_nPts );
+  t_idx (*l_cells)[2] = new t_idx[ l_chunkSize ][2];
+  std::uint64_t * l_codes = new std::uint64_t[ l_chunkSize ];
+  t_idx * l_order = new t_idx[ l_chunkSize ];
+  std::vector< t_idx > l_runs;
+
+  for( t_idx l_first = 0; l_first < i_nPts; l_first += l_chunkSize ) {
+    t_idx l_nChPts = std::min( l_chunkSize, i_nPts - l_first );
+    double const (* l_pts)[3] = i_pts + l_first;
+
+    // determine the grid cells and tiles of the points
+#ifdef PP_USE_OMP
+#pragma omp parallel for
+#endif
+    for( t_idx l_pt = 0; l_pt < l_nChPts; l_pt++ ) {
+      t_idx l_id0 = std::lower_bound( l_y, l_y + l_ny, l_pts[l_pt][1] ) - l_y;
+      t_idx l_id1 = std::lower_bound( l_x, l_x + l_nx, l_pts[l_pt][0] ) - l_x;
+
+      // check that the point is within the grid
+      EDGE_V_CHECK_GT( l_pts[l_pt][0], l_x[0] );
+      EDGE_V_CHECK_GT( l_pts[l_pt][1], l_y[0] );
+      EDGE_V_CHECK_LT( l_id1, l_nx );
+      EDGE_V_CHECK_LT( l_id0, l_ny );
+
+      l_cells[l_pt][0] = l_id1 - 1;
+      l_cells[l_pt][1] = l_id0 - 1;
+      l_codes[l_pt] = morton( l_cells[l_pt][0] / m_tileSize,
+                              l_cells[l_pt][1] / m_tileSize );
+      l_order[l_pt] = l_pt;
+    }
+
+    // sort the points by the Morton order of their tiles
+    std::sort( l_order,
+               l_order + l_nChPts,
+               [l_codes]( t_idx i_pt0, t_idx i_pt1 ) { return l_codes[i_pt0] < l_codes[i_pt1]; } );
+
+    // derive the runs of points sharing a tile
+    l_runs.clear();
+    for( t_idx l_pt = 0; l_pt < l_nChPts; l_pt++ ) {
+      if( l_pt == 0 || l_codes[ l_order[l_pt] ] != l_codes[ l_order[l_pt-1] ] ) l_runs.push_back( l_pt );
+    }
+    l_runs.push_back( l_nChPts );
+
+    // sample the points tile by tile
+#ifdef PP_USE_OMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for( std::size_t l_ru = 0; l_ru < l_runs.size()-1; l_ru++ ) {
+      t_idx l_pt0 = l_order[ l_runs[l_ru] ];
+      std::shared_ptr< t_tile const > l_tile = getTile( l_cells[l_pt0][0] / m_tileSize,
+                                                        l_cells[l_pt0][1] / m_tileSize,
+                                                        l_nx,
+                                                        l_ny );
+
+      for( t_idx l_id = l_runs[l_ru]; l_id < l_runs[l_ru+1]; l_id++ ) {
+        t_idx l_pt = l_order[l_id];
+        m_data[l_first + l_pt] = interpolate( l_pts[l_pt],
+                                              l_cells[l_pt],
+                                              l_x,
+                                              l_y,
+                                              *l_tile );
+      }
+    }
   }
 
   // free temporary memory
+  delete[] l_order;
+  delete[] l_codes;
+  delete[] l_cells;
   delete[] l_x;
   delete[] l_y;
-  delete[] l_z;
-}
-
-void edge_v::io::Grid::init( t_idx           i_nPts,
-                             double const (* i_pts)[3] ) {
-
-  // free memory if allocated
-  free();
-
-  // read bathymetry data
-  m_data = new float[i_nPts];
-  init( i_nPts,
-        i_pts,
-        m_reader,
-        m_data );
 }
\ No newline at end of file
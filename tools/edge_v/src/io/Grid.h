@@ -24,6 +24,11 @@
 #define EDGE_V_IO_GRID_H
 
 #include "Hdf5.h"
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace edge_v {
   namespace io {
@@ -33,40 +38,103 @@ namespace edge_v {
 
 /**
  * Grid hoding input data.
+ *
+ * The grid is given by the coordinates /x and /y, and the row-major data /z with one row per y-coordinate.
+ * /z is read out-of-core in tiles, which are kept in a least-recently-used cache.
+ * Points are sampled through bilinear interpolation in Morton order of the tiles.
  **/
 class edge_v::io::Grid {
   private:
+    //! tile of the grid's data
+    typedef struct {
+      //! first row and first column of the tile
+      t_idx first[2];
+      //! number of rows and columns of the tile
+      t_idx size[2];
+      //! data of the tile (row-major)
+      std::vector< float > data;
+    } t_tile;
+
     //! data
     float * m_data = nullptr;
 
     //! hdf5-reader
     io::Hdf5 const * m_reader = nullptr;
 
+    //! number of grid cells per tile and dimension
+    t_idx m_tileSize = 512;
+
+    //! maximum number of tiles in the cache
+    std::size_t m_nCacheTiles = 256;
+
+    //! number of points, which are sorted and sampled at once
+    t_idx m_chunkSize = t_idx(1) << 24;
+
+    //! cached tiles, most recently used first
+    std::list< t_idx > m_lru;
+
+    //! cached tiles and their position in the LRU list
+    std::unordered_map< t_idx,
+                        std::pair< std::shared_ptr< t_tile const >,
+                                   std::list< t_idx >::iterator > > m_cache;
+
     /**
      * Frees the memory.
      **/
     void free();
 
     /**
-     * Inits the data-array at the given points from the given reader.
+     * Derives the Morton code (Z-order) of a tile by interleaving 32 bits per dimension.
      *
-     * @param i_nPts number of points.
-     * @param i_pts coordinates of the points. The third coordinate of every point is ignored.
-     * @param i_reader reader which is used to get the data.
-     * @param o_data data-array which will be initialized.
+     * @param i_tx column of the tile.
+     * @param i_ty row of the tile.
+     * @return Morton code.
+     **/
+    static std::uint64_t morton( t_idx i_tx,
+                                 t_idx i_ty );
+
+    /**
+     * Bilinearly interpolates the data of a tile at the given point.
+     *
+     * @param i_pt coordinates of the point. The third coordinate is ignored.
+     * @param i_cell column and row of the grid cell containing the point.
+     * @param i_x x-coordinates of the grid.
+     * @param i_y y-coordinates of the grid.
+     * @param i_tile tile containing the grid cell.
+     * @return interpolated value.
+     **/
+    static float interpolate( double const   i_pt[3],
+                              t_idx  const   i_cell[2],
+                              double const * i_x,
+                              double const * i_y,
+                              t_tile const & i_tile );
+
+    /**
+     * Gets a tile from the cache, reads it if not present.
+     * The tile spans the grid points [i_tx*ts, (i_tx+1)*ts] x [i_ty*ts, (i_ty+1)*ts] with the tile size ts, clamped to the grid.
+     *
+     * @param i_tx column of the tile.
+     * @param i_ty row of the tile.
+     * @param i_nx number of x-coordinates in the grid.
+     * @param i_ny number of y-coordinates in the grid.
+     * @return tile.
      **/
-    static void init( t_idx             i_nPts,
-                      double   const (* i_pts)[3],
-                      io::Hdf5 const  * i_reader,
-                      float           * o_data );
+    std::shared_ptr< t_tile const > getTile( t_idx i_tx,
+                                             t_idx i_ty,
+                                             t_idx i_nx,
+                                             t_idx i_ny );
 
   public:
     /**
      * Constructor.
      *
      * @param i_reader hdf5 reader.
+     * @param i_tileSize number of grid cells per tile and dimension.
+     * @param i_nCacheTiles maximum number of tiles, which are cached.
      */
-    Grid( io::Hdf5 const * i_reader );
+    Grid( io::Hdf5 const * i_reader,
+          t_idx            i_tileSize = 512,
+          std::size_t      i_nCacheTiles = 256 );
 
     /**
      * Destructor.
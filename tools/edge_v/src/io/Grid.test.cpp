@@ -0,0 +1,105 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (alex.breuer AT uni-jena.de)
+ *
+ * @section LICENSE
+ * Copyright (c) 2020, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Tests the grid holding input data.
+ **/
+#include <catch.hpp>
+#include <cstdio>
+#define private public
+#include "Grid.h"
+#undef private
+
+TEST_CASE( "Tests the tiled sampling of the grid.", "[grid][init]" ) {
+  // non-uniform grid with 5 x- and 4 y-coordinates
+  double l_x[5] = { 0.0, 1.0, 1.5, 3.0, 4.0 };
+  double l_y[4] = { -2.0, 0.0, 0.5, 2.0 };
+
+  // bilinear data, which is reproduced exactly by the interpolation
+  auto l_fun = []( double i_x, double i_y ) { return 1.0 + 2.0*i_x - 3.0*i_y + 0.5*i_x*i_y; };
+  float l_z[4*5];
+  for( unsigned short l_ro = 0; l_ro < 4; l_ro++ ) {
+    for( unsigned short l_co = 0; l_co < 5; l_co++ ) {
+      l_z[l_ro*5 + l_co] = l_fun( l_x[l_co], l_y[l_ro] );
+    }
+  }
+
+  std::string l_path = std::tmpnam(nullptr);
+  {
+    edge_v::io::Hdf5 l_hdf( l_path,
+                            false );
+    l_hdf.set( "/x", 5, l_x );
+    l_hdf.set( "/y", 4, l_y );
+    l_hdf.set( "/z", 4*5, l_z );
+  }
+
+  // points covering all cells, including the upper boundaries
+  double l_pts[12][3] = { { 0.1,  -1.9, 0 },
+                          { 3.9,   1.9, 0 },
+                          { 1.2,  -1.0, 7 },
+                          { 4.0,   2.0, 0 },
+                          { 2.0,   0.25, 0 },
+                          { 0.5,   1.0, 0 },
+                          { 3.5,  -0.5, 0 },
+                          { 1.5,   0.5, 0 },
+                          { 0.7,   0.1, 0 },
+                          { 2.9,   1.2, 0 },
+                          { 3.1,  -1.5, 0 },
+                          { 1.0,   0.0, 0 } };
+
+  // tiles of a single cell with a cache of two tiles, three points per chunk
+  edge_v::io::Hdf5 l_hdf( l_path );
+  edge_v::io::Grid l_grid( &l_hdf,
+                           1,
+                           2 );
+  l_grid.m_chunkSize = 3;
+  l_grid.init( 12,
+               l_pts );
+
+  for( unsigned short l_pt = 0; l_pt < 12; l_pt++ ) {
+    REQUIRE( l_grid.getData()[l_pt] == Approx( l_fun( l_pts[l_pt][0], l_pts[l_pt][1] ) ) );
+  }
+  REQUIRE( l_grid.m_cache.size() == 2 );
+  REQUIRE( l_grid.m_lru.size() == 2 );
+
+  // larger tiles, single chunk and reinitialization
+  edge_v::io::Grid l_grid2( &l_hdf,
+                            2,
+                            8 );
+  l_grid2.init( 6,
+                l_pts );
+  l_grid2.init( 12,
+                l_pts );
+
+  for( unsigned short l_pt = 0; l_pt < 12; l_pt++ ) {
+    REQUIRE( l_grid2.getData()[l_pt] == Approx( l_fun( l_pts[l_pt][0], l_pts[l_pt][1] ) ) );
+  }
+  REQUIRE( l_grid2.m_cache.size() == 4 );
+
+  std::remove( l_path.c_str() );
+}
+
+TEST_CASE( "Tests the Morton codes of the tiles.", "[grid][morton]" ) {
+  REQUIRE( edge_v::io::Grid::morton( 0, 0 ) == 0 );
+  REQUIRE( edge_v::io::Grid::morton( 1, 0 ) == 1 );
+  REQUIRE( edge_v::io::Grid::morton( 0, 1 ) == 2 );
+  REQUIRE( edge_v::io::Grid::morton( 1, 1 ) == 3 );
+  REQUIRE( edge_v::io::Grid::morton( 2, 0 ) == 4 );
+  REQUIRE( edge_v::io::Grid::morton( 3, 5 ) == 39 );
+}
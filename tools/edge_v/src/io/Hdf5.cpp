@@ -247,4 +247,68 @@ void edge_v::io::Hdf5::get( std::string const & i_name,
   get( i_name,
        H5T_NATIVE_DOUBLE,
        o_data );
+}
+
+void edge_v::io::Hdf5::get( std::string const & i_name,
+                            t_idx               i_nCols,
+                            t_idx       const   i_first[2],
+                            t_idx       const   i_size[2],
+                            float             * o_data ) const {
+  EDGE_V_CHECK_LE( i_size[1], i_nCols );
+
+  // open dataset and get its space
+  hid_t l_dset = H5Dopen2( m_fileId,
+                           i_name.c_str(),
+                           H5P_DEFAULT );
+  EDGE_V_CHECK_GE( l_dset, 0 );
+
+  hid_t l_fSpace = H5Dget_space( l_dset );
+  EDGE_V_CHECK_GE( l_fSpace, 0 );
+
+  int l_nDims = H5Sget_simple_extent_ndims( l_fSpace );
+  EDGE_V_CHECK( l_nDims == 1 || l_nDims == 2 ) << "unsupported number of dimensions: " << l_nDims;
+
+  // select the block: strided in the one-dimensional case, regular otherwise
+  hsize_t l_start[2]  = { i_first[0], i_first[1] };
+  hsize_t l_stride[2] = { 1, 1 };
+  hsize_t l_count[2]  = { i_size[0], i_size[1] };
+  hsize_t l_block[2]  = { 1, 1 };
+  if( l_nDims == 1 ) {
+    l_start[0]  = hsize_t(i_first[0]) * i_nCols + i_first[1];
+    l_stride[0] = i_nCols;
+    l_count[0]  = i_size[0];
+    l_block[0]  = i_size[1];
+  }
+
+  herr_t l_err = H5Sselect_hyperslab( l_fSpace,
+                                      H5S_SELECT_SET,
+                                      l_start,
+                                      l_stride,
+                                      l_count,
+                                      l_block );
+  EDGE_V_CHECK_GE( l_err, 0 );
+
+  // contiguous memory space of the block
+  hsize_t l_nVas = hsize_t(i_size[0]) * i_size[1];
+  hid_t l_mSpace = H5Screate_simple( 1,
+                                     &l_nVas,
+                                     NULL );
+  EDGE_V_CHECK_GE( l_mSpace, 0 );
+
+  // read data
+  l_err = H5Dread( l_dset,
+                   H5T_NATIVE_FLOAT,
+                   l_mSpace,
+                   l_fSpace,
+                   H5P_DEFAULT,
+                   o_data );
+  EDGE_V_CHECK_GE( l_err, 0 );
+
+  // close spaces and set
+  l_err = H5Sclose( l_mSpace );
+  EDGE_V_CHECK_GE( l_err, 0 );
+  l_err = H5Sclose( l_fSpace );
+  EDGE_V_CHECK_GE( l_err, 0 );
+  l_err = H5Dclose( l_dset );
+  EDGE_V_CHECK_GE( l_err, 0 );
 }
\ No newline at end of file
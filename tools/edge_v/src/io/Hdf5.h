@@ -221,6 +221,22 @@ class edge_v::io::Hdf5 {
      **/
     void get( std::string const & i_name,
               double            * o_data ) const;
+
+    /**
+     * Gets a two-dimensional block of a dataset, which holds row-major data with i_nCols values per row.
+     * Only the block is read from the file; the dataset is either one- or two-dimensional.
+     *
+     * @param i_name name of the dataset.
+     * @param i_nCols number of values per row of the dataset.
+     * @param i_first first row and first column of the block.
+     * @param i_size number of rows and number of columns of the block.
+     * @param o_data will be set to the block's data (row-major).
+     **/
+    void get( std::string const & i_name,
+              t_idx               i_nCols,
+              t_idx       const   i_first[2],
+              t_idx       const   i_size[2],
+              float             * o_data ) const;
 };
 
 #endif
\ No newline at end of file
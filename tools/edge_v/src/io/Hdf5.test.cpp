@@ -90,4 +90,50 @@ TEST_CASE( "Tests set/get data HDF5 interface.", "[hdf5][setGetData]" ) {
   for( unsigned short l_va = 0; l_va < 3; l_va++ ) {
     REQUIRE( l_dataOut2[l_va] == l_dataIn2[l_va] );
   }
+}
+
+TEST_CASE( "Tests reading blocks of data through the HDF5 interface.", "[hdf5][getBlock]" ) {
+  // 3x4 row-major data
+  float l_dataIn[12] = { 0,  1,  2,  3,
+                         4,  5,  6,  7,
+                         8,  9, 10, 11 };
+
+  std::string l_path = std::tmpnam(nullptr);
+  {
+    edge_v::io::Hdf5 l_hdf( l_path,
+                            false );
+    l_hdf.set( "data",
+               12,
+               l_dataIn );
+  }
+
+  edge_v::io::Hdf5 l_hdf( l_path );
+
+  edge_v::t_idx l_first[2] = { 1, 2 };
+  edge_v::t_idx l_size[2] = { 2, 2 };
+  float l_dataOut[4] = {0};
+  l_hdf.get( "data",
+             4,
+             l_first,
+             l_size,
+             l_dataOut );
+
+  REQUIRE( l_dataOut[0] ==  6 );
+  REQUIRE( l_dataOut[1] ==  7 );
+  REQUIRE( l_dataOut[2] == 10 );
+  REQUIRE( l_dataOut[3] == 11 );
+
+  l_first[0] = 0;
+  l_first[1] = 1;
+  l_size[0] = 3;
+  l_size[1] = 1;
+  l_hdf.get( "data",
+             4,
+             l_first,
+             l_size,
+             l_dataOut );
+
+  REQUIRE( l_dataOut[0] == 1 );
+  REQUIRE( l_dataOut[1] == 5 );
+  REQUIRE( l_dataOut[2] == 9 );
 }
\ No newline at end of file
@@ -39,6 +39,7 @@
 #include "time/Groups.h"
 #include "mesh/Partition.h"
 #include "mesh/Communication.h"
+#include "mesh/Reordering.h"
 
 #include "io/logging.h"
 #ifdef PP_USE_EASYLOGGING
@@ -95,8 +96,11 @@ int main( int   i_argc,
   EDGE_V_LOG_INFO << "  mesh:";
   EDGE_V_LOG_INFO << "    periodic:                  " << l_config.getPeriodic();
   EDGE_V_LOG_INFO << "    write_element_annotations: " << l_config.getWriteElAn();
+  EDGE_V_LOG_INFO << "    write_binary:              " << l_config.getWriteBin();
   EDGE_V_LOG_INFO << "    n_partitions:              " << l_config.nPartitions();
+  EDGE_V_LOG_INFO << "    multi_constraint:          " << l_config.getMultiCon();
   EDGE_V_LOG_INFO << "    reorder_only:              " << l_config.getReorderOnly();
+  EDGE_V_LOG_INFO << "    element_order:             " << l_config.getElOrder();
   EDGE_V_LOG_INFO << "    in:                        " << l_config.getMeshIn();
   EDGE_V_LOG_INFO << "    out:";
   EDGE_V_LOG_INFO << "      base:                    " << l_config.getMeshOutBase();
@@ -139,6 +143,9 @@ int main( int   i_argc,
     for( std::size_t l_ds = 0; l_ds < l_config.getModTsunamiDisp().size(); l_ds++ )
       EDGE_V_LOG_INFO << "      displacement #" << l_ds << ": "  << l_config.getModTsunamiDisp()[l_ds];
     EDGE_V_LOG_INFO << "      expr: " << l_config.getModTsunamiExpr();
+    EDGE_V_LOG_INFO << "      grid:";
+    EDGE_V_LOG_INFO << "        tile_size: " << l_config.getModTsunamiTileSize();
+    EDGE_V_LOG_INFO << "        n_cache_tiles: " << l_config.getModTsunamiNCacheTiles();
   }
   else {
     EDGE_V_LOG_INFO << "  constant";
@@ -177,6 +184,9 @@ int main( int   i_argc,
                                                        l_config.getPeriodic() );
   l_mesh->printStats();
 
+  // the input mesh is not partitioned, thus every periodic face has a partner
+  EDGE_V_CHECK_EQ( l_mesh->nPeUnpaired(), 0 ) << "lost periodic face pairs";
+
   EDGE_V_LOG_INFO << "initializing velocity model";
   edge_v::models::Model *l_velMod = nullptr;
   edge_v::io::Hdf5 * l_tsunamiHdfBath = nullptr;
@@ -204,7 +214,9 @@ int main( int   i_argc,
   }
   else if( l_config.getModTsunamiBath() != "" ) {
     l_tsunamiHdfBath = new edge_v::io::Hdf5( l_config.getModTsunamiBath() );
-    l_tsunamiGridBath = new edge_v::io::Grid( l_tsunamiHdfBath );
+    l_tsunamiGridBath = new edge_v::io::Grid( l_tsunamiHdfBath,
+                                              l_config.getModTsunamiTileSize(),
+                                              l_config.getModTsunamiNCacheTiles() );
     l_tsunamiGridBath->init( l_mesh->nVes(),
                              l_mesh->getVeCrds() );
     l_velMod = new edge_v::models::GridExpression( l_tsunamiGridBath,
@@ -290,15 +302,17 @@ int main( int   i_argc,
   unsigned short l_nRates = l_config.nTsGroups()-1;
   double *l_rates = new double[l_nRates];
   for( unsigned short l_tg = 0; l_tg < l_nRates; l_tg++ ) {
-    l_rates[l_tg] = 2.0;
+    l_rates[l_tg] = l_config.getTsRates()[l_tg];
   }
 
   double l_funDt = l_config.getFunDt();
   // search for fundamental dt, if not specified
   double l_speedUp = 0;
   if( l_funDt == 0 ) {
+    // shifting the fundamental dt by the first rate covers all assignments
+    double l_dtMin = (l_nRates > 0) ? 1.0 / l_rates[0] : 0.5;
     double l_dt = 1.0;
-    while( l_dt > 0.5 ) {
+    while( l_dt > l_dtMin ) {
       edge_v::time::Groups l_tsGroups( l_mesh->getTypeEl(),
                                        l_mesh->nEls(),
                                        l_mesh->getElFaEl(),
@@ -333,9 +347,12 @@ int main( int   i_argc,
 
   EDGE_V_LOG_INFO << "partitioning the mesh";
   edge_v::mesh::Partition * l_part = new edge_v::mesh::Partition( *l_mesh,
-                                                                   l_tsGroups->getElTg() );
+                                                                   l_tsGroups->getElTg(),
+                                                                   l_config.getTsRates().data() );
   if( l_config.nPartitions() > 1 ) {
-    l_part->kWay( l_config.nPartitions() );
+    l_part->kWay( l_config.nPartitions(),
+                  5,
+                  l_config.getMultiCon() );
   }
 
   if( l_config.getWriteElAn() ) {
@@ -345,14 +362,44 @@ int main( int   i_argc,
                         l_config.getMeshOutBase() + "_element_partition" + l_config.getMeshOutExt() );
   }
 
+  // derive locality-aware keys of the elements within the blocks of equal priority
+  edge_v::t_idx * l_elKeys = nullptr;
+  if( l_config.getElOrder() != "" ) {
+    EDGE_V_LOG_INFO << "deriving element order: " << l_config.getElOrder();
+    l_elKeys = new edge_v::t_idx[ l_mesh->nEls() ];
+
+    if( l_config.getElOrder() == "morton" ) {
+      double (*l_elCrds)[3] = new double[ l_mesh->nEls() ][3];
+      edge_v::mesh::Reordering::centroids( l_mesh->getTypeEl(),
+                                           l_mesh->nEls(),
+                                           l_mesh->getElVe(),
+                                           l_mesh->getVeCrds(),
+                                           l_elCrds );
+      edge_v::mesh::Reordering::morton( l_mesh->nEls(),
+                                        l_elCrds,
+                                        l_elKeys );
+      delete[] l_elCrds;
+    }
+    else {
+      edge_v::mesh::Reordering::rcm( edge_v::CE_N_FAS( l_mesh->getTypeEl() ),
+                                     l_mesh->nEls(),
+                                     l_mesh->getElFaEl(),
+                                     l_part->getElPr(),
+                                     l_elKeys );
+    }
+  }
+
   EDGE_V_LOG_INFO << "reordering by rank and time group";
-  l_gmsh.reorder( l_part->getElPr() );
+  l_gmsh.reorder( l_part->getElPr(),
+                  l_elKeys );
+  if( l_elKeys != nullptr ) delete[] l_elKeys;
 
   // clear partitioning if only a reordering was requested
   if( l_config.getReorderOnly() ) {
     delete l_part;
     l_part = new edge_v::mesh::Partition( *l_mesh,
-                                          l_tsGroups->getElTg() );
+                                          l_tsGroups->getElTg(),
+                                          l_config.getTsRates().data() );
   }
 
   // store partitioning in gmsh
@@ -491,7 +538,9 @@ int main( int   i_argc,
     l_tsunamiDisp = new float*[ l_config.getModTsunamiDisp().size() ];
     for( std::size_t l_ds = 0; l_ds < l_config.getModTsunamiDisp().size(); l_ds++ ) {
       edge_v::io::Hdf5 l_dispHdf( l_config.getModTsunamiDisp()[l_ds] );
-      edge_v::io::Grid l_dispGrid( &l_dispHdf );
+      edge_v::io::Grid l_dispGrid( &l_dispHdf,
+                                   l_config.getModTsunamiTileSize(),
+                                   l_config.getModTsunamiNCacheTiles() );
       l_dispGrid.init( l_mesh->nVes(),
                        l_mesh->getVeCrds() );
 
@@ -639,6 +688,21 @@ int main( int   i_argc,
     l_first += l_nPaEls;
   }
 
+  // write the binary partitions, derived from the Gmsh partitions as EDGE would
+  if( l_config.getWriteBin() ) {
+    for( edge_v::t_idx l_pa = 0; l_pa < l_part->nPas(); l_pa++ ) {
+      std::string l_pathPa = l_config.getMeshOutBase() + "_" + std::to_string(l_pa+1);
+
+      l_gmsh.open( l_pathPa + l_config.getMeshOutExt() );
+      l_gmsh.readMesh();
+      edge_v::mesh::Mesh l_paMesh( l_gmsh,
+                                   l_config.getPeriodic() );
+
+      EDGE_V_LOG_INFO << "writing binary partition: " << l_pathPa << ".bin";
+      l_paMesh.write( l_pathPa + ".bin" );
+    }
+  }
+
 #ifdef PP_HAS_UCVM
   delete[] l_velP;
   delete[] l_velS;
@@ -27,6 +27,16 @@
 #include "../geom/Geom.h"
 #include "../io/logging.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 void edge_v::mesh::Mesh::getElFaEl( t_entityType         i_elTy,
                                     t_idx                i_nEls,
                                     t_idx        const * i_faEl,
@@ -99,31 +109,45 @@ void edge_v::mesh::Mesh::addSparseTypeEn( t_entityType         i_enTy,
   // get the number of vertices
   unsigned short l_nEnVes = CE_N_VES( i_enTy );
 
-  // current sparse id
-  t_idx l_sp = 0;
-
-  // iterate over the dense entities
-  for( t_idx l_de = 0; l_de < i_nEnsDe; l_de++ ) {
-    // abort if all sparse entities have been processed
-    if( l_sp >= i_nEnsSp ) break;
+  // number of sparse entities, which were found in the dense ones
+  t_idx l_nFound = 0;
 
-    // check for number of matching vertices
-    unsigned short l_nMatch = 0;
-    for( unsigned short l_ve = 0; l_ve < l_nEnVes; l_ve++ ) {
-      if( i_enVeDe[ l_de * l_nEnVes + l_ve] == i_enVeSp[ l_sp * l_nEnVes + l_ve ] ) {
-        l_nMatch++;
+#ifdef PP_USE_OMP
+#pragma omp parallel for reduction(+:l_nFound)
+#endif
+  for( t_idx l_sp = 0; l_sp < i_nEnsSp; l_sp++ ) {
+    t_idx const * l_enVeSp = i_enVeSp + l_sp * l_nEnVes;
+
+    // binary search for the first dense entity, which is not lexicographically smaller
+    t_idx l_de = 0;
+    t_idx l_count = i_nEnsDe;
+    while( l_count > 0 ) {
+      t_idx l_step = l_count / 2;
+      t_idx const * l_enVeDe = i_enVeDe + (l_de + l_step) * l_nEnVes;
+
+      if( std::lexicographical_compare( l_enVeDe, l_enVeDe + l_nEnVes,
+                                        l_enVeSp, l_enVeSp + l_nEnVes ) ) {
+        l_de += l_step + 1;
+        l_count -= l_step + 1;
+      }
+      else {
+        l_count = l_step;
       }
     }
 
-    // set type and increase counter for matches
-    if( l_nMatch == l_nEnVes ) {
+    // set type for matches
+    if(    l_de < i_nEnsDe
+        && std::equal( l_enVeSp, l_enVeSp + l_nEnVes, i_enVeDe + l_de * l_nEnVes ) ) {
+#ifdef PP_USE_OMP
+#pragma omp atomic
+#endif
       io_spType[l_de] |= i_spTypeAdd;
-      l_sp++;
+      l_nFound++;
     }
   }
 
   // check that we found all sparse entities
-  EDGE_V_CHECK_EQ( l_sp, i_nEnsSp );
+  EDGE_V_CHECK_EQ( l_nFound, i_nEnsSp );
 }
 
 void edge_v::mesh::Mesh::setInDiameter( t_entityType          i_enTy,
@@ -154,7 +178,7 @@ void edge_v::mesh::Mesh::setInDiameter( t_entityType          i_enTy,
   }
 }
 
-void edge_v::mesh::Mesh::setPeriodicBnds( t_entityType                  i_elTy,
+edge_v::t_idx edge_v::mesh::Mesh::setPeriodicBnds( t_entityType                  i_elTy,
                                           t_idx                         i_nFas,
                                           int                           i_peBndTy,
                                           int                  const  * i_faBndTys,
@@ -227,36 +251,116 @@ void edge_v::mesh::Mesh::setPeriodicBnds( t_entityType                  i_elTy,
     return l_nMaVes;
   };
 
-  // 1) iterate over all face-pairs,
-  // 2) for each face, determine the constant dimension (assumption for our periodic boundaries)
-  // 3) if the two faces have the same constant dim, check if the faces' vertices share coordinates in another dim
-  std::vector< t_idx > l_faPairs;
-  for( std::size_t l_f0 = 0; l_f0 < l_bndFas.size(); l_f0++ ) {
-    unsigned short l_constDim0 = l_eqDi( l_nFaVes*l_nFaVes, l_bndFas[l_f0], l_bndFas[l_f0] );
-    for( std::size_t l_f1 = 0; l_f1 < l_bndFas.size(); l_f1++ ) {
-      unsigned short l_constDim1 = l_eqDi( l_nFaVes*l_nFaVes, l_bndFas[l_f1], l_bndFas[l_f1] );
+  // derive the constant dimension of every face (assumption for our periodic boundaries)
+  std::vector< unsigned short > l_constDis( l_bndFas.size() );
+#ifdef PP_USE_OMP
+#pragma omp parallel for
+#endif
+  for( std::size_t l_bf = 0; l_bf < l_bndFas.size(); l_bf++ ) {
+    l_constDis[l_bf] = l_eqDi( l_nFaVes*l_nFaVes, l_bndFas[l_bf], l_bndFas[l_bf] );
+  }
 
-      if( l_constDim0 == l_constDim1 ) {
-        unsigned short l_nMaVes = l_maVes( l_constDim0, l_bndFas[l_f0], l_bndFas[l_f1] );
+  // lambda which scrambles the bits of a hash
+  auto l_mix = []( std::size_t i_hash ) {
+    std::uint64_t l_hash = i_hash;
+    l_hash = (l_hash ^ (l_hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    l_hash = (l_hash ^ (l_hash >> 27)) * 0x94d049bb133111ebULL;
+    return std::size_t( l_hash ^ (l_hash >> 31) );
+  };
 
-        if( l_f0 != l_f1 && l_nMaVes == l_nFaVes ) {
-          l_faPairs.push_back( l_f1 );
-        }
+  // lambda which hashes the constant dimension and the bin of the face's centroid
+  auto l_hash = [ l_nDis, l_mix ]( unsigned short          i_constDi,
+                                   long long       const * i_bin ) {
+    std::size_t l_hashBin = 0;
+    for( unsigned short l_di = 0; l_di < l_nDis; l_di++ ) {
+      l_hashBin = l_mix( l_hashBin ^ std::size_t(i_bin[l_di]) );
+    }
+    return l_mix( l_hashBin ^ i_constDi );
+  };
+
+  // bins of the faces' centroids in the non-constant dimensions;
+  // matching faces have centroids closer than m_tol, which is half the bin width, thus their bins are at most one apart
+  double l_binWidth = 2*m_tol;
+  std::vector< long long > l_bins( l_bndFas.size()*3, 0 );
+#ifdef PP_USE_OMP
+#pragma omp parallel for
+#endif
+  for( std::size_t l_bf = 0; l_bf < l_bndFas.size(); l_bf++ ) {
+    for( unsigned short l_di = 0; l_di < l_nDis; l_di++ ) {
+      if( l_di == l_constDis[l_bf] ) continue;
+
+      double l_cen = 0;
+      for( unsigned short l_ve = 0; l_ve < l_nFaVes; l_ve++ ) {
+        l_cen += i_veCrds[ i_faVe[l_bndFas[l_bf]*l_nFaVes + l_ve] ][l_di];
       }
+      l_cen /= l_nFaVes;
+
+      l_bins[l_bf*3 + l_di] = std::llround( std::floor( l_cen / l_binWidth ) );
     }
+  }
+
+  // 1) hash all faces by their constant dimension and their bin
+  // 2) for each face, check the faces in the adjacent bins for shared constant dimension and coordinates
+  std::unordered_multimap< std::size_t, std::size_t > l_hashFas;
+  l_hashFas.reserve( l_bndFas.size() );
+  for( std::size_t l_bf = 0; l_bf < l_bndFas.size(); l_bf++ ) {
+    l_hashFas.emplace( l_hash( l_constDis[l_bf], l_bins.data()+l_bf*3 ), l_bf );
+  }
+
+  // number of adjacent bins (including the face's one): 3^(#non-constant dimensions)
+  unsigned short l_nAdBins = 1;
+  for( unsigned short l_di = 0; l_di < l_nDis; l_di++ ) l_nAdBins *= 3;
+
+  // dummy stays if nothing was found (happens for periodic partition boundaries)
+  std::vector< t_idx > l_faPairs( l_bndFas.size(), std::numeric_limits< t_idx >::max() );
+  std::size_t l_nMulti = 0;
+#ifdef PP_USE_OMP
+#pragma omp parallel for reduction(+:l_nMulti)
+#endif
+  for( std::size_t l_f0 = 0; l_f0 < l_bndFas.size(); l_f0++ ) {
+    for( unsigned short l_ab = 0; l_ab < l_nAdBins; l_ab++ ) {
+      // derive the adjacent bin, the constant dimension is not shifted
+      long long l_bin[3] = { 0, 0, 0 };
+      unsigned short l_code = l_ab;
+      bool l_skip = false;
+      for( unsigned short l_di = 0; l_di < l_nDis; l_di++ ) {
+        int l_off = int(l_code % 3) - 1;
+        l_code /= 3;
+        if( l_di == l_constDis[l_f0] && l_off != 0 ) l_skip = true;
+        l_bin[l_di] = l_bins[l_f0*3 + l_di] + l_off;
+      }
+      if( l_skip ) continue;
+
+      auto l_cands = l_hashFas.equal_range( l_hash( l_constDis[l_f0], l_bin ) );
 
-    // add dummy if nothing was found (happens for periodic partition boundaries)
-    if( l_faPairs.size() != l_f0 + 1 ) {
-      l_faPairs.push_back( std::numeric_limits< t_idx >::max() );
+      for( auto l_ca = l_cands.first; l_ca != l_cands.second; l_ca++ ) {
+        std::size_t l_f1 = l_ca->second;
+
+        if( l_f0 != l_f1 && l_constDis[l_f0] == l_constDis[l_f1] ) {
+          unsigned short l_nMaVes = l_maVes( l_constDis[l_f0], l_bndFas[l_f0], l_bndFas[l_f1] );
+
+          if( l_nMaVes == l_nFaVes ) {
+            // hash collisions of adjacent bins may return the same candidate twice
+            if(    l_faPairs[l_f0] != std::numeric_limits< t_idx >::max()
+                && l_faPairs[l_f0] != l_f1 ) l_nMulti++;
+            l_faPairs[l_f0] = l_f1;
+          }
+        }
+      }
     }
   }
 
+  // check that every face has at most one partner
+  EDGE_V_CHECK_EQ( l_nMulti, 0 );
+
   // check that we got a partner for every found periodic face
   EDGE_V_CHECK_EQ( l_faPairs.size(), l_bndFas.size() );
+  t_idx l_nUnpaired = 0;
   for( std::size_t l_fa = 0; l_fa < l_faPairs.size(); l_fa++ ) {
     if( l_faPairs[l_fa] != std::numeric_limits< t_idx >::max() ) {
       EDGE_V_CHECK_EQ( l_faPairs[ l_faPairs[l_fa] ], l_fa );
     }
+    else l_nUnpaired++;
   }
 
   // insert the missing elements and store the face with the larger adjacent element
@@ -283,6 +387,8 @@ void edge_v::mesh::Mesh::setPeriodicBnds( t_entityType                  i_elTy,
       }
     }
   }
+
+  return l_nUnpaired;
 }
 
 void edge_v::mesh::Mesh::normOrder( t_entityType          i_elTy,
@@ -374,6 +480,31 @@ void edge_v::mesh::Mesh::normOrder( t_entityType          i_elTy,
   }
 }
 
+void edge_v::mesh::Mesh::binSizes( t_entityType i_elTy,
+                                   t_idx        i_nVes,
+                                   t_idx        i_nFas,
+                                   t_idx        i_nEls,
+                                   std::size_t  o_sizes[m_nBinArrs] ) {
+  unsigned short l_nElVes = CE_N_VES( i_elTy );
+  unsigned short l_nElFas = CE_N_FAS( i_elTy );
+  unsigned short l_nFaVes = CE_N_VES( CE_T_FA( i_elTy ) );
+
+  o_sizes[ 0] = i_nVes * 3        * sizeof(double);
+  o_sizes[ 1] = i_nFas * l_nFaVes * sizeof(t_idx);
+  o_sizes[ 2] = i_nFas * 2        * sizeof(t_idx);
+  o_sizes[ 3] = i_nEls * l_nElVes * sizeof(t_idx);
+  o_sizes[ 4] = i_nEls * l_nElFas * sizeof(t_idx);
+  o_sizes[ 5] = i_nEls * l_nElFas * sizeof(t_idx);
+  o_sizes[ 6] = i_nVes            * sizeof(t_sparseType);
+  o_sizes[ 7] = i_nFas            * sizeof(t_sparseType);
+  o_sizes[ 8] = i_nEls            * sizeof(t_sparseType);
+  o_sizes[ 9] = i_nEls            * sizeof(double);
+  o_sizes[10] = i_nFas            * sizeof(double);
+  o_sizes[11] = i_nEls            * sizeof(double);
+  o_sizes[12] = i_nFas * 3        * sizeof(double);
+  o_sizes[13] = i_nFas * 2 * 3    * sizeof(double);
+}
+
 edge_v::mesh::Mesh::Mesh( edge_v::io::Gmsh const & i_gmsh,
                           int                      i_periodic ) {
   // get the element type of the mesh
@@ -566,11 +697,6 @@ edge_v::mesh::Mesh::Mesh( edge_v::io::Gmsh const & i_gmsh,
       std::sort( l_faVePhGr+l_fa*l_nFaVes, l_faVePhGr+(l_fa+1)*l_nFaVes );
     }
 
-    // sort lexicographically
-    geom::Generic::sortLex( l_nFasPhGr,
-                            l_nFaVes,
-                            l_faVePhGr );
-
     // add physical group to sparse type
     addSparseTypeEn( l_faTy,
                      m_nFas,
@@ -616,16 +742,19 @@ edge_v::mesh::Mesh::Mesh( edge_v::io::Gmsh const & i_gmsh,
   // adjust for periodic boundaries
   std::vector< t_idx > l_pFasGt;
   if( i_periodic != std::numeric_limits< int >::max() ) {
-    setPeriodicBnds( m_elTy,
-                     m_nFas,
-                     i_periodic,
-                     m_spTypeFa,
-                     m_faVe,
-                     m_veCrds,
-                     m_faEl,
-                     m_elFa,
-                     m_elFaEl,
-                     l_pFasGt );
+    m_nPeUnpaired = setPeriodicBnds( m_elTy,
+                                     m_nFas,
+                                     i_periodic,
+                                     m_spTypeFa,
+                                     m_faVe,
+                                     m_veCrds,
+                                     m_faEl,
+                                     m_elFa,
+                                     m_elFaEl,
+                                     l_pFasGt );
+
+    // unpaired faces are expected at periodic partition boundaries only
+    EDGE_V_LOG_INFO << "  #periodic faces without partner: " << m_nPeUnpaired;
   }
 
   normOrder( m_elTy,
@@ -648,7 +777,78 @@ edge_v::mesh::Mesh::Mesh( edge_v::io::Gmsh const & i_gmsh,
   }
 }
 
+edge_v::mesh::Mesh::Mesh( std::string const & i_pathToBin ) {
+  // map the file
+  int l_fd = open( i_pathToBin.c_str(),
+                   O_RDONLY );
+  EDGE_V_CHECK_NE( l_fd, -1 ) << "could not open binary mesh: " << i_pathToBin;
+
+  struct stat l_stat;
+  int l_err = fstat( l_fd,
+                     &l_stat );
+  EDGE_V_CHECK_EQ( l_err, 0 );
+  m_mapSize = l_stat.st_size;
+  EDGE_V_CHECK_GE( m_mapSize, sizeof(t_binHeader) );
+
+  m_map = mmap( nullptr,
+                m_mapSize,
+                PROT_READ,
+                MAP_PRIVATE,
+                l_fd,
+                0 );
+  EDGE_V_CHECK_NE( m_map, MAP_FAILED ) << "could not map binary mesh: " << i_pathToBin;
+  close( l_fd );
+
+  // check the header
+  char const * l_raw = (char const *) m_map;
+  t_binHeader const * l_hdr = (t_binHeader const *) l_raw;
+  EDGE_V_CHECK_EQ( std::strncmp( l_hdr->magic, "EDGE_V_M", 8 ), 0 ) << "not a binary mesh: " << i_pathToBin;
+  EDGE_V_CHECK_EQ( l_hdr->version, 1 );
+  EDGE_V_CHECK_EQ( l_hdr->nByIdx, sizeof(t_idx) );
+  EDGE_V_CHECK_EQ( l_hdr->nBySpType, sizeof(t_sparseType) );
+  EDGE_V_CHECK_EQ( l_hdr->size, m_mapSize );
+
+  m_elTy = (t_entityType) l_hdr->elTy;
+  m_nVes = l_hdr->nVes;
+  m_nFas = l_hdr->nFas;
+  m_nEls = l_hdr->nEls;
+
+  std::size_t l_sizes[m_nBinArrs];
+  binSizes( m_elTy,
+            m_nVes,
+            m_nFas,
+            m_nEls,
+            l_sizes );
+  for( unsigned short l_ar = 0; l_ar < m_nBinArrs; l_ar++ ) {
+    EDGE_V_CHECK_EQ( l_hdr->offs[l_ar] % m_binAlign, 0 );
+    EDGE_V_CHECK_LE( l_hdr->offs[l_ar] + l_sizes[l_ar], m_mapSize );
+  }
+
+  // point the arrays to the mapped data, which is only read
+  m_veCrds   = (double (*)[3])    ( l_raw + l_hdr->offs[ 0] );
+  m_faVe     = (t_idx *)          ( l_raw + l_hdr->offs[ 1] );
+  m_faEl     = (t_idx *)          ( l_raw + l_hdr->offs[ 2] );
+  m_elVe     = (t_idx *)          ( l_raw + l_hdr->offs[ 3] );
+  m_elFa     = (t_idx *)          ( l_raw + l_hdr->offs[ 4] );
+  m_elFaEl   = (t_idx *)          ( l_raw + l_hdr->offs[ 5] );
+  m_spTypeVe = (t_sparseType *)   ( l_raw + l_hdr->offs[ 6] );
+  m_spTypeFa = (t_sparseType *)   ( l_raw + l_hdr->offs[ 7] );
+  m_spTypeEl = (t_sparseType *)   ( l_raw + l_hdr->offs[ 8] );
+  m_inDiasEl = (double *)         ( l_raw + l_hdr->offs[ 9] );
+  m_volFa    = (double *)         ( l_raw + l_hdr->offs[10] );
+  m_volEl    = (double *)         ( l_raw + l_hdr->offs[11] );
+  m_normals  = (double (*)[3])    ( l_raw + l_hdr->offs[12] );
+  m_tangents = (double (*)[2][3]) ( l_raw + l_hdr->offs[13] );
+}
+
 edge_v::mesh::Mesh::~Mesh() {
+  // mapped data is released at once
+  if( m_map != nullptr ) {
+    munmap( m_map,
+            m_mapSize );
+    return;
+  }
+
   delete[] m_veCrds;
   delete[] m_faVe;
   delete[] m_faEl;
@@ -672,6 +872,75 @@ void edge_v::mesh::Mesh::printStats() const {
   EDGE_V_LOG_INFO << "  #elements: " << m_nEls;
 }
 
+void edge_v::mesh::Mesh::write( std::string const & i_pathToBin ) {
+  // derive the lazily computed geometry
+  getAreasFa();
+  getVolumesEl();
+  getNormalsFa();
+  getTangentsFa();
+
+  void const * l_arrs[m_nBinArrs] = { m_veCrds,
+                                      m_faVe,
+                                      m_faEl,
+                                      m_elVe,
+                                      m_elFa,
+                                      m_elFaEl,
+                                      m_spTypeVe,
+                                      m_spTypeFa,
+                                      m_spTypeEl,
+                                      m_inDiasEl,
+                                      m_volFa,
+                                      m_volEl,
+                                      m_normals,
+                                      m_tangents };
+
+  std::size_t l_sizes[m_nBinArrs];
+  binSizes( m_elTy,
+            m_nVes,
+            m_nFas,
+            m_nEls,
+            l_sizes );
+
+  // assemble header
+  t_binHeader l_hdr;
+  std::memset( &l_hdr, 0, sizeof(t_binHeader) );
+  std::memcpy( l_hdr.magic, "EDGE_V_M", 8 );
+  l_hdr.version = 1;
+  l_hdr.nByIdx = sizeof(t_idx);
+  l_hdr.nBySpType = sizeof(t_sparseType);
+  l_hdr.elTy = m_elTy;
+  l_hdr.nVes = m_nVes;
+  l_hdr.nFas = m_nFas;
+  l_hdr.nEls = m_nEls;
+
+  std::size_t l_off = sizeof(t_binHeader);
+  for( unsigned short l_ar = 0; l_ar < m_nBinArrs; l_ar++ ) {
+    l_off = ( (l_off + m_binAlign - 1) / m_binAlign ) * m_binAlign;
+    l_hdr.offs[l_ar] = l_off;
+    l_off += l_sizes[l_ar];
+  }
+  l_hdr.size = l_off;
+
+  // write header and arrays
+  std::ofstream l_file( i_pathToBin,
+                        std::ios::out | std::ios::binary | std::ios::trunc );
+  EDGE_V_CHECK( l_file.is_open() ) << "could not open binary mesh: " << i_pathToBin;
+
+  l_file.write( (char const *) &l_hdr,
+                sizeof(t_binHeader) );
+  char l_pad[m_binAlign] = {};
+  l_off = sizeof(t_binHeader);
+  for( unsigned short l_ar = 0; l_ar < m_nBinArrs; l_ar++ ) {
+    l_file.write( l_pad,
+                  l_hdr.offs[l_ar] - l_off );
+    l_file.write( (char const *) l_arrs[l_ar],
+                  l_sizes[l_ar] );
+    l_off = l_hdr.offs[l_ar] + l_sizes[l_ar];
+  }
+
+  EDGE_V_CHECK( l_file.good() ) << "could not write binary mesh: " << i_pathToBin;
+}
+
 double const * edge_v::mesh::Mesh::getAreasFa() {
   // only work on this once
   if( m_volFa == nullptr ) {
@@ -26,7 +26,9 @@
 
 #include "../constants.h"
 #include "../io/Gmsh.h"
+#include <cstdint>
 #include <limits>
+#include <string>
 
 namespace edge_v {
   namespace mesh {
@@ -54,6 +56,9 @@ class edge_v::mesh::Mesh {
     //! number of elements in the mesh
     t_idx m_nEls;
 
+    //! number of periodic faces without a partner (partition boundaries if the mesh is partitioned)
+    t_idx m_nPeUnpaired = 0;
+
     //! vertex coordinates
     double (*m_veCrds)[3] = nullptr;
 
@@ -96,6 +101,58 @@ class edge_v::mesh::Mesh {
     //! tangents of the faces
     double (* m_tangents)[2][3] = nullptr;
 
+    //! number of arrays in the binary format
+    static unsigned short const m_nBinArrs = 14;
+
+    //! alignment of the arrays in the binary format
+    static std::size_t const m_binAlign = 64;
+
+    //! header of the binary format
+    typedef struct {
+      //! identifier of the format
+      char magic[8];
+      //! version of the format
+      std::uint64_t version;
+      //! number of bytes of an entity id
+      std::uint64_t nByIdx;
+      //! number of bytes of a sparse type
+      std::uint64_t nBySpType;
+      //! element type
+      std::uint64_t elTy;
+      //! number of vertices
+      std::uint64_t nVes;
+      //! number of faces
+      std::uint64_t nFas;
+      //! number of elements
+      std::uint64_t nEls;
+      //! offsets of the arrays w.r.t. to the beginning of the file
+      std::uint64_t offs[m_nBinArrs];
+      //! total size of the file
+      std::uint64_t size;
+    } t_binHeader;
+
+    //! memory-mapped binary file, nullptr if the mesh was derived from gmsh
+    void * m_map = nullptr;
+
+    //! size of the memory-mapped binary file
+    std::size_t m_mapSize = 0;
+
+    /**
+     * Gets the sizes of the arrays in the binary format.
+     * The order is: veCrds, faVe, faEl, elVe, elFa, elFaEl, spTypeVe, spTypeFa, spTypeEl, inDiasEl, volFa, volEl, normals, tangents.
+     *
+     * @param i_elTy element type.
+     * @param i_nVes number of vertices.
+     * @param i_nFas number of faces.
+     * @param i_nEls number of elements.
+     * @param o_sizes will be set to the sizes of the arrays in bytes.
+     **/
+    static void binSizes( t_entityType i_elTy,
+                          t_idx        i_nVes,
+                          t_idx        i_nFas,
+                          t_idx        i_nEls,
+                          std::size_t  o_sizes[m_nBinArrs] );
+
     /**
      * Gets the element-to-element adjacency (faces as bridge).
      *
@@ -138,12 +195,57 @@ class edge_v::mesh::Mesh {
                              double       const (* i_veCrds)[3],
                              double             (* o_enVeCrds)[3] );
 
+    /**
+     * Computes the lengths (1d), incircle (2d) or insphere (3d) diameters.
+     *
+     * @param i_enTy entity type.
+     * @param i_nEns number of entities.
+     * @param i_enVe vertices adjacent to the entities.
+     * @param i_veCrds coordinates of the vertices.
+     * @param o_inDia will be set to the entities' diameters.
+     **/
+    static void setInDiameter( t_entityType         i_enTy,
+                               t_idx                i_nEns,
+                               t_idx       const  * i_enVe,
+                               double      const (* i_veCrds)[3],
+                               double             * o_inDia );
+
+    /**
+     * Normalizes the order of the given adjacency information.
+     *   1) faVe: vertices with smaller id first for each face.
+     *   2) faEl: elements with smaller id first for each face.
+     *   3) elVe: smallest vertex first, then ensuring counterclockwise ordering.
+     *   4) elFa: following the element's vertex ordering w.r.t. face-assignments in the reference element.
+     *   5) elFaEl: same as elFa.
+     *
+     * @param i_elTy element type.
+     * @param i_nFas number of faces.
+     * @param i_nEls number of elements.
+     * @param i_veCrds coordinates of the element's vertices.
+     * @param i_faVe vertices of the faces.
+     * @param i_faEl elements adjacent to the faces.
+     * @param io_elVe vertices adjacent to the element (ordered ascending by the ids).
+     * @param io_elFa faces adjacent to the element (ordered ascending by the vertex ids of the faces).
+     * @param io_elFaEl elements adjacent to the elements (ordered ascending by the vertex ids of the faces).
+     **/
+    static void normOrder( t_entityType          i_elTy,
+                           t_idx                 i_nFas,
+                           t_idx                 i_nEls,
+                           double       const (* i_veCrds)[3],
+                           t_idx               * io_faVe,
+                           t_idx               * io_faEl,
+                           t_idx               * io_elVe,
+                           t_idx               * io_elFa,
+                           t_idx               * io_elFaEl );
+
+  public:
     /**
      * Adds the given type to the sparse entities.
      *
      * Remark:
      *   All per-entity vertices are assumed to be sorted ascending.
-     *   All entity arrays are assumed to be sorted lexicographically.
+     *   The dense entities are assumed to be sorted lexicographically, the sparse entities might have any order.
+     *   Every sparse entity is found through a binary search in the dense entities.
      *
      * @param i_enTy entity type.
      * @param i_nEnsDe number of dense entities.
@@ -161,24 +263,11 @@ class edge_v::mesh::Mesh {
                                  t_sparseType         i_spTypeAdd,
                                  t_sparseType       * io_spType );
 
-    /**
-     * Computes the lengths (1d), incircle (2d) or insphere (3d) diameters.
-     *
-     * @param i_enTy entity type.
-     * @param i_nEns number of entities.
-     * @param i_enVe vertices adjacent to the entities.
-     * @param i_veCrds coordinates of the vertices.
-     * @param o_inDia will be set to the entities' diameters.
-     **/
-    static void setInDiameter( t_entityType         i_enTy,
-                               t_idx                i_nEns,
-                               t_idx       const  * i_enVe,
-                               double      const (* i_veCrds)[3],
-                               double             * o_inDia );
-
     /**
      * Inserts periodic boundaries into faEl and elFaEl by comparing the vertex coordinates of the faces.
      * The function assumes that the periodic boundaries are coordinate aligned.
+     * Candidate pairs are found by binning the faces' centroids (without the constant dimension) on a grid of spacing 2*m_tol;
+     * the exact tolerance-check is done for all faces in the adjacent bins, such that pairs straddling a bin boundary are found.
      *
      * @param i_elTy element type.
      * @param i_nFas number of faces.
@@ -190,8 +279,9 @@ class edge_v::mesh::Mesh {
      * @param i_elFa faces adjacent to the elements.
      * @param io_elFaEl elements adjacent to elements (faces as bridge).
      * @param o_pFasGt will be set to periodic faces originally only adjacent to the element with the greater id.
+     * @return number of periodic faces without a partner.
      **/
-    static void setPeriodicBnds( t_entityType                  i_elTy,
+    static t_idx setPeriodicBnds( t_entityType                  i_elTy,
                                  t_idx                         i_nFas,
                                  int                           i_peBndTy,
                                  int                  const  * i_faBndTys,
@@ -202,35 +292,6 @@ class edge_v::mesh::Mesh {
                                  t_idx                       * io_elFaEl,
                                  std::vector< t_idx >        & o_pFasGt );
 
-    /**
-     * Normalizes the order of the given adjacency information.
-     *   1) faVe: vertices with smaller id first for each face.
-     *   2) faEl: elements with smaller id first for each face.
-     *   3) elVe: smallest vertex first, then ensuring counterclockwise ordering.
-     *   4) elFa: following the element's vertex ordering w.r.t. face-assignments in the reference element.
-     *   5) elFaEl: same as elFa.
-     *
-     * @param i_elTy element type.
-     * @param i_nFas number of faces.
-     * @param i_nEls number of elements.
-     * @param i_veCrds coordinates of the element's vertices.
-     * @param i_faVe vertices of the faces.
-     * @param i_faEl elements adjacent to the faces.
-     * @param io_elVe vertices adjacent to the element (ordered ascending by the ids).
-     * @param io_elFa faces adjacent to the element (ordered ascending by the vertex ids of the faces).
-     * @param io_elFaEl elements adjacent to the elements (ordered ascending by the vertex ids of the faces).
-     **/
-    static void normOrder( t_entityType          i_elTy,
-                           t_idx                 i_nFas,
-                           t_idx                 i_nEls,
-                           double       const (* i_veCrds)[3],
-                           t_idx               * io_faVe,
-                           t_idx               * io_faEl,
-                           t_idx               * io_elVe,
-                           t_idx               * io_elFa,
-                           t_idx               * io_elFaEl );
-
-  public:
     /**
      * Constructor.
      *
@@ -240,6 +301,14 @@ class edge_v::mesh::Mesh {
     Mesh( io::Gmsh const & i_gmsh,
           int              i_periodic = std::numeric_limits< int >::max() );
 
+    /**
+     * Constructor, which memory-maps a binary mesh written by Mesh::write.
+     * All connectivity and geometry is read from the file, nothing is derived.
+     *
+     * @param i_pathToBin path to the binary mesh.
+     **/
+    Mesh( std::string const & i_pathToBin );
+
     /**
      * Destructor
      **/
@@ -250,6 +319,14 @@ class edge_v::mesh::Mesh {
      **/
     void printStats() const;
 
+    /**
+     * Writes the mesh, including all derived connectivity and geometry, to a binary file.
+     * The file is a header followed by the raw arrays, each aligned to m_binAlign bytes.
+     *
+     * @param i_pathToBin path to the binary mesh.
+     **/
+    void write( std::string const & i_pathToBin );
+
     /**
      * Gets the vertex type of the mesh.
      *
@@ -299,6 +376,14 @@ class edge_v::mesh::Mesh {
      **/
     t_idx nEls() const { return m_nEls; }
 
+    /**
+     * Gets the number of periodic faces without a partner.
+     * These are periodic partition boundaries, if the mesh is a partition, and lost pairs otherwise.
+     *
+     * @return number of unpaired periodic faces.
+     **/
+    t_idx nPeUnpaired() const { return m_nPeUnpaired; }
+
     /**
      * Gets the vertices adjacent to the elements.
      *
@@ -25,6 +25,7 @@
 #define private public
 #include "Mesh.h"
 #undef private
+#include <vector>
 
 namespace edge_v {
   namespace test {
@@ -88,4 +89,224 @@ TEST_CASE( "Tests the derivation of sparse entities.", "[mesh][sparseEns]" ) {
                                        l_enVeSp,
                                        101,
                                        l_spType );
-}
\ No newline at end of file
+
+  REQUIRE( l_spType[0] ==   0 );
+  REQUIRE( l_spType[1] ==   0 );
+  REQUIRE( l_spType[2] == 101 );
+  REQUIRE( l_spType[3] == 101 );
+  REQUIRE( l_spType[4] ==   0 );
+  REQUIRE( l_spType[5] == 101 );
+  REQUIRE( l_spType[6] ==   0 );
+
+  // sparse entities in arbitrary order
+  edge_v::t_idx l_enVeSpUn[4*3] = { 6, 7, 9,   // 6
+                                    1, 4, 5,   // 1
+                                    0, 3, 4,   // 0
+                                    2, 4, 0 }; // 4
+
+  edge_v::mesh::Mesh::addSparseTypeEn( edge_v::t_entityType::TRIA3,
+                                       7,
+                                       4,
+                                       l_enVeDe,
+                                       l_enVeSpUn,
+                                       16,
+                                       l_spType );
+
+  REQUIRE( l_spType[0] ==  16 );
+  REQUIRE( l_spType[1] ==  16 );
+  REQUIRE( l_spType[2] == 101 );
+  REQUIRE( l_spType[3] == 101 );
+  REQUIRE( l_spType[4] ==  16 );
+  REQUIRE( l_spType[5] == 101 );
+  REQUIRE( l_spType[6] ==  16 );
+}
+
+/**
+ * Inserts the periodic boundaries of a strip of quads and checks the result.
+ *
+ * @param i_shifts shifts of the x-coordinates of the vertices in the bottom, middle and top row.
+ **/
+static void testPeriodicStrip( double const i_shifts[3] ) {
+  // strip of 4x2 quads, periodic in y:
+  //   vertex (ix,iy) has id ix*3+iy, element (ix,iy) has id ix*2+iy
+  //   local faces: 0 bottom, 1 right, 2 top, 3 left
+  edge_v::t_idx l_nx = 4;
+  edge_v::t_idx l_no = std::numeric_limits< edge_v::t_idx >::max();
+
+  std::vector< double > l_veCrds( (l_nx+1)*3*3, 0 );
+  for( edge_v::t_idx l_ix = 0; l_ix < l_nx+1; l_ix++ ) {
+    for( edge_v::t_idx l_iy = 0; l_iy < 3; l_iy++ ) {
+      l_veCrds[ (l_ix*3 + l_iy)*3 + 0 ] = l_ix + i_shifts[l_iy];
+      l_veCrds[ (l_ix*3 + l_iy)*3 + 1 ] = l_iy;
+    }
+  }
+
+  std::vector< edge_v::t_idx > l_faVe;
+  std::vector< edge_v::t_idx > l_faEl;
+  std::vector< int > l_faBndTys;
+  std::vector< edge_v::t_idx > l_elFa( l_nx*2*4, l_no );
+  std::vector< edge_v::t_idx > l_elFaEl( l_nx*2*4, l_no );
+
+  for( edge_v::t_idx l_ix = 0; l_ix < l_nx+1; l_ix++ ) {
+    for( edge_v::t_idx l_iy = 0; l_iy < 3; l_iy++ ) {
+      // vertical face
+      if( l_iy < 2 ) {
+        edge_v::t_idx l_elL = (l_ix > 0)    ? (l_ix-1)*2 + l_iy : l_no;
+        edge_v::t_idx l_elR = (l_ix < l_nx) ?  l_ix   *2 + l_iy : l_no;
+        if( l_elL != l_no ) l_elFa[l_elL*4 + 1] = l_faBndTys.size();
+        if( l_elR != l_no ) l_elFa[l_elR*4 + 3] = l_faBndTys.size();
+        if( l_elL != l_no && l_elR != l_no ) {
+          l_elFaEl[l_elL*4 + 1] = l_elR;
+          l_elFaEl[l_elR*4 + 3] = l_elL;
+        }
+
+        l_faVe.push_back( l_ix*3 + l_iy   );
+        l_faVe.push_back( l_ix*3 + l_iy+1 );
+        l_faEl.push_back( (l_elL != l_no) ? l_elL : l_elR );
+        l_faEl.push_back( (l_elL != l_no) ? l_elR : l_no  );
+        l_faBndTys.push_back( 0 );
+      }
+      // horizontal face
+      if( l_ix < l_nx ) {
+        edge_v::t_idx l_elB = (l_iy > 0) ? l_ix*2 + l_iy-1 : l_no;
+        edge_v::t_idx l_elT = (l_iy < 2) ? l_ix*2 + l_iy   : l_no;
+        if( l_elB != l_no ) l_elFa[l_elB*4 + 2] = l_faBndTys.size();
+        if( l_elT != l_no ) l_elFa[l_elT*4 + 0] = l_faBndTys.size();
+        if( l_elB != l_no && l_elT != l_no ) {
+          l_elFaEl[l_elB*4 + 2] = l_elT;
+          l_elFaEl[l_elT*4 + 0] = l_elB;
+        }
+
+        l_faVe.push_back(  l_ix   *3 + l_iy );
+        l_faVe.push_back( (l_ix+1)*3 + l_iy );
+        l_faEl.push_back( (l_elB != l_no) ? l_elB : l_elT );
+        l_faEl.push_back( (l_elB != l_no) ? l_elT : l_no  );
+        l_faBndTys.push_back( (l_iy == 1) ? 0 : 5 );
+      }
+    }
+  }
+
+  std::vector< edge_v::t_idx > l_pFasGt;
+  edge_v::t_idx l_nUnpaired = edge_v::mesh::Mesh::setPeriodicBnds( edge_v::t_entityType::QUAD4R,
+                                                                    l_faBndTys.size(),
+                                                                    5,
+                                                                    l_faBndTys.data(),
+                                                                    l_faVe.data(),
+                                                                    (double (*)[3]) l_veCrds.data(),
+                                                                    l_faEl.data(),
+                                                                    l_elFa.data(),
+                                                                    l_elFaEl.data(),
+                                                                    l_pFasGt );
+  REQUIRE( l_nUnpaired == 0 );
+
+  // bottom and top elements are neighbors through the periodic faces
+  for( edge_v::t_idx l_ix = 0; l_ix < l_nx; l_ix++ ) {
+    edge_v::t_idx l_elB = l_ix*2;
+    edge_v::t_idx l_elT = l_ix*2 + 1;
+
+    REQUIRE( l_elFaEl[l_elB*4 + 0] == l_elT );
+    REQUIRE( l_elFaEl[l_elT*4 + 2] == l_elB );
+
+    edge_v::t_idx l_faB = l_elFa[l_elB*4 + 0];
+    edge_v::t_idx l_faT = l_elFa[l_elT*4 + 2];
+    REQUIRE( l_faEl[l_faB*2 + 0] == l_elB );
+    REQUIRE( l_faEl[l_faB*2 + 1] == l_elT );
+    REQUIRE( l_faEl[l_faT*2 + 0] == l_elT );
+    REQUIRE( l_faEl[l_faT*2 + 1] == l_elB );
+  }
+
+  // the top faces are adjacent to the element with the greater id first
+  REQUIRE( l_pFasGt.size() == l_nx );
+  for( std::size_t l_pf = 0; l_pf < l_pFasGt.size(); l_pf++ ) {
+    REQUIRE( l_faVe[ l_pFasGt[l_pf]*2 ] % 3 == 2 );
+  }
+
+  // no other boundaries were touched
+  REQUIRE( l_elFaEl[3] == l_no );
+  REQUIRE( l_elFaEl[(l_nx*2-1)*4 + 1] == l_no );
+}
+
+TEST_CASE( "Tests the insertion of periodic boundaries.", "[mesh][periodic]" ) {
+  double l_shifts[3] = { 0, 0, 0 };
+  testPeriodicStrip( l_shifts );
+}
+
+TEST_CASE( "Tests periodic face pairs, whose coordinates straddle a rounding boundary.", "[mesh][periodicBin]" ) {
+  double l_tol = edge_v::mesh::Mesh::m_tol;
+
+  // bottom and top centroids at ix+0.5 -+ 0.4*m_tol: within the tolerance, but in different bins
+  double l_shifts0[3] = { -0.4*l_tol, 0, 0.4*l_tol };
+  testPeriodicStrip( l_shifts0 );
+
+  // bottom and top vertices at 0.1*m_tol and 0.9*m_tol: within the tolerance, but rounded to different multiples of m_tol
+  double l_shifts1[3] = {  0.1*l_tol, 0, 0.9*l_tol };
+  testPeriodicStrip( l_shifts1 );
+}
+
+TEST_CASE( "Tests writing and mapping binary meshes.", "[mesh][binary]" ) {
+  // only continue if the unit test files are available
+  if( edge_v::test::g_files != "" ) {
+    // path to the mesh file
+    std::string l_path = edge_v::test::g_files + "/la_habra_small.msh";
+
+    // construct the mesh-interface
+    edge_v::io::Gmsh l_gmsh;
+    l_gmsh.open( l_path );
+    l_gmsh.readMesh();
+
+    edge_v::mesh::Mesh l_meshGmsh( l_gmsh );
+
+    // write binary mesh and map it again
+    std::string l_pathBin = std::tmpnam(nullptr);
+    l_meshGmsh.write( l_pathBin );
+
+    edge_v::mesh::Mesh l_meshBin( l_pathBin );
+    REQUIRE( l_meshBin.m_map != nullptr );
+
+    REQUIRE( l_meshBin.getTypeEl() == l_meshGmsh.getTypeEl() );
+    REQUIRE( l_meshBin.nVes() == l_meshGmsh.nVes() );
+    REQUIRE( l_meshBin.nFas() == l_meshGmsh.nFas() );
+    REQUIRE( l_meshBin.nEls() == l_meshGmsh.nEls() );
+
+    unsigned short l_nElVes = l_meshGmsh.nElVes();
+    unsigned short l_nElFas = CE_N_FAS( l_meshGmsh.getTypeEl() );
+    unsigned short l_nFaVes = CE_N_VES( l_meshGmsh.getTypeFa() );
+
+    for( edge_v::t_idx l_ve = 0; l_ve < l_meshGmsh.nVes(); l_ve++ ) {
+      for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+        REQUIRE( l_meshBin.getVeCrds()[l_ve][l_di] == l_meshGmsh.getVeCrds()[l_ve][l_di] );
+      }
+      REQUIRE( l_meshBin.getSpTypeVe()[l_ve] == l_meshGmsh.getSpTypeVe()[l_ve] );
+    }
+
+    for( edge_v::t_idx l_fa = 0; l_fa < l_meshGmsh.nFas(); l_fa++ ) {
+      for( unsigned short l_ve = 0; l_ve < l_nFaVes; l_ve++ ) {
+        REQUIRE( l_meshBin.getFaVe()[l_fa*l_nFaVes + l_ve] == l_meshGmsh.getFaVe()[l_fa*l_nFaVes + l_ve] );
+      }
+      REQUIRE( l_meshBin.getFaEl()[l_fa*2+0] == l_meshGmsh.getFaEl()[l_fa*2+0] );
+      REQUIRE( l_meshBin.getFaEl()[l_fa*2+1] == l_meshGmsh.getFaEl()[l_fa*2+1] );
+      REQUIRE( l_meshBin.getSpTypeFa()[l_fa] == l_meshGmsh.getSpTypeFa()[l_fa] );
+      REQUIRE( l_meshBin.getAreasFa()[l_fa] == l_meshGmsh.getAreasFa()[l_fa] );
+      for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+        REQUIRE( l_meshBin.getNormalsFa()[l_fa][l_di] == l_meshGmsh.getNormalsFa()[l_fa][l_di] );
+        REQUIRE( l_meshBin.getTangentsFa()[l_fa][0][l_di] == l_meshGmsh.getTangentsFa()[l_fa][0][l_di] );
+        REQUIRE( l_meshBin.getTangentsFa()[l_fa][1][l_di] == l_meshGmsh.getTangentsFa()[l_fa][1][l_di] );
+      }
+    }
+
+    for( edge_v::t_idx l_el = 0; l_el < l_meshGmsh.nEls(); l_el++ ) {
+      for( unsigned short l_ve = 0; l_ve < l_nElVes; l_ve++ ) {
+        REQUIRE( l_meshBin.getElVe()[l_el*l_nElVes + l_ve] == l_meshGmsh.getElVe()[l_el*l_nElVes + l_ve] );
+      }
+      for( unsigned short l_fa = 0; l_fa < l_nElFas; l_fa++ ) {
+        REQUIRE( l_meshBin.getElFa()[l_el*l_nElFas + l_fa] == l_meshGmsh.getElFa()[l_el*l_nElFas + l_fa] );
+        REQUIRE( l_meshBin.getElFaEl()[l_el*l_nElFas + l_fa] == l_meshGmsh.getElFaEl()[l_el*l_nElFas + l_fa] );
+      }
+      REQUIRE( l_meshBin.getSpTypeEl()[l_el] == l_meshGmsh.getSpTypeEl()[l_el] );
+      REQUIRE( l_meshBin.getInDiasEl()[l_el] == l_meshGmsh.getInDiasEl()[l_el] );
+      REQUIRE( l_meshBin.getVolumesEl()[l_el] == l_meshGmsh.getVolumesEl()[l_el] );
+    }
+
+    std::remove( l_pathBin.c_str() );
+  }
+}
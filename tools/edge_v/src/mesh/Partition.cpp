@@ -22,14 +22,17 @@
  * Derives mesh partitions.
  **/
 #include "Partition.h"
+#include <string>
 #ifdef PP_USE_METIS
 #include <metis.h>
 #endif
 #include "../io/logging.h"
 
 edge_v::mesh::Partition::Partition( Mesh           const & i_mesh,
-                                    unsigned short const * i_elTg ): m_mesh( i_mesh ),
-                                                                     m_elTg( i_elTg ) {
+                                    unsigned short const * i_elTg,
+                                    unsigned short const * i_rates ): m_mesh( i_mesh ),
+                                                                      m_elTg( i_elTg ),
+                                                                      m_rates( i_rates ) {
   // allocate memory
   m_elPa = new t_idx[ m_mesh.nEls() ];
   m_elPr = new t_idx[ m_mesh.nEls() ];
@@ -139,8 +142,58 @@ void edge_v::mesh::Partition::getElPr( edge_v::t_entityType         i_elTy,
   }
 }
 
+std::size_t edge_v::mesh::Partition::getStats( edge_v::t_entityType         i_elTy,
+                                               t_idx                        i_nEls,
+                                               t_idx                const * i_elFaEl,
+                                               unsigned short       const * i_elTg,
+                                               unsigned short       const * i_rates,
+                                               unsigned short               i_nTgs,
+                                               t_idx                        i_nPas,
+                                               t_idx                const * i_elPa,
+                                               double                     * o_imbalance ) {
+  unsigned short l_nElFas = CE_N_FAS( i_elTy );
+
+  // number of elements per partition and time group
+  t_idx * l_nPaTgEls = new t_idx[ i_nPas*i_nTgs ];
+  for( t_idx l_id = 0; l_id < i_nPas*i_nTgs; l_id++ ) l_nPaTgEls[l_id] = 0;
+
+  std::size_t l_commVol = 0;
+  for( t_idx l_el = 0; l_el < i_nEls; l_el++ ) {
+    t_idx l_pa = i_elPa[l_el];
+    l_nPaTgEls[ l_pa*i_nTgs + i_elTg[l_el] ]++;
+
+    // every face at a partition boundary is sent at the frequency of the smaller time group
+    for( unsigned short l_fa = 0; l_fa < l_nElFas; l_fa++ ) {
+      t_idx l_ad = i_elFaEl[ l_el*l_nElFas + l_fa ];
+      if( l_ad != std::numeric_limits< t_idx >::max() && i_elPa[l_ad] != l_pa ) {
+        l_commVol += nUpdates( std::min( i_elTg[l_el], i_elTg[l_ad] ),
+                               i_nTgs-1,
+                               i_rates );
+      }
+    }
+  }
+
+  // derive the imbalance of the time groups
+  for( unsigned short l_tg = 0; l_tg < i_nTgs; l_tg++ ) {
+    t_idx l_nMax = 0;
+    t_idx l_nSum = 0;
+    for( t_idx l_pa = 0; l_pa < i_nPas; l_pa++ ) {
+      l_nMax = std::max( l_nMax, l_nPaTgEls[ l_pa*i_nTgs + l_tg ] );
+      l_nSum += l_nPaTgEls[ l_pa*i_nTgs + l_tg ];
+    }
+
+    o_imbalance[l_tg] = 1;
+    if( l_nSum > 0 ) o_imbalance[l_tg] = double(l_nMax) * i_nPas / l_nSum;
+  }
+
+  delete[] l_nPaTgEls;
+
+  return l_commVol;
+}
+
 void edge_v::mesh::Partition::kWay( t_idx          i_nParts,
-                                    unsigned short i_nCuts ) {
+                                    unsigned short i_nCuts,
+                                    bool           i_multiCon ) {
   EDGE_V_CHECK_GT( i_nParts, 1 );
 
   // get info from mesh
@@ -158,10 +211,34 @@ void edge_v::mesh::Partition::kWay( t_idx          i_nParts,
                 l_xadj,
                 l_adjncy );
 
+  // determine the time groups and their constraints, skipping empty groups
+  unsigned short l_nTgs = 1;
+  if( m_elTg != nullptr ) {
+    for( t_idx l_el = 0; l_el < l_nEls; l_el++ ) {
+      l_nTgs = std::max( l_nTgs, (unsigned short) (m_elTg[l_el]+1) );
+    }
+  }
+
+  unsigned short * l_tgCon = nullptr;
+  idx_t l_ncon = 1;
+  if( m_elTg != nullptr && i_multiCon && l_nTgs > 1 ) {
+    l_tgCon = new unsigned short[ l_nTgs ];
+    for( unsigned short l_tg = 0; l_tg < l_nTgs; l_tg++ ) l_tgCon[l_tg] = std::numeric_limits< unsigned short >::max();
+    for( t_idx l_el = 0; l_el < l_nEls; l_el++ ) l_tgCon[ m_elTg[l_el] ] = 0;
+
+    l_ncon = 0;
+    for( unsigned short l_tg = 0; l_tg < l_nTgs; l_tg++ ) {
+      if( l_tgCon[l_tg] == 0 ) {
+        l_tgCon[l_tg] = l_ncon;
+        l_ncon++;
+      }
+    }
+  }
+
   idx_t * l_vwgt = nullptr;
   idx_t * l_adjwgt = nullptr;
   if( m_elTg != nullptr ) {
-    l_vwgt = new idx_t[ l_nEls ];
+    l_vwgt = new idx_t[ l_nEls*l_ncon ];
     l_adjwgt = new idx_t[ l_xadj[l_nEls] ];
 
     getWeights( l_elTy,
@@ -169,38 +246,88 @@ void edge_v::mesh::Partition::kWay( t_idx          i_nParts,
                 l_xadj[l_nEls],
                 l_elFaEl,
                 m_elTg,
+                m_rates,
+                l_ncon,
+                l_tgCon,
                 l_vwgt,
                 l_adjwgt );
   }
+  if( l_tgCon != nullptr ) delete[] l_tgCon;
 
   // set remaining metis parameters
   idx_t l_nvtxs = l_nEls;
-  idx_t l_ncon = 1;
   idx_t l_objVal = 0;
-  idx_t * l_elPa = new idx_t[ l_nEls ];
+  idx_t * l_elPaCu = new idx_t[ l_nEls ];
+  t_idx * l_elPa = new t_idx[ l_nEls ];
   idx_t l_nParts = i_nParts;
   idx_t l_opts[METIS_NOPTIONS];
   int l_err = METIS_SetDefaultOptions(l_opts);
   EDGE_V_CHECK_EQ( l_err, METIS_OK );
   l_opts[METIS_OPTION_CONTIG] = 1;
   l_opts[METIS_OPTION_OBJTYPE] = METIS_OBJTYPE_VOL;
-  l_opts[METIS_OPTION_NCUTS] = i_nCuts;
-
-  // call metis
-  l_err = METIS_PartGraphKway( &l_nvtxs,
-                               &l_ncon,
-                                l_xadj,
-                                l_adjncy,
-                                l_vwgt,
-                                NULL,
-                                l_adjwgt,
-                                &l_nParts,
-                                NULL,
-                                NULL,
-                                l_opts,
-                                &l_objVal,
-                                l_elPa );
-  EDGE_V_CHECK_EQ( l_err, METIS_OK );
+
+  // compute the candidate cuts one by one, which allows us to report their predicted performance
+  EDGE_V_LOG_INFO << "  computing " << i_nCuts << " candidate cuts using " << l_ncon << " constraint(s)";
+  double * l_imbalance = new double[ l_nTgs ];
+  unsigned short * l_elTgSt = nullptr;
+  if( m_elTg == nullptr ) {
+    l_elTgSt = new unsigned short[ l_nEls ];
+    for( t_idx l_el = 0; l_el < l_nEls; l_el++ ) l_elTgSt[l_el] = 0;
+  }
+  unsigned short const * l_elTg = (m_elTg != nullptr) ? m_elTg : l_elTgSt;
+  std::size_t l_commVolBest = std::numeric_limits< std::size_t >::max();
+
+  for( unsigned short l_cu = 0; l_cu < std::max( i_nCuts, (unsigned short) 1 ); l_cu++ ) {
+    l_opts[METIS_OPTION_SEED] = l_cu;
+
+    // call metis
+    l_err = METIS_PartGraphKway( &l_nvtxs,
+                                 &l_ncon,
+                                  l_xadj,
+                                  l_adjncy,
+                                  l_vwgt,
+                                  NULL,
+                                  l_adjwgt,
+                                 &l_nParts,
+                                  NULL,
+                                  NULL,
+                                  l_opts,
+                                 &l_objVal,
+                                  l_elPaCu );
+    EDGE_V_CHECK_EQ( l_err, METIS_OK );
+
+    for( t_idx l_el = 0; l_el < l_nEls; l_el++ ) {
+      m_elPa[l_el] = l_elPaCu[l_el];
+    }
+
+    std::size_t l_commVol = getStats( l_elTy,
+                                      l_nEls,
+                                      l_elFaEl,
+                                      l_elTg,
+                                      m_rates,
+                                      l_nTgs,
+                                      i_nParts,
+                                      m_elPa,
+                                      l_imbalance );
+
+    std::string l_imStr = "";
+    for( unsigned short l_tg = 0; l_tg < l_nTgs; l_tg++ ) {
+      l_imStr += " " + std::to_string( l_imbalance[l_tg] );
+    }
+    EDGE_V_LOG_INFO << "    cut #" << l_cu << ": comm volume " << l_commVol
+                    << ", imbalance per time group:" << l_imStr;
+
+    // keep the cut with the lowest communication volume
+    if( l_commVol < l_commVolBest ) {
+      l_commVolBest = l_commVol;
+      for( t_idx l_el = 0; l_el < l_nEls; l_el++ ) {
+        l_elPa[l_el] = m_elPa[l_el];
+      }
+      EDGE_V_LOG_INFO << "      new best cut";
+    }
+  }
+  delete[] l_imbalance;
+  if( l_elTgSt != nullptr ) delete[] l_elTgSt;
 
   // free intermediate adjacency memory
   if( m_elTg != nullptr ) {
@@ -209,6 +336,7 @@ void edge_v::mesh::Partition::kWay( t_idx          i_nParts,
   }
   delete[] l_adjncy;
   delete[] l_xadj;
+  delete[] l_elPaCu;
 
   // store results
 #ifdef PP_USE_OMP
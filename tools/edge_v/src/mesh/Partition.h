@@ -26,6 +26,7 @@
 
 #include "Mesh.h"
 #include <algorithm>
+#include <cstddef>
 
 namespace edge_v {
   namespace mesh {
@@ -53,6 +54,9 @@ class edge_v::mesh::Partition {
     //! time groups of the elements
     unsigned short const * m_elTg = nullptr;
 
+    //! rates of the time groups w.r.t. the next smaller ones, nullptr for rate-2 LTS
+    unsigned short const * m_rates = nullptr;
+
     //! priorities of the elements
     t_idx * m_elPr = nullptr;
 
@@ -132,14 +136,39 @@ class edge_v::mesh::Partition {
       }
     }
 
+    /**
+     * Gets the number of updates of a time group per time step of the largest time group.
+     *
+     * @param i_tg time group.
+     * @param i_tgMax largest time group.
+     * @param i_rates rates of the time groups w.r.t. the next smaller ones, nullptr for rate-2 LTS.
+     * @return number of updates.
+     **/
+    static std::size_t nUpdates( unsigned short         i_tg,
+                                 unsigned short         i_tgMax,
+                                 unsigned short const * i_rates ) {
+      std::size_t l_nUps = 1;
+      for( unsigned short l_tg = i_tg; l_tg < i_tgMax; l_tg++ ) {
+        l_nUps *= (i_rates != nullptr) ? i_rates[l_tg] : 2;
+      }
+      return l_nUps;
+    }
+
     /**
      * Gets the weights of the dual graph.
      *
+     * In the case of a single constraint, the weight of a vertex is given by the number of updates of the element.
+     * For multiple constraints, the element's updates are assigned to the constraint of its time group;
+     * the vertex weights are stored in i_nCon consecutive entries per element.
+     *
      * @param i_elTy element type.
      * @param i_nEls number of elements.
      * @param i_nAdjwgt number of vertices in the adjacency structure.
      * @param i_elFaEl elements adjacent to elements.
      * @param i_elTg time groups of the elements.
+     * @param i_rates rates of the time groups w.r.t. the next smaller ones, nullptr for rate-2 LTS.
+     * @param i_nCon number of constraints.
+     * @param i_tgCon constraints of the time groups, nullptr for a single constraint.
      * @param o_vwgt will be set to the weights of the vertices.
      * @param o_adjwgt will be set to the weights of the edges.
      *
@@ -155,6 +184,9 @@ class edge_v::mesh::Partition {
                             T_XADJ                     i_nAdjwgt,
                             t_idx              const * i_elFaEl,
                             unsigned short     const * i_elTg,
+                            unsigned short     const * i_rates,
+                            unsigned short             i_nCon,
+                            unsigned short     const * i_tgCon,
                             T_VWGT                   * o_vwgt,
                             T_ADJWGT                 * o_adjwgt ) {
       unsigned short l_nElFas = CE_N_FAS( i_elTy );
@@ -163,7 +195,9 @@ class edge_v::mesh::Partition {
       unsigned short l_tgMax = 0;
       for( t_idx l_el = 0; l_el < i_nEls; l_el++ ) {
         l_tgMax = std::max( l_tgMax, i_elTg[l_el] );
-        o_vwgt[l_el] = 1;
+        for( unsigned short l_co = 0; l_co < i_nCon; l_co++ ) {
+          o_vwgt[l_el*i_nCon + l_co] = 0;
+        }
       }
 
       for( T_XADJ l_ad = 0; l_ad < i_nAdjwgt; l_ad++ )
@@ -172,23 +206,24 @@ class edge_v::mesh::Partition {
       t_idx l_adId = 0;
       for( t_idx l_el = 0; l_el < i_nEls; l_el++ ) {
         // set vertex weight
-        for( unsigned short l_tg = i_elTg[l_el]; l_tg < l_tgMax; l_tg++ ) {
-          o_vwgt[l_el] *= 2;
-        }
+        unsigned short l_co = (i_tgCon != nullptr) ? i_tgCon[ i_elTg[l_el] ] : 0;
+        o_vwgt[l_el*i_nCon + l_co] = nUpdates( i_elTg[l_el],
+                                                l_tgMax,
+                                                i_rates );
 
         for( t_idx l_fa = 0; l_fa < l_nElFas; l_fa++ ) {
           t_idx l_ad = i_elFaEl[l_el*l_nElFas + l_fa];
 
           if( l_ad != std::numeric_limits< t_idx >::max() ) {
-            // larger time group elements have to sent twice the amount
+            // larger time group elements have to sent rate-times the amount
             // -> comm volume is given by frequency of min time group
             unsigned short l_minTg = std::min( i_elTg[l_el],
                                                i_elTg[l_ad] );
 
             // set edge weight
-            for( unsigned short l_tg = l_minTg; l_tg < l_tgMax; l_tg++ ) {
-              o_adjwgt[l_adId] *= 2;
-            }
+            o_adjwgt[l_adId] = nUpdates( l_minTg,
+                                         l_tgMax,
+                                         i_rates );
 
             l_adId++;
           }
@@ -196,15 +231,44 @@ class edge_v::mesh::Partition {
       }
     }
 
+    /**
+     * Gets the predicted load imbalance per time group and the communication volume of a partitioning.
+     *
+     * The imbalance of a time group is the maximum number of the group's elements in a partition divided by the average one.
+     * The communication volume is the number of face-messages, sent by all partitions, per time step of the largest time group.
+     *
+     * @param i_elTy element type.
+     * @param i_nEls number of elements.
+     * @param i_elFaEl elements adjacent to elements.
+     * @param i_elTg time groups of the elements.
+     * @param i_rates rates of the time groups w.r.t. the next smaller ones, nullptr for rate-2 LTS.
+     * @param i_nTgs number of time groups.
+     * @param i_nPas number of partitions.
+     * @param i_elPa partitions of the elements.
+     * @param o_imbalance will be set to the imbalance of every time group.
+     * @return communication volume.
+     **/
+    static std::size_t getStats( edge_v::t_entityType         i_elTy,
+                                 t_idx                        i_nEls,
+                                 t_idx                const * i_elFaEl,
+                                 unsigned short       const * i_elTg,
+                                 unsigned short       const * i_rates,
+                                 unsigned short               i_nTgs,
+                                 t_idx                        i_nPas,
+                                 t_idx                const * i_elPa,
+                                 double                     * o_imbalance );
+
   public:
     /**
      * Constructor.
      *
      * @param i_mesh mesh interface.
      * @param i_elTg time groups of the elements.
+     * @param i_rates rates of the time groups w.r.t. the next smaller ones, nullptr for rate-2 LTS.
      **/
     Partition( Mesh           const & i_mesh,
-               unsigned short const * i_elTg );
+               unsigned short const * i_elTg,
+               unsigned short const * i_rates = nullptr );
 
     /**
      * Destructor.
@@ -213,12 +277,15 @@ class edge_v::mesh::Partition {
 
     /**
      * Uses Metis' PartGraphKway to determine the partitioning.
+     * The predicted per-time-group imbalance and communication volume of every candidate partitioning are reported.
      *
      * @param i_nPars number of partitions to generate.
      * @param i_nCuts number of partitions computed; the one with lowest comm volume is stored.
+     * @param i_multiCon if true, every time group is balanced separately (one constraint per time group).
      **/
     void kWay( t_idx          i_nParts,
-               unsigned short i_nCuts = 5 );
+               unsigned short i_nCuts = 5,
+               bool           i_multiCon = true );
 
     /**
      * Gets the element to partition assignment.
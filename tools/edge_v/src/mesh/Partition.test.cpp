@@ -76,6 +76,39 @@ TEST_CASE( "Tests the PartGraphKway call of the partitioner.", "[partition][kWay
       REQUIRE( l_elPa[l_el] < 4 );
     }
 
+    // assign three time groups, the middle one is empty
+    for( edge_v::t_idx l_el = 0; l_el < l_mesh.nEls(); l_el++ ) {
+      l_elTg[l_el] = (l_el%3 == 0) ? 0 : 2;
+    }
+
+    // construct partitioner
+    edge_v::mesh::Partition l_part2( l_mesh,
+                                     l_elTg );
+
+    // test with one constraint per non-empty time group
+    l_part2.kWay( 4 );
+    l_elPa = l_part2.getElPa();
+    for( edge_v::t_idx l_el = 0; l_el < l_mesh.nEls(); l_el++ ) {
+      REQUIRE( l_elPa[l_el] < 4 );
+    }
+
+    // check the predicted per-group balance of the stored partitioning, rate-2 LTS
+    double l_imbalance[3] = {0};
+    edge_v::mesh::Partition::getStats( l_mesh.getTypeEl(),
+                                       l_mesh.nEls(),
+                                       l_mesh.getElFaEl(),
+                                       l_elTg,
+                                       nullptr,
+                                       3,
+                                       4,
+                                       l_elPa,
+                                       l_imbalance );
+    REQUIRE( l_imbalance[0] >= 1.0 );
+    REQUIRE( l_imbalance[0] <  1.25 );
+    REQUIRE( l_imbalance[1] == Approx(1.0) );
+    REQUIRE( l_imbalance[2] >= 1.0 );
+    REQUIRE( l_imbalance[2] <  1.25 );
+
     delete[] l_elTg;
   }
 }
@@ -165,4 +198,120 @@ TEST_CASE( "Tests the computation of element priorities.", "[partition][elPr]" )
   REQUIRE( l_elPr[8] == 10 );
   REQUIRE( l_elPr[7] == 16 );
   REQUIRE( l_elPr[0] == 23 );
-}
\ No newline at end of file
+}
+
+TEST_CASE( "Tests the derivation of the dual graph's weights.", "[partition][weights]" ) {
+  /*
+   * Four triangles in a chain: 0 - 1 - 2 - 3
+   * time groups: 0, 1, 1, 2; rates: 3, 2
+   */
+  edge_v::t_idx l_elFaEl[4][3] = {
+    { 1, std::numeric_limits< edge_v::t_idx >::max(), std::numeric_limits< edge_v::t_idx >::max() },
+    { 0, 2, std::numeric_limits< edge_v::t_idx >::max() },
+    { 1, 3, std::numeric_limits< edge_v::t_idx >::max() },
+    { 2, std::numeric_limits< edge_v::t_idx >::max(), std::numeric_limits< edge_v::t_idx >::max() }
+  };
+  unsigned short l_elTg[4] = { 0, 1, 1, 2 };
+  unsigned short l_rates[2] = { 3, 2 };
+
+  int l_xadj[5] = {0};
+  int l_adjncy[6] = {0};
+  edge_v::mesh::Partition::getDualGraph( edge_v::TRIA3,
+                                         4,
+                                         l_elFaEl[0],
+                                         l_xadj,
+                                         l_adjncy );
+  REQUIRE( l_xadj[4] == 6 );
+
+  // single constraint
+  int l_vwgt[4*3] = {0};
+  int l_adjwgt[6] = {0};
+  edge_v::mesh::Partition::getWeights( edge_v::TRIA3,
+                                       4,
+                                       l_xadj[4],
+                                       l_elFaEl[0],
+                                       l_elTg,
+                                       l_rates,
+                                       1,
+                                       nullptr,
+                                       l_vwgt,
+                                       l_adjwgt );
+
+  REQUIRE( l_vwgt[0] == 6 );
+  REQUIRE( l_vwgt[1] == 2 );
+  REQUIRE( l_vwgt[2] == 2 );
+  REQUIRE( l_vwgt[3] == 1 );
+
+  REQUIRE( l_adjwgt[0] == 6 );
+  REQUIRE( l_adjwgt[1] == 6 );
+  REQUIRE( l_adjwgt[2] == 2 );
+  REQUIRE( l_adjwgt[3] == 2 );
+  REQUIRE( l_adjwgt[4] == 2 );
+  REQUIRE( l_adjwgt[5] == 2 );
+
+  // one constraint per time group
+  unsigned short l_tgCon[3] = { 0, 1, 2 };
+  edge_v::mesh::Partition::getWeights( edge_v::TRIA3,
+                                       4,
+                                       l_xadj[4],
+                                       l_elFaEl[0],
+                                       l_elTg,
+                                       l_rates,
+                                       3,
+                                       l_tgCon,
+                                       l_vwgt,
+                                       l_adjwgt );
+
+  int l_vwgtRef[4*3] = { 6, 0, 0,
+                         0, 2, 0,
+                         0, 2, 0,
+                         0, 0, 1 };
+  for( unsigned short l_id = 0; l_id < 4*3; l_id++ ) {
+    REQUIRE( l_vwgt[l_id] == l_vwgtRef[l_id] );
+  }
+  REQUIRE( l_adjwgt[0] == 6 );
+  REQUIRE( l_adjwgt[5] == 2 );
+}
+
+TEST_CASE( "Tests the predicted imbalance and communication volume of a partitioning.", "[partition][stats]" ) {
+  // same chain as above: 0 - 1 - 2 - 3
+  edge_v::t_idx l_elFaEl[4][3] = {
+    { 1, std::numeric_limits< edge_v::t_idx >::max(), std::numeric_limits< edge_v::t_idx >::max() },
+    { 0, 2, std::numeric_limits< edge_v::t_idx >::max() },
+    { 1, 3, std::numeric_limits< edge_v::t_idx >::max() },
+    { 2, std::numeric_limits< edge_v::t_idx >::max(), std::numeric_limits< edge_v::t_idx >::max() }
+  };
+  unsigned short l_elTg[4] = { 0, 1, 1, 2 };
+  unsigned short l_rates[2] = { 3, 2 };
+  double l_imbalance[3] = {0};
+
+  // balanced in the middle time group, cut at the coarsest face
+  edge_v::t_idx l_elPa0[4] = { 0, 0, 1, 1 };
+  std::size_t l_commVol = edge_v::mesh::Partition::getStats( edge_v::TRIA3,
+                                                             4,
+                                                             l_elFaEl[0],
+                                                             l_elTg,
+                                                             l_rates,
+                                                             3,
+                                                             2,
+                                                             l_elPa0,
+                                                             l_imbalance );
+  REQUIRE( l_commVol == 2*2 );
+  REQUIRE( l_imbalance[0] == Approx(2.0) );
+  REQUIRE( l_imbalance[1] == Approx(1.0) );
+  REQUIRE( l_imbalance[2] == Approx(2.0) );
+
+  // imbalanced in the middle time group, cut at the finest face
+  edge_v::t_idx l_elPa1[4] = { 0, 1, 1, 1 };
+  l_commVol = edge_v::mesh::Partition::getStats( edge_v::TRIA3,
+                                                 4,
+                                                 l_elFaEl[0],
+                                                 l_elTg,
+                                                 l_rates,
+                                                 3,
+                                                 2,
+                                                 l_elPa1,
+                                                 l_imbalance );
+  REQUIRE( l_commVol == 2*6 );
+  REQUIRE( l_imbalance[1] == Approx(2.0) );
+}
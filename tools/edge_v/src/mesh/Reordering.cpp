@@ -0,0 +1,205 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Locality-aware reordering of the elements.
+ **/
+#include "Reordering.h"
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <vector>
+#include "../io/logging.h"
+
+void edge_v::mesh::Reordering::centroids( t_entityType         i_elTy,
+                                          t_idx                i_nEls,
+                                          t_idx        const * i_elVe,
+                                          double       const (* i_veCrds)[3],
+                                          double             (* o_crds)[3] ) {
+  unsigned short l_nElVes = CE_N_VES( i_elTy );
+
+#ifdef PP_USE_OMP
+#pragma omp parallel for
+#endif
+  for( t_idx l_el = 0; l_el < i_nEls; l_el++ ) {
+    for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+      o_crds[l_el][l_di] = 0;
+    }
+
+    for( unsigned short l_ve = 0; l_ve < l_nElVes; l_ve++ ) {
+      t_idx l_veId = i_elVe[l_el*l_nElVes + l_ve];
+      for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+        o_crds[l_el][l_di] += i_veCrds[l_veId][l_di];
+      }
+    }
+
+    for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+      o_crds[l_el][l_di] /= l_nElVes;
+    }
+  }
+}
+
+edge_v::t_idx edge_v::mesh::Reordering::morton( double const i_crds[3],
+                                                double const i_min[3],
+                                                double const i_max[3] ) {
+  // number of bits per dimension
+  unsigned short const l_nBits = 21;
+  t_idx const l_maxInt = (t_idx(1) << l_nBits) - 1;
+
+  // map the coordinates to integers
+  t_idx l_ints[3] = { 0, 0, 0 };
+  for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+    double l_ext = i_max[l_di] - i_min[l_di];
+    if( l_ext > 0 ) {
+      double l_rel = (i_crds[l_di] - i_min[l_di]) / l_ext;
+      l_rel = std::min( std::max( l_rel, 0.0 ), 1.0 );
+      l_ints[l_di] = t_idx( l_rel * l_maxInt );
+    }
+  }
+
+  // interleave the bits
+  t_idx l_code = 0;
+  for( unsigned short l_bi = 0; l_bi < l_nBits; l_bi++ ) {
+    for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+      l_code |= ( (l_ints[l_di] >> l_bi) & 1 ) << (3*l_bi + l_di);
+    }
+  }
+
+  return l_code;
+}
+
+void edge_v::mesh::Reordering::morton( t_idx                i_nPts,
+                                       double       const (* i_crds)[3],
+                                       t_idx              * o_keys ) {
+  // derive the bounding box
+  double l_min[3] = { std::numeric_limits< double >::max(),
+                      std::numeric_limits< double >::max(),
+                      std::numeric_limits< double >::max() };
+  double l_max[3] = { std::numeric_limits< double >::lowest(),
+                      std::numeric_limits< double >::lowest(),
+                      std::numeric_limits< double >::lowest() };
+
+  for( t_idx l_pt = 0; l_pt < i_nPts; l_pt++ ) {
+    for( unsigned short l_di = 0; l_di < 3; l_di++ ) {
+      l_min[l_di] = std::min( l_min[l_di], i_crds[l_pt][l_di] );
+      l_max[l_di] = std::max( l_max[l_di], i_crds[l_pt][l_di] );
+    }
+  }
+
+#ifdef PP_USE_OMP
+#pragma omp parallel for
+#endif
+  for( t_idx l_pt = 0; l_pt < i_nPts; l_pt++ ) {
+    o_keys[l_pt] = morton( i_crds[l_pt],
+                           l_min,
+                           l_max );
+  }
+}
+
+void edge_v::mesh::Reordering::rcm( unsigned short         i_nElFas,
+                                    t_idx                  i_nEls,
+                                    t_idx          const * i_elFaEl,
+                                    t_idx          const * i_elPr,
+                                    t_idx                * o_keys ) {
+  // lambda which returns the priority of an element
+  auto l_pr = [ i_elPr ]( t_idx i_el ) {
+    return (i_elPr != nullptr) ? i_elPr[i_el] : 0;
+  };
+
+  // derive the degrees w.r.t. to the block of the elements
+  std::vector< unsigned short > l_deg( i_nEls, 0 );
+  for( t_idx l_el = 0; l_el < i_nEls; l_el++ ) {
+    for( unsigned short l_fa = 0; l_fa < i_nElFas; l_fa++ ) {
+      t_idx l_ad = i_elFaEl[l_el*i_nElFas + l_fa];
+      if( l_ad != std::numeric_limits< t_idx >::max() && l_pr(l_ad) == l_pr(l_el) ) {
+        l_deg[l_el]++;
+      }
+    }
+  }
+
+  // sort the elements by block and degree, the first unvisited element of a block is the next start of the search
+  std::vector< t_idx > l_order( i_nEls );
+  for( t_idx l_el = 0; l_el < i_nEls; l_el++ ) l_order[l_el] = l_el;
+  std::sort( l_order.begin(),
+             l_order.end(),
+             [&]( t_idx i_e0, t_idx i_e1 ) {
+               if( l_pr(i_e0) != l_pr(i_e1) ) return l_pr(i_e0) < l_pr(i_e1);
+               if( l_deg[i_e0] != l_deg[i_e1] ) return l_deg[i_e0] < l_deg[i_e1];
+               return i_e0 < i_e1; } );
+
+  // Cuthill-McKee: breadth-first search with neighbors in order of increasing degree
+  std::vector< bool > l_visited( i_nEls, false );
+  std::vector< t_idx > l_adjs;
+  std::queue< t_idx > l_queue;
+  t_idx l_first = 0;
+  t_idx l_pos = 0;
+
+  for( t_idx l_or = 0; l_or < i_nEls; l_or++ ) {
+    t_idx l_start = l_order[l_or];
+
+    // reverse the previous block if a new block starts
+    if( l_or > 0 && l_pr(l_start) != l_pr(l_order[l_or-1]) ) {
+      for( t_idx l_bl = l_first; l_bl < l_or; l_bl++ ) {
+        o_keys[ l_order[l_bl] ] = l_pos - 1 - o_keys[ l_order[l_bl] ];
+      }
+      l_first = l_or;
+      l_pos = 0;
+    }
+
+    if( l_visited[l_start] ) continue;
+
+    l_visited[l_start] = true;
+    l_queue.push( l_start );
+
+    while( !l_queue.empty() ) {
+      t_idx l_el = l_queue.front();
+      l_queue.pop();
+      o_keys[l_el] = l_pos;
+      l_pos++;
+
+      // gather unvisited neighbors in the same block
+      l_adjs.resize( 0 );
+      for( unsigned short l_fa = 0; l_fa < i_nElFas; l_fa++ ) {
+        t_idx l_ad = i_elFaEl[l_el*i_nElFas + l_fa];
+        if(    l_ad != std::numeric_limits< t_idx >::max()
+            && l_pr(l_ad) == l_pr(l_el)
+            && !l_visited[l_ad] ) {
+          l_visited[l_ad] = true;
+          l_adjs.push_back( l_ad );
+        }
+      }
+
+      std::sort( l_adjs.begin(),
+                 l_adjs.end(),
+                 [&]( t_idx i_e0, t_idx i_e1 ) {
+                   if( l_deg[i_e0] != l_deg[i_e1] ) return l_deg[i_e0] < l_deg[i_e1];
+                   return i_e0 < i_e1; } );
+
+      for( std::size_t l_ad = 0; l_ad < l_adjs.size(); l_ad++ ) l_queue.push( l_adjs[l_ad] );
+    }
+  }
+
+  // reverse the last block
+  for( t_idx l_bl = l_first; l_bl < i_nEls; l_bl++ ) {
+    o_keys[ l_order[l_bl] ] = l_pos - 1 - o_keys[ l_order[l_bl] ];
+  }
+
+  EDGE_V_CHECK_EQ( l_pos, i_nEls - l_first );
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Locality-aware reordering of the elements.
+ **/
+#ifndef EDGE_V_MESH_REORDERING_H
+#define EDGE_V_MESH_REORDERING_H
+
+#include "../constants.h"
+
+namespace edge_v {
+  namespace mesh {
+    class Reordering;
+  }
+}
+
+/**
+ * Locality-aware reordering of the elements.
+ * The derived keys are used as secondary sort criterion within blocks of elements with equal priority,
+ * i.e., the elements of a partition's time group and inner or send region stay in their block.
+ **/
+class edge_v::mesh::Reordering {
+  public:
+    /**
+     * Derives the centroids of the elements.
+     *
+     * @param i_elTy element type.
+     * @param i_nEls number of elements.
+     * @param i_elVe vertices adjacent to the elements.
+     * @param i_veCrds coordinates of the vertices.
+     * @param o_crds will be set to the centroids of the elements.
+     **/
+    static void centroids( t_entityType         i_elTy,
+                           t_idx                i_nEls,
+                           t_idx        const * i_elVe,
+                           double       const (* i_veCrds)[3],
+                           double             (* o_crds)[3] );
+
+    /**
+     * Derives the Morton code (Z-order) of a point by interleaving 21 bits per dimension.
+     *
+     * @param i_crds coordinates of the point.
+     * @param i_min minimum coordinates of the bounding box.
+     * @param i_max maximum coordinates of the bounding box.
+     * @return Morton code.
+     **/
+    static t_idx morton( double const i_crds[3],
+                         double const i_min[3],
+                         double const i_max[3] );
+
+    /**
+     * Derives the keys of a space-filling curve (Morton order) for the given points.
+     *
+     * @param i_nPts number of points.
+     * @param i_crds coordinates of the points, e.g., the elements' centroids.
+     * @param o_keys will be set to the keys.
+     **/
+    static void morton( t_idx                i_nPts,
+                        double       const (* i_crds)[3],
+                        t_idx              * o_keys );
+
+    /**
+     * Derives the keys of a reverse Cuthill-McKee ordering.
+     * The ordering is derived independently for every block of elements with equal priority,
+     * only face-adjacent elements in the same block are considered as graph edges.
+     *
+     * @param i_nElFas number of faces per element.
+     * @param i_nEls number of elements.
+     * @param i_elFaEl elements adjacent to the elements (faces as bridge).
+     * @param i_elPr priorities of the elements, nullptr if all elements form a single block.
+     * @param o_keys will be set to the position of the elements in their block.
+     **/
+    static void rcm( unsigned short         i_nElFas,
+                     t_idx                  i_nEls,
+                     t_idx          const * i_elFaEl,
+                     t_idx          const * i_elPr,
+                     t_idx                * o_keys );
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,133 @@
+/**
+ * @file This file is part of EDGE.
+ *
+ * @author Alexander Breuer (anbreuer AT ucsd.edu)
+ *
+ * @section LICENSE
+ * Copyright (c) 2021, Friedrich Schiller University Jena
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * @section DESCRIPTION
+ * Tests the locality-aware reordering of the elements.
+ **/
+#include <catch.hpp>
+#include <limits>
+#define private public
+#include "Reordering.h"
+#undef private
+
+TEST_CASE( "Tests the derivation of element centroids.", "[reordering][centroids]" ) {
+  double l_veCrds[5][3] = { {0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {1, 1, 1} };
+  edge_v::t_idx l_elVe[8] = { 0, 1, 2, 3,
+                              1, 2, 3, 4 };
+
+  double l_crds[2][3];
+  edge_v::mesh::Reordering::centroids( edge_v::TET4,
+                                       2,
+                                       l_elVe,
+                                       l_veCrds,
+                                       l_crds );
+
+  REQUIRE( l_crds[0][0] == Approx( 0.25 ) );
+  REQUIRE( l_crds[0][1] == Approx( 0.25 ) );
+  REQUIRE( l_crds[0][2] == Approx( 0.25 ) );
+  REQUIRE( l_crds[1][0] == Approx( 0.5 ) );
+  REQUIRE( l_crds[1][1] == Approx( 0.5 ) );
+  REQUIRE( l_crds[1][2] == Approx( 0.5 ) );
+}
+
+TEST_CASE( "Tests the Morton order.", "[reordering][morton]" ) {
+  double l_min[3] = { 0, 0, 0 };
+  double l_max[3] = { 1, 1, 1 };
+
+  // corners of the bounding box
+  double l_crds0[3] = { 0, 0, 0 };
+  double l_crds1[3] = { 1, 1, 1 };
+  REQUIRE( edge_v::mesh::Reordering::morton( l_crds0, l_min, l_max ) == 0 );
+  REQUIRE( edge_v::mesh::Reordering::morton( l_crds1, l_min, l_max ) == (edge_v::t_idx(1) << 63) - 1 );
+
+  // cells of a 2x2x2 grid follow the z-order: x first, y second, z third
+  double l_crds[8][3];
+  edge_v::t_idx l_keys[8];
+  for( unsigned short l_ce = 0; l_ce < 8; l_ce++ ) {
+    l_crds[l_ce][0] = (l_ce >> 0) & 1;
+    l_crds[l_ce][1] = (l_ce >> 1) & 1;
+    l_crds[l_ce][2] = (l_ce >> 2) & 1;
+  }
+  edge_v::mesh::Reordering::morton( 8,
+                                    l_crds,
+                                    l_keys );
+
+  for( unsigned short l_ce = 0; l_ce < 7; l_ce++ ) {
+    REQUIRE( l_keys[l_ce] < l_keys[l_ce+1] );
+  }
+
+  // degenerated dimension (2D)
+  double l_crds2d[4][3] = { {0, 0, 5}, {1, 0, 5}, {0, 1, 5}, {1, 1, 5} };
+  edge_v::mesh::Reordering::morton( 4,
+                                    l_crds2d,
+                                    l_keys );
+  REQUIRE( l_keys[0] == 0 );
+  REQUIRE( l_keys[0] < l_keys[1] );
+  REQUIRE( l_keys[1] < l_keys[2] );
+  REQUIRE( l_keys[2] < l_keys[3] );
+}
+
+TEST_CASE( "Tests the reverse Cuthill-McKee order.", "[reordering][rcm]" ) {
+  edge_v::t_idx l_no = std::numeric_limits< edge_v::t_idx >::max();
+
+  // chain of six line elements with shuffled ids: 3 - 0 - 5 - 1 - 4 - 2
+  edge_v::t_idx l_elFaEl[6][2] = { { 3,    5    },
+                                   { 5,    4    },
+                                   { 4,    l_no },
+                                   { l_no, 0    },
+                                   { 1,    2    },
+                                   { 0,    1    } };
+  edge_v::t_idx l_keys[6];
+
+  edge_v::mesh::Reordering::rcm( 2,
+                                 6,
+                                 l_elFaEl[0],
+                                 nullptr,
+                                 l_keys );
+
+  // the keys are a permutation, which places neighbors next to each other
+  bool l_used[6] = { false, false, false, false, false, false };
+  for( unsigned short l_el = 0; l_el < 6; l_el++ ) {
+    REQUIRE( l_keys[l_el] < 6 );
+    REQUIRE( !l_used[ l_keys[l_el] ] );
+    l_used[ l_keys[l_el] ] = true;
+
+    for( unsigned short l_fa = 0; l_fa < 2; l_fa++ ) {
+      edge_v::t_idx l_ad = l_elFaEl[l_el][l_fa];
+      if( l_ad != l_no ) {
+        edge_v::t_idx l_diff = (l_keys[l_el] > l_keys[l_ad]) ? l_keys[l_el] - l_keys[l_ad] : l_keys[l_ad] - l_keys[l_el];
+        REQUIRE( l_diff == 1 );
+      }
+    }
+  }
+
+  // two blocks: {3, 0, 5} and {1, 4, 2}
+  edge_v::t_idx l_elPr[6] = { 0, 1, 1, 0, 1, 0 };
+  edge_v::mesh::Reordering::rcm( 2,
+                                 6,
+                                 l_elFaEl[0],
+                                 l_elPr,
+                                 l_keys );
+
+  // positions are local to the blocks
+  REQUIRE( l_keys[0] == 1 );
+  REQUIRE( l_keys[4] == 1 );
+  REQUIRE( l_keys[3] + l_keys[5] == 2 );
+  REQUIRE( l_keys[1] + l_keys[2] == 2 );
+}
\ No newline at end of file
@@ -124,7 +124,6 @@ edge_v::time::Groups::Groups( t_entityType           i_elTy,
   // check for valid rates and minimum relative time step
   for( unsigned short l_ra = 0; l_ra < i_nRates; l_ra++ ) {
     EDGE_V_CHECK_GT( i_rates[l_ra], 1.0 );
-    EDGE_V_CHECK_LE( i_rates[l_ra], 2.0 );
   }
   EDGE_V_CHECK_GT( i_funDt, 0 );
   EDGE_V_CHECK_LE( i_funDt, 1 );
@@ -110,4 +110,50 @@ TEST_CASE( "Tests the derivation of time step groups.", "[time][groups]" ) {
   REQUIRE( l_groups2.m_elTg[ 8] == 2 );
   REQUIRE( l_groups2.m_elTg[ 9] == 0 );
   REQUIRE( l_groups2.m_elTg[10] == 1 );
-}
\ No newline at end of file
+}
+
+TEST_CASE( "Tests the derivation of rate-3 time step groups.", "[time][groups][rate3]" ) {
+  /**
+   * Time groups of the first example above with integer rate-3 LTS:
+   *   0 [1.0, 3.0 ]
+   *   1 [3.0, 9.0 ]
+   *   2 [9.0, inf]
+   **/
+  double l_rates[2] = {3.0, 3.0};
+  double l_ts[11] = {12.3, 3.7,  10.4, 3.5,  5.0,  1.0 , 3.9,  3.6,  3.2, 1.5,  2.1};
+
+  edge_v::t_idx l_elFaEl[11*3];
+  for( unsigned short l_en = 0; l_en < 11*3; l_en++ ) l_elFaEl[l_en] = std::numeric_limits< edge_v::t_idx >::max();
+
+  edge_v::time::Groups l_groups1( edge_v::TRIA3,
+                                  11,
+                                  l_elFaEl,
+                                  2,
+                                  l_rates,
+                                  1.0,
+                                  l_ts );
+
+  REQUIRE( l_groups1.nGroups() == 3 );
+  REQUIRE( l_groups1.getTsIntervals()[1] == Approx(3.0) );
+  REQUIRE( l_groups1.getTsIntervals()[2] == Approx(9.0) );
+
+  unsigned short l_elTgRef[11] = {2, 1, 2, 1, 1, 0, 1, 1, 1, 0, 0};
+  for( unsigned short l_el = 0; l_el < 11; l_el++ ) {
+    REQUIRE( l_groups1.m_elTg[l_el] == l_elTgRef[l_el] );
+  }
+
+  // 3 elements in the first, 6 in the second and 2 in the third group
+  REQUIRE( l_groups1.getSpeedUp() == Approx( 11.0 / (3 / 1.0 + 6 / 3.0 + 2 / 9.0) ) );
+
+  // connecting elements 0 (group 2) and 5 (group 0) lowers element 0 to group 1
+  l_elFaEl[0*3 + 0] = 5;
+  edge_v::time::Groups l_groups2( edge_v::TRIA3,
+                                  11,
+                                  l_elFaEl,
+                                  2,
+                                  l_rates,
+                                  1.0,
+                                  l_ts );
+  REQUIRE( l_groups2.m_elTg[0] == 1 );
+  REQUIRE( l_groups2.m_elTg[2] == 2 );
+}
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+##
+# @file This file is part of EDGE.
+#
+# @author Alexander Breuer (anbreuer AT ucsd.edu)
+#
+# @section LICENSE
+# Copyright (c) 2021, Friedrich Schiller University Jena
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# @section DESCRIPTION
+# Converts binary receiver files (format bin) to the csv-layout of EDGE's receivers.
+##
+import logging
+import argparse
+import struct
+import os
+
+# set up logger
+logging.basicConfig( level=logging.INFO,
+                     format='%(asctime)s - %(name)s - %(levelname)s - %(message)s' )
+
+##
+# Reads a binary receiver file.
+#
+# @param i_file file which is read.
+# @return header info (dictionary) and receivers (list of dictionaries with name, coordinates, times and values).
+##
+def readBin( i_file ):
+  with open( i_file, 'rb' ) as l_fi:
+    l_data = l_fi.read()
+  l_pos = 0
+
+  def unpack( i_fmt ):
+    nonlocal l_pos
+    l_vals = struct.unpack_from( '<'+i_fmt, l_data, l_pos )
+    l_pos += struct.calcsize( '<'+i_fmt )
+    return l_vals
+
+  def unpackStr():
+    l_size = unpack( 'I' )[0]
+    return unpack( str(l_size)+'s' )[0].decode()
+
+  # header
+  if unpack( '8s' )[0] != b'EDGERECV':
+    raise ValueError( i_file + ' is not a binary receiver file' )
+  l_hd = {}
+  l_hd['version'], l_hd['real_size'], l_hd['n_qts'], l_hd['n_crs'], l_nRecvs = unpack( '5I' )
+  if l_hd['version'] != 1:
+    raise ValueError( 'unsupported version: ' + str(l_hd['version']) )
+  l_hd['code_version'] = unpackStr()
+  l_real = { 4: 'f', 8: 'd' }[ l_hd['real_size'] ]
+  l_nVas = l_hd['n_qts'] * l_hd['n_crs']
+
+  l_recvs = []
+  for l_re in range( l_nRecvs ):
+    l_recv = { 'name': unpackStr() }
+    l_recv['crds_sp'] = unpack( '3d' )
+    l_recv['crds_pr'] = unpack( '3d' )
+    l_recv['times']   = []
+    l_recv['vals']    = []
+    l_recvs = l_recvs + [ l_recv ]
+
+  # blocks, appended in the order of the flushes
+  while l_pos < len( l_data ):
+    l_re, l_nSas = unpack( '2I' )
+    l_recvs[l_re]['times'] += unpack( str(l_nSas)+l_real )
+    l_vals = unpack( str(l_nSas*l_nVas)+l_real )
+    for l_sa in range( l_nSas ):
+      l_recvs[l_re]['vals'] += [ l_vals[l_sa*l_nVas:(l_sa+1)*l_nVas] ]
+
+  return l_hd, l_recvs
+
+##
+# Writes a receiver in the csv-layout.
+#
+# @param i_hd header info.
+# @param i_recv receiver.
+# @param i_file file which is written.
+##
+def writeCsv( i_hd, i_recv, i_file ):
+  with open( i_file, 'w' ) as l_fi:
+    l_fi.write( '# EDGE\n' )
+    l_fi.write( '# code version: ' + i_hd['code_version'] + '\n' )
+    l_fi.write( '# receiver name: ' + i_recv['name'] + '\n' )
+    l_fi.write( '# specified coordinates: ' + ' '.join( '{:g}'.format(l_cr) for l_cr in i_recv['crds_sp'] ) + '\n' )
+    l_fi.write( '# projected coordinates: ' + ' '.join( '{:g}'.format(l_cr) for l_cr in i_recv['crds_pr'] ) + '\n' )
+
+    l_cols = [ 'time' ]
+    for l_qt in range( i_hd['n_qts'] ):
+      for l_cr in range( i_hd['n_crs'] ):
+        l_cols += [ 'Q' + str(l_qt) + '_C' + str(l_cr) ]
+    l_fi.write( ','.join( l_cols ) + '\n' )
+
+    for l_sa in range( len( i_recv['times'] ) ):
+      l_fi.write( '{:f}'.format( i_recv['times'][l_sa] ) )
+      for l_va in i_recv['vals'][l_sa]:
+        l_fi.write( ',{:e}'.format( l_va ) )
+      l_fi.write( '\n' )
+
+# command line arguments
+l_parser = argparse.ArgumentParser( description='Converts binary receiver files to csv-files, one per receiver.' )
+
+l_parser.add_argument( '--in_bin',
+                       dest     = 'in_bin',
+                       required = True,
+                       nargs    = '+',
+                       type     = str,
+                       help     = 'Paths of the binary receiver files, e.g., <out_dir>/*/receivers.bin.' )
+
+l_parser.add_argument( '--out_dir',
+                       dest     = 'out_dir',
+                       required = True,
+                       type     = str,
+                       help     = 'Output directory of the csv-files.' )
+l_args = vars(l_parser.parse_args())
+
+os.makedirs( l_args['out_dir'], exist_ok=True )
+
+for l_in in l_args['in_bin']:
+  logging.info( 'converting ' + l_in )
+  l_hd, l_recvs = readBin( l_in )
+
+  for l_recv in l_recvs:
+    writeCsv( l_hd, l_recv, os.path.join( l_args['out_dir'], l_recv['name']+'.csv' ) )
+
+logging.info( 'done with converting' )